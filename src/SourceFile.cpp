@@ -24,6 +24,7 @@
 #include <typechecker/FunctionManager.h>
 #include <typechecker/InterfaceManager.h>
 #include <typechecker/MacroDefs.h>
+#include <typechecker/CompileTimeEvaluator.h>
 #include <typechecker/PostTypeCheckingVerifier.h>
 #include <typechecker/StructManager.h>
 #include <typechecker/TypeChecker.h>
@@ -37,6 +38,7 @@
 
 #include <llvm/IR/Module.h>
 #include <llvm/MC/TargetRegistry.h>
+#include <llvm/Support/TimeProfiler.h>
 
 namespace spice::compiler {
 
@@ -78,6 +80,7 @@ void SourceFile::runLexer() {
   if (previousStage >= LEXER)
     return;
 
+  llvm::TimeTraceScope timeTraceScope("Lexer", fileName);
   Timer timer(&compilerOutput.times.lexer);
   timer.start();
 
@@ -109,6 +112,7 @@ void SourceFile::runParser() {
   if (restoredFromCache || previousStage >= PARSER)
     return;
 
+  llvm::TimeTraceScope timeTraceScope("Parser", fileName);
   Timer timer(&compilerOutput.times.parser);
   timer.start();
 
@@ -132,6 +136,7 @@ void SourceFile::runCSTVisualizer() {
   if (previousStage >= CST_VISUALIZER)
     return;
 
+  llvm::TimeTraceScope timeTraceScope("CST Visualizer", fileName);
   Timer timer(&compilerOutput.times.cstVisualizer);
   timer.start();
 
@@ -159,6 +164,7 @@ void SourceFile::runASTBuilder() {
   if (restoredFromCache || previousStage >= AST_BUILDER)
     return;
 
+  llvm::TimeTraceScope timeTraceScope("AST Builder", fileName);
   Timer timer(&compilerOutput.times.astBuilder);
   timer.start();
 
@@ -185,6 +191,7 @@ void SourceFile::runASTVisualizer() {
   if (previousStage >= AST_VISUALIZER)
     return;
 
+  llvm::TimeTraceScope timeTraceScope("AST Visualizer", fileName);
   Timer timer(&compilerOutput.times.astVisualizer);
   timer.start();
 
@@ -210,6 +217,7 @@ void SourceFile::runImportCollector() { // NOLINT(misc-no-recursion)
   if (restoredFromCache || previousStage >= IMPORT_COLLECTOR)
     return;
 
+  llvm::TimeTraceScope timeTraceScope("Import Collector", fileName);
   Timer timer(&compilerOutput.times.importCollector);
   timer.start();
 
@@ -257,6 +265,7 @@ void SourceFile::runSymbolTableBuilder() {
   if (previousStage >= SYMBOL_TABLE_BUILDER)
     return;
 
+  llvm::TimeTraceScope timeTraceScope("Symbol Table Builder", fileName);
   Timer timer(&compilerOutput.times.symbolTableBuilder);
   timer.start();
 
@@ -286,6 +295,7 @@ void SourceFile::runTypeCheckerPre() { // NOLINT(misc-no-recursion)
   for (SourceFile *sourceFile : dependencies | std::views::values)
     sourceFile->runTypeCheckerPre();
 
+  llvm::TimeTraceScope timeTraceScope("Type Checker Pre", fileName);
   Timer timer(&compilerOutput.times.typeCheckerPre);
   timer.start();
 
@@ -313,6 +323,7 @@ void SourceFile::runTypeCheckerPost() { // NOLINT(misc-no-recursion)
 
   typeCheckerPostRunning = true;
 
+  llvm::TimeTraceScope timeTraceScope("Type Checker Post", fileName);
   Timer timer(&compilerOutput.times.typeCheckerPost);
   timer.start();
 
@@ -364,6 +375,24 @@ void SourceFile::runPostTypeCheckingVerifier() {
   verifier.verify(ast);
 }
 
+void SourceFile::runCompileTimeEvaluator() { // NOLINT(misc-no-recursion)
+  if (compileTimeEvaluated)
+    return;
+  compileTimeEvaluated = true;
+
+  // Evaluate the calls in all dependencies as well
+  for (SourceFile *sourceFile : dependencies | std::views::values)
+    sourceFile->runCompileTimeEvaluator();
+
+  // Files, that were restored from the cache, do not generate any IR
+  if (restoredFromCache)
+    return;
+
+  llvm::TimeTraceScope timeTraceScope("Compile-Time Evaluator", fileName);
+  CompileTimeEvaluator evaluator(resourceManager, this);
+  evaluator.evaluate(ast);
+}
+
 void SourceFile::runDependencyGraphVisualizer() {
   // Only execute if enabled
   if (restoredFromCache)
@@ -374,6 +403,7 @@ void SourceFile::runDependencyGraphVisualizer() {
   if (previousStage >= DEP_GRAPH_VISUALIZER)
     return;
 
+  llvm::TimeTraceScope timeTraceScope("Dependency Graph Visualizer", fileName);
   Timer timer(&compilerOutput.times.depGraphVisualizer);
   timer.start();
 
@@ -392,7 +422,7 @@ void SourceFile::runDependencyGraphVisualizer() {
 
   previousStage = DEP_GRAPH_VISUALIZER;
   timer.stop();
-  printStatusMessage("AST Visualizer", IO_AST, IO_AST, compilerOutput.times.depGraphVisualizer);
+  printStatusMessage("Dependency Graph Visualizer", IO_AST, IO_AST, compilerOutput.times.depGraphVisualizer);
 }
 
 void SourceFile::runIRGenerator() {
@@ -400,6 +430,7 @@ void SourceFile::runIRGenerator() {
   if (restoredFromCache || previousStage >= IR_GENERATOR)
     return;
 
+  llvm::TimeTraceScope timeTraceScope("IR Generator", fileName);
   Timer timer(&compilerOutput.times.irGenerator);
   timer.start();
 
@@ -431,6 +462,7 @@ void SourceFile::runDefaultIROptimizer() {
   if (restoredFromCache || previousStage > IR_OPTIMIZER || (previousStage == IR_OPTIMIZER && !cliOptions.testMode))
     return;
 
+  llvm::TimeTraceScope timeTraceScope("IR Optimizer", fileName);
   Timer timer(&compilerOutput.times.irOptimizer);
   timer.start();
 
@@ -460,6 +492,7 @@ void SourceFile::runPreLinkIROptimizer() {
   if (restoredFromCache || previousStage >= IR_OPTIMIZER)
     return;
 
+  llvm::TimeTraceScope timeTraceScope("IR Optimizer (pre-link)", fileName);
   Timer timer(&compilerOutput.times.irOptimizer);
   timer.start();
 
@@ -490,6 +523,7 @@ void SourceFile::runBitcodeLinker() {
   if (restoredFromCache || previousStage >= IR_OPTIMIZER)
     return;
 
+  llvm::TimeTraceScope timeTraceScope("Bitcode Linker", fileName);
   Timer timer(&compilerOutput.times.irOptimizer);
   timer.resume();
 
@@ -511,6 +545,7 @@ void SourceFile::runPostLinkIROptimizer() {
   if (restoredFromCache || previousStage >= IR_OPTIMIZER)
     return;
 
+  llvm::TimeTraceScope timeTraceScope("IR Optimizer (post-link)", fileName);
   Timer timer(&compilerOutput.times.irOptimizer);
   timer.resume();
 
@@ -543,12 +578,12 @@ void SourceFile::runObjectEmitter() {
   if (cliOptions.useLTO && !isMainFile)
     return;
 
+  llvm::TimeTraceScope timeTraceScope("Object Emitter", fileName);
   Timer timer(&compilerOutput.times.objectEmitter);
   timer.start();
 
   // Deduce an object file path
-  std::filesystem::path objectFilePath = cliOptions.outputDir / filePath.filename();
-  objectFilePath.replace_extension("o");
+  const std::filesystem::path objectFilePath = getObjectFilePath();
 
   // Pick a concrete emitter based on the selected backend. The TPDE emitter is compiled into a
   // sibling library (spice_tpde) that keeps its -fno-rtti requirement out of spicecore; the
@@ -626,6 +661,7 @@ void SourceFile::concludeCompilation() {
 }
 
 void SourceFile::runFrontEnd() { // NOLINT(misc-no-recursion)
+  llvm::TimeTraceScope timeTraceScope("Front End", fileName);
   runLexer();
   CHECK_ABORT_FLAG_V()
   runParser();
@@ -643,6 +679,8 @@ void SourceFile::runFrontEnd() { // NOLINT(misc-no-recursion)
 }
 
 void SourceFile::runMiddleEnd() {
+  llvm::TimeTraceScope timeTraceScope("Middle End", fileName);
+
   // Merge the exported name registries of all (transitive) dependencies into the respective importing files. This is
   // the deferred tail of the front-end: it must run after every reachable file has built its own registry, which is
   // why it cannot live inside the per-file front-end recursion (a circular import would otherwise merge a dependency
@@ -656,6 +694,9 @@ void SourceFile::runMiddleEnd() {
   // The second run to ensure, also generic scopes are type-checked properly
   runTypeCheckerPost(); // Visit the dependency tree from top to bottom in topological order
   CHECK_ABORT_FLAG_V()
+  // Evaluate calls to compile-time functions, now that all types are known
+  runCompileTimeEvaluator();
+  CHECK_ABORT_FLAG_V()
   // Visualize dependency graph
   runDependencyGraphVisualizer();
   CHECK_ABORT_FLAG_V()
@@ -667,6 +708,7 @@ void SourceFile::runBackEnd() { // NOLINT(misc-no-recursion)
   if (backEndStarted)
     return;
   backEndStarted = true;
+  llvm::TimeTraceScope timeTraceScope("Back End", fileName);
 
   // Run backend for all dependencies first
   for (SourceFile *sourceFile : dependencies | std::views::values)
@@ -693,6 +735,8 @@ void SourceFile::runBackEnd() { // NOLINT(misc-no-recursion)
     resourceManager.totalTimer.stop();
     if (cliOptions.printDebugOutput)
       dumpCompilationStats();
+    if (cliOptions.dump.dumpMemoryStats)
+      dumpOutput(resourceManager.memoryStatsCollector.dump(), "Memory Statistics", "memory-stats.out");
   }
 }
 
@@ -793,6 +837,25 @@ const SourceFile *SourceFile::getRootSourceFile() const { // NOLINT(misc-no-recu
   return isMainFile ? this : parent->getRootSourceFile();
 }
 
+std::filesystem::path SourceFile::getObjectFilePath() const {
+  std::filesystem::path objectFilePath = cliOptions.outputDir / filePath.filename();
+  objectFilePath.replace_extension("o");
+  return objectFilePath;
+}
+
+/**
+ * Get the path of the .dwo file, that holds the split debug info of this source file.
+ * With LTO, only the main source file emits an object file, so the debug info of all source files ends up in its .dwo file.
+ *
+ * @return Path to the .dwo file
+ */
+std::filesystem::path SourceFile::getSplitDwarfFilePath() const {
+  const SourceFile *emittingSourceFile = cliOptions.useLTO ? getRootSourceFile() : this;
+  std::filesystem::path dwoFilePath = emittingSourceFile->getObjectFilePath();
+  dwoFilePath.replace_extension("dwo");
+  return dwoFilePath;
+}
+
 bool SourceFile::isRT(RuntimeModule runtimeModule) const {
   assert(IDENTIFYING_TOP_LEVEL_NAMES.contains(runtimeModule));
   const char *topLevelName = IDENTIFYING_TOP_LEVEL_NAMES.at(runtimeModule);
@@ -912,7 +975,7 @@ void SourceFile::dumpCompilationStats() const {
   const size_t totalTypeCount = TypeRegistry::getTypeCount();
   const size_t allocatedBytes = resourceManager.astNodeAlloc.getTotalAllocatedSize();
   const size_t allocationCount = resourceManager.astNodeAlloc.getAllocationCount();
-  const size_t totalDuration = resourceManager.totalTimer.getDurationMilliseconds();
+  const uint64_t totalDuration = resourceManager.totalTimer.getDurationNanoseconds();
   std::cout << "\nSuccessfully compiled " << std::to_string(sourceFileCount) << " source file(s)";
   std::cout << " or " << std::to_string(totalLineCount) << " lines in total.\n";
   std::cout << "Total number of blocks allocated via BlockAllocator: " << CommonUtil::formatBytes(allocatedBytes);
@@ -921,7 +984,7 @@ void SourceFile::dumpCompilationStats() const {
   resourceManager.astNodeAlloc.printAllocatedClassStatistic();
 #endif
   std::cout << "Total number of types: " << std::to_string(totalTypeCount) << "\n";
-  std::cout << "Total compile time: " << std::to_string(totalDuration) << " ms\n";
+  std::cout << "Total compile time: " << CommonUtil::formatDuration(totalDuration) << "\n";
 }
 
 void SourceFile::dumpOutput(const std::string &content, const std::string &caption, const std::string &fileSuffix) const {
@@ -990,13 +1053,17 @@ void SourceFile::visualizerOutput(std::string outputName, const std::string &out
 
 void SourceFile::printStatusMessage(const char *stage, const CompileStageIOType &in, const CompileStageIOType &out,
                                     uint64_t stageRuntime, unsigned short stageRuns) const {
+  // Sample the memory usage between the stages
+  if (cliOptions.dump.dumpMemoryStats)
+    resourceManager.memoryStatsCollector.sampleAfterStage(stage, this);
+
   if (cliOptions.printDebugOutput) {
     static constexpr const char *const compilerStageIoTypeName[6] = {"Code", "Tokens", "CST", "AST", "IR", "Obj"};
     // Build output string
     std::stringstream outputStr;
     outputStr << "[" << stage << "] for " << fileName << ": ";
     outputStr << compilerStageIoTypeName[in] << " --> " << compilerStageIoTypeName[out];
-    outputStr << " (" << std::to_string(stageRuntime) << " ms";
+    outputStr << " (" << CommonUtil::formatDuration(stageRuntime);
     if (stageRuns > 0)
       outputStr << "; " << std::to_string(stageRuns) << " run(s)";
     outputStr << ")\n";
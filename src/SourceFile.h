@@ -70,7 +70,7 @@ struct SourceFileAntlrCtx {
   std::unique_ptr<SpiceParser> parser;
 };
 
-struct TimerOutput {
+struct TimerOutput { // Runtimes of the compile stages in nanoseconds
   uint64_t lexer = 0;
   uint64_t parser = 0;
   uint64_t cstVisualizer = 0;
@@ -135,6 +135,7 @@ private:
   void runTypeCheckerPre();
   void runTypeCheckerPost();
   void runPostTypeCheckingVerifier();
+  void runCompileTimeEvaluator();
 
 public:
   void runDependencyGraphVisualizer();
@@ -163,6 +164,8 @@ public:
   void checkForSoftErrors() const;
   void collectAndPrintWarnings();
   const SourceFile *getRootSourceFile() const;
+  [[nodiscard]] std::filesystem::path getObjectFilePath() const;
+  [[nodiscard]] std::filesystem::path getSplitDwarfFilePath() const;
   bool isRT(RuntimeModule runtimeModule) const;
   ALWAYS_INLINE bool isStringRT() const { return isRT(STRING_RT); }
   ALWAYS_INLINE bool isMemoryRT() const { return isRT(MEMORY_RT); }
@@ -197,6 +200,7 @@ public:
   std::vector<const SourceFile *> dependants;
   std::map<std::string, NameRegistryEntry> exportedNameRegistry;
   std::vector<const Function *> testFunctions;
+  std::vector<const Function *> benchFunctions;
 
 private:
   // Private fields
@@ -210,6 +214,7 @@ private:
   bool registriesMerged = false;
   bool typeCheckerPreRunning = false;
   bool typeCheckerPostRunning = false;
+  bool compileTimeEvaluated = false;
   bool backEndStarted = false;
   bool warningsCollected = false;
 
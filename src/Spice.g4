@@ -5,7 +5,7 @@ grammar Spice;
 // Top level definitions and declarations
 entry: (mainFunctionDef | functionDef | procedureDef | structDef | interfaceDef | enumDef | genericTypeDef | aliasDef | globalVarDef | importDef | extDecl | modAttr)* EOF;
 mainFunctionDef: topLevelDefAttr? F LESS TYPE_INT GREATER MAIN LPAREN paramLst? RPAREN stmtLst;
-functionDef: topLevelDefAttr? qualifierLst? F LESS dataType GREATER fctName (LESS typeLst GREATER)? LPAREN paramLst? RPAREN stmtLst;
+functionDef: topLevelDefAttr? qualifierLst? ASYNC? F LESS dataType GREATER fctName (LESS typeLst GREATER)? LPAREN paramLst? RPAREN stmtLst;
 procedureDef: topLevelDefAttr? qualifierLst? P fctName (LESS typeLst GREATER)? LPAREN paramLst? RPAREN stmtLst;
 fctName: (TYPE_IDENTIFIER DOT)? IDENTIFIER | OPERATOR overloadableOp;
 structDef: topLevelDefAttr? qualifierLst? TYPE TYPE_IDENTIFIER (LESS typeLst GREATER)? STRUCT (COLON typeLst)? LBRACE field* RBRACE;
@@ -53,7 +53,7 @@ modAttr: MOD_ATTR_PREAMBLE LBRACKET attrLst RBRACKET;
 topLevelDefAttr: TOPLEVEL_ATTR_PREAMBLE LBRACKET attrLst RBRACKET;
 lambdaAttr: LBRACKET LBRACKET attrLst RBRACKET RBRACKET;
 attrLst: attr (COMMA attr)*;
-attr: IDENTIFIER (DOT IDENTIFIER)* (ASSIGN constant)?;
+attr: (IDENTIFIER | ASYNC) (DOT IDENTIFIER)* (ASSIGN constant)?;
 returnStmt: RETURN assignExpr?;
 breakStmt: BREAK INT_LIT?;
 continueStmt: CONTINUE INT_LIT?;
@@ -74,7 +74,7 @@ shiftExpr: additiveExpr ((LESS LESS | GREATER GREATER) additiveExpr)*;
 additiveExpr: multiplicativeExpr ((PLUS | MINUS) multiplicativeExpr)*;
 multiplicativeExpr: castExpr ((MUL | DIV | REM) castExpr)*;
 castExpr: prefixUnaryExpr | CAST LESS dataType GREATER LPAREN assignExpr RPAREN;
-prefixUnaryExpr: postfixUnaryExpr | (MINUS | PLUS_PLUS | MINUS_MINUS | NOT | BITWISE_NOT | MUL | BITWISE_AND) prefixUnaryExpr;
+prefixUnaryExpr: postfixUnaryExpr | (MINUS | PLUS_PLUS | MINUS_MINUS | NOT | BITWISE_NOT | MUL | BITWISE_AND | AWAIT) prefixUnaryExpr;
 postfixUnaryExpr: atomicExpr | postfixUnaryExpr (LBRACKET assignExpr RBRACKET | DOT IDENTIFIER | PLUS_PLUS | MINUS_MINUS);
 atomicExpr: constant | value | (IDENTIFIER | TYPE_IDENTIFIER) (SCOPE_ACCESS (IDENTIFIER | TYPE_IDENTIFIER))* | LPAREN assignExpr RPAREN;
 
@@ -89,7 +89,7 @@ lambdaProc: P LPAREN paramLst? RPAREN lambdaAttr? stmtLst;
 lambdaExpr: LPAREN paramLst? RPAREN ARROW assignExpr;
 
 // Types
-dataType: qualifierLst? baseDataType (MUL | BITWISE_AND | LBRACKET (INT_LIT | TYPE_IDENTIFIER)? RBRACKET)*;
+dataType: qualifierLst? baseDataType (MUL | BITWISE_AND | LBRACKET (INT_LIT | TYPE_IDENTIFIER)? RBRACKET | LESS INT_LIT GREATER)*;
 baseDataType: TYPE_DOUBLE | TYPE_INT | TYPE_SHORT | TYPE_LONG | TYPE_BYTE | TYPE_CHAR | TYPE_STRING | TYPE_BOOL | TYPE_DYN | customDataType | functionDataType;
 customDataType: (IDENTIFIER SCOPE_ACCESS)* TYPE_IDENTIFIER (LESS typeLst GREATER)?;
 functionDataType: (F LESS dataType GREATER | P) LPAREN typeLst? RPAREN;
@@ -132,6 +132,8 @@ BREAK: 'break';
 CONTINUE: 'continue';
 FALLTHROUGH: 'fallthrough';
 RETURN: 'return';
+ASYNC: 'async';
+AWAIT: 'await';
 AS: 'as';
 STRUCT: 'struct';
 INTERFACE: 'interface';
@@ -80,6 +80,7 @@ std::any ASTBuilder::visitFunctionDef(SpiceParser::FunctionDefContext *ctx) {
   }
   if (ctx->qualifierLst())
     fctDefNode->qualifierLst = std::any_cast<QualifierLstNode *>(visit(ctx->qualifierLst()));
+  fctDefNode->isAsync = ctx->ASYNC() != nullptr;
   fctDefNode->returnType = std::any_cast<DataTypeNode *>(visit(ctx->dataType()));
   fctDefNode->returnType->isReturnType = true;
   fctDefNode->name = std::any_cast<FctNameNode *>(visit(ctx->fctName()));
@@ -763,8 +764,10 @@ std::any ASTBuilder::visitAttr(SpiceParser::AttrContext *ctx) {
 
   // Extract key
   std::stringstream key;
+  if (ctx->ASYNC()) // 'async' is a keyword, but still valid as attribute key
+    key << ctx->ASYNC()->getText();
   for (size_t i = 0; i < ctx->IDENTIFIER().size(); i++) {
-    if (i > 0)
+    if (i > 0 || ctx->ASYNC())
       key << MEMBER_ACCESS_TOKEN;
     key << ctx->IDENTIFIER(i)->getText();
   }
@@ -1150,6 +1153,8 @@ std::any ASTBuilder::visitPrefixUnaryExpr(SpiceParser::PrefixUnaryExprContext *c
       prefixUnaryExprNode->op = PrefixUnaryExprNode::PrefixUnaryOp::OP_DEREFERENCE;
     else if (ctx->BITWISE_AND())
       prefixUnaryExprNode->op = PrefixUnaryExprNode::PrefixUnaryOp::OP_ADDRESS_OF;
+    else if (ctx->AWAIT())
+      prefixUnaryExprNode->op = PrefixUnaryExprNode::PrefixUnaryOp::OP_AWAIT;
 
     prefixUnaryExprNode->prefixUnaryExpr = std::any_cast<ExprNode *>(visit(ctx->prefixUnaryExpr()));
   } else {
@@ -1452,6 +1457,13 @@ std::any ASTBuilder::visitDataType(SpiceParser::DataTypeContext *ctx) {
         i++; // Consume TYPE_IDENTIFIER
       }
       dataTypeNode->tmQueue.push({DataTypeNode::TypeModifierType::TYPE_ARRAY, hasSize, hardCodedSize, sizeVarName});
+    } else if (terminal->getSymbol()->getType() == SpiceParser::LESS) {
+      i++; // Consume LESS
+      terminal = dynamic_cast<TerminalNode *>(ctx->children.at(i));
+      assert(terminal->getSymbol()->getType() == SpiceParser::INT_LIT);
+      const unsigned int laneCount = std::stoi(terminal->getText());
+      i++; // Consume INT_LIT
+      dataTypeNode->tmQueue.push({DataTypeNode::TypeModifierType::TYPE_VECTOR, true, laneCount});
     }
   }
 
@@ -524,7 +524,7 @@ CompileTimeValue ValueNode::getCompileTimeValue(size_t manIdx) const {
 }
 
 bool FctCallNode::hasCompileTimeValue(size_t manIdx) const {
-  return BUILTIN_FUNCTIONS_MAP.contains(fqFunctionName) && data.at(manIdx).compileTimeValueSet;
+  return data.at(manIdx).compileTimeValueSet;
 }
 
 CompileTimeValue FctCallNode::getCompileTimeValue(size_t manIdx) const { return data.at(manIdx).compileTimeValue; }
@@ -21,6 +21,7 @@ namespace spice::compiler {
 
 // Forward declarations
 class TopLevelDefNode;
+class LambdaBaseNode;
 class Capture;
 using Arg = std::pair</*type=*/QualType, /*isTemporary=*/bool>;
 using ArgList = std::vector<Arg>;
@@ -371,6 +372,7 @@ public:
 
   // Public members
   DataTypeNode *returnType = nullptr;
+  bool isAsync = false;
 };
 
 // ========================================================== ProcDefNode ========================================================
@@ -1806,6 +1808,7 @@ public:
     OP_BITWISE_NOT,
     OP_DEREFERENCE,
     OP_ADDRESS_OF,
+    OP_AWAIT,
   };
 
   // Constructors
@@ -1982,6 +1985,9 @@ public:
     Scope *calleeParentScope = nullptr;
     CompileTimeValue compileTimeValue;
     bool compileTimeValueSet = false;
+    std::vector<CompileTimeValue> compileTimeArrayItems; // Flattened result of a compile-time function, returning an array
+    bool compileTimeArrayItemsSet = false;
+    const LambdaBaseNode *calleeLambda = nullptr; // Lambda literal, the called function pointer was initialized with
 
     // Methods
     [[nodiscard]] bool isOrdinaryCall() const { return callType == FctCallType::TYPE_ORDINARY; }
@@ -2154,6 +2160,7 @@ public:
     TYPE_PTR,
     TYPE_REF,
     TYPE_ARRAY,
+    TYPE_VECTOR,
   };
 
   // Structs
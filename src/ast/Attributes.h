@@ -25,8 +25,13 @@ static constexpr auto ATTR_CORE_COMPILER_WARNINGS_IGNORE = "core.compiler.warnin
 static constexpr auto ATTR_TEST = "test";
 static constexpr auto ATTR_TEST_NAME = "test.name";
 static constexpr auto ATTR_TEST_SKIP = "test.skip";
+static constexpr auto ATTR_BENCH = "bench";
+static constexpr auto ATTR_BENCH_NAME = "bench.name";
 static constexpr auto ATTR_ASYNC = "async";
 static constexpr auto ATTR_IGNORE_UNUSED_RETURN_VALUE = "ignoreUnusedReturnValue";
+static constexpr auto ATTR_COMPILE_TIME = "compileTime";
+static constexpr auto ATTR_VECTORIZE = "vectorize";
+static constexpr auto ATTR_VECTORIZE_WIDTH = "vectorize.width";
 
 static constexpr CompileTimeValue DEFAULT_BOOL_COMPILE_VALUE{.boolValue = true};
 
@@ -157,6 +162,20 @@ static const std::unordered_map<std::string, AttrConfigValue> ATTR_CONFIGS = {
             .type = AttrNode::AttrType::TYPE_BOOL,
         },
     },
+    {
+        ATTR_BENCH,
+        {
+            .target = AttrNode::AttrTarget::TARGET_FCT_PROC,
+            .type = AttrNode::AttrType::TYPE_BOOL,
+        },
+    },
+    {
+        ATTR_BENCH_NAME,
+        {
+            .target = AttrNode::AttrTarget::TARGET_FCT_PROC,
+            .type = AttrNode::AttrType::TYPE_STRING,
+        },
+    },
     {
         ATTR_ASYNC,
         {
@@ -171,6 +190,27 @@ static const std::unordered_map<std::string, AttrConfigValue> ATTR_CONFIGS = {
             .type = AttrNode::AttrType::TYPE_BOOL,
         },
     },
+    {
+        ATTR_COMPILE_TIME,
+        {
+            .target = AttrNode::AttrTarget::TARGET_FCT_PROC,
+            .type = AttrNode::AttrType::TYPE_BOOL,
+        },
+    },
+    {
+        ATTR_VECTORIZE,
+        {
+            .target = AttrNode::AttrTarget::TARGET_FCT_PROC | AttrNode::AttrTarget::TARGET_LAMBDA,
+            .type = AttrNode::AttrType::TYPE_BOOL,
+        },
+    },
+    {
+        ATTR_VECTORIZE_WIDTH,
+        {
+            .target = AttrNode::AttrTarget::TARGET_FCT_PROC | AttrNode::AttrTarget::TARGET_LAMBDA,
+            .type = AttrNode::AttrType::TYPE_INT,
+        },
+    },
 };
 
 } // namespace spice::compiler
\ No newline at end of file
@@ -26,6 +26,7 @@ Driver::Driver(CliOptions &foreignCliOptions, bool dryRun) : cliOptions(foreignC
   addBuildSubcommand();
   addRunSubcommand();
   addTestSubcommand();
+  addBenchSubcommand();
   addInstallSubcommand();
   addUninstallSubcommand();
 
@@ -117,16 +118,6 @@ void Driver::enrich() const {
   if (!performDryRun)
     cliOptions.mainSourceFile = relative(cliOptions.mainSourceFile);
 
-  // Propagate llvm args to llvm
-  if (!cliOptions.llvmArgs.empty()) {
-    const std::vector<std::string> result = CommonUtil::split("llvm " + cliOptions.llvmArgs);
-    std::vector<const char *> resultCStr;
-    resultCStr.reserve(result.size());
-    for (const std::string &str : result)
-      resultCStr.push_back(str.c_str());
-    llvm::cl::ParseCommandLineOptions(static_cast<int>(result.size()), resultCStr.data());
-  }
-
   // Propagate target information
   const llvm::Triple defaultTriple(llvm::Triple::normalize(llvm::sys::getDefaultTargetTriple()));
   if (cliOptions.targetTriple.empty()) {
@@ -168,6 +159,45 @@ void Driver::enrich() const {
   // Type sanitizer needs TBAA metadata to work properly
   if (sanitizer == Sanitizer::TYPE)
     cliOptions.useTBAAMetadata = true;
+  // Alias information is required to vectorize loops, that access memory through pointers, references or struct fields
+  if (cliOptions.optLevel >= OptLevel::O2) {
+    cliOptions.useTBAAMetadata = true;
+    cliOptions.useRefParamAttrs = true;
+  }
+  // Resolving interface method and lambda calls statically unlocks inlining of the called functions
+  if (cliOptions.optLevel >= OptLevel::O2) {
+    cliOptions.devirtualize = true;
+    cliOptions.directLambdaCalls = true;
+  }
+
+  // Reduced debug info modes imply debug info generation
+  CliOptions::InstrumentationSettings &instrumentation = cliOptions.instrumentation;
+  if (instrumentation.debugInfoLineTablesOnly || instrumentation.splitDwarf || instrumentation.debugTypeUnits)
+    instrumentation.generateDebugInfo = true;
+  // Split DWARF and DWARF type units rely on ELF sections
+  if (instrumentation.splitDwarf && !cliOptions.targetTriple.isOSBinFormatELF())
+    throw CliError(FEATURE_NOT_SUPPORTED_FOR_TARGET, "Split DWARF is only supported for ELF targets");
+  if (instrumentation.debugTypeUnits && !cliOptions.targetTriple.isOSBinFormatELF())
+    throw CliError(FEATURE_NOT_SUPPORTED_FOR_TARGET, "DWARF type units are only supported for ELF targets");
+
+  // Propagate llvm args to llvm. LLVM cl options are process-global, so their values outlive this compilation and apply to
+  // all following compilations in the same process (e.g. in the test runner), until they get parsed again
+  std::string llvmArgs = cliOptions.llvmArgs;
+  // LLVM only exposes DWARF type units as a cl option. Always pass an explicit value, so that a compilation without type
+  // units turns them off again, if an earlier compilation in this process has enabled them
+  if (llvmArgs.find("generate-type-units") == std::string::npos) {
+    const bool generateTypeUnits = instrumentation.debugTypeUnits && !instrumentation.debugInfoLineTablesOnly;
+    llvmArgs += llvmArgs.empty() ? "" : " ";
+    llvmArgs += generateTypeUnits ? "-generate-type-units=true" : "-generate-type-units=false";
+  }
+  const std::vector<std::string> result = CommonUtil::split("llvm " + llvmArgs);
+  std::vector<const char *> resultCStr;
+  resultCStr.reserve(result.size());
+  for (const std::string &str : result)
+    resultCStr.push_back(str.c_str());
+  // Options may only occur once per parse, so forget the occurrences of previous compilations in this process
+  llvm::cl::ResetAllOptionOccurrences();
+  llvm::cl::ParseCommandLineOptions(static_cast<int>(result.size()), resultCStr.data());
 
   // Infer build vars from other options
   const auto boolToString = [](bool input) { return input ? "true" : "false"; };
@@ -317,6 +347,27 @@ void Driver::addTestSubcommand() {
   subCmd->add_flag<bool>("--disable-verifier", cliOptions.disableVerifier, "Disable LLVM module and function verification");
 }
 
+/**
+ * Add bench subcommand to cli interface
+ */
+void Driver::addBenchSubcommand() {
+  // Create sub-command itself
+  CLI::App *subCmd = app.add_subcommand("bench", "Builds your Spice program and runs all enclosed benchmarks");
+  subCmd->allow_non_standard_option_names();
+  subCmd->callback([&] {
+    shouldCompile = shouldExecute = true;
+    cliOptions.buildMode = BuildMode::RELEASE;
+    cliOptions.generateBenchMain = true; // An alternative entry function is generated
+    cliOptions.noEntryFct = true;        // To not have two main functions, disable normal main
+    // Timing unoptimized code is rarely meaningful, so benchmarks are built with -O2, unless another level was selected
+    if (cliOptions.optLevel == OptLevel::O0)
+      cliOptions.optLevel = OptLevel::O2;
+  });
+
+  addCompileSubcommandOptions(subCmd);
+  addInstrumentationOptions(subCmd);
+}
+
 /**
  * Add install subcommand to cli interface
  */
@@ -405,7 +456,16 @@ void Driver::addCompileSubcommandOptions(CLI::App *subCmd) const {
                          "Generate lifetime markers to enhance optimizations");
   // --use-tbaa-metadata
   subCmd->add_flag<bool>("--use-tbaa-metadata", cliOptions.useTBAAMetadata,
-                         "Generate metadata for type-based alias analysis to enhance optimizations");
+                         "Generate alias analysis metadata to enhance optimizations (default for -O2 and higher)");
+  // --use-ref-param-attrs
+  subCmd->add_flag<bool>("--use-ref-param-attrs", cliOptions.useRefParamAttrs,
+                         "Mark reference params as non-null and dereferenceable (default for -O2 and higher)");
+  // --devirtualize
+  subCmd->add_flag<bool>("--devirtualize", cliOptions.devirtualize,
+                         "Call interface methods directly if the target is known (default for -O2 and higher)");
+  // --direct-lambda-calls
+  subCmd->add_flag<bool>("--direct-lambda-calls", cliOptions.directLambdaCalls,
+                         "Call lambdas directly if the target is known (default for -O2 and higher)");
 
   // Opt levels
   subCmd->add_flag_callback("-O0", [&] { cliOptions.optLevel = OptLevel::O0; }, "Disable optimization.");
@@ -442,6 +502,11 @@ void Driver::addCompileSubcommandOptions(CLI::App *subCmd) const {
 
   // --debug-output
   subCmd->add_flag<bool>("--debug-output,-d", cliOptions.printDebugOutput, "Enable debug output");
+  // --time-trace
+  subCmd->add_flag<bool>("--time-trace", cliOptions.timeTrace, "Write a Chrome trace of the compilation to the output directory");
+  // --time-trace-granularity
+  subCmd->add_option<unsigned int>("--time-trace-granularity", cliOptions.timeTraceGranularity,
+                                   "Minimum duration of a time trace span in microseconds (default: 50)");
   // --dump-cst
   subCmd->add_flag<bool>("--dump-cst,-cst", cliOptions.dump.dumpCST, "Dump CST as serialized string and SVG image");
   // --dump-ast
@@ -452,6 +517,8 @@ void Driver::addCompileSubcommandOptions(CLI::App *subCmd) const {
   subCmd->add_flag<bool>("--dump-types", cliOptions.dump.dumpTypes, "Dump all used types");
   // --dump-cache-stats
   subCmd->add_flag<bool>("--dump-cache-stats", cliOptions.dump.dumpCacheStats, "Dump stats for compiler-internal lookup caches");
+  // --dump-memory-stats
+  subCmd->add_flag<bool>("--dump-memory-stats", cliOptions.dump.dumpMemoryStats, "Dump memory usage per stage and subsystem");
   // --dump-ir
   subCmd->add_flag<bool>("--dump-ir,-ir", cliOptions.dump.dumpIR, "Dump LLVM-IR");
   // --dump-assembly
@@ -490,6 +557,15 @@ void Driver::addInstrumentationOptions(CLI::App *subCmd) const {
 
   // --debug-info
   subCmd->add_flag<bool>("--debug-info,-g", cliOptions.instrumentation.generateDebugInfo, "Generate debug info");
+  // -gline-tables-only
+  subCmd->add_flag<bool>("-gline-tables-only", cliOptions.instrumentation.debugInfoLineTablesOnly,
+                         "Generate debug info with line tables only");
+  // -gsplit-dwarf
+  subCmd->add_flag<bool>("-gsplit-dwarf", cliOptions.instrumentation.splitDwarf,
+                         "Emit debug info into separate .dwo files next to the object files");
+  // -fdebug-types-section
+  subCmd->add_flag<bool>("-fdebug-types-section", cliOptions.instrumentation.debugTypeUnits,
+                         "Emit struct debug types as DWARF type units to deduplicate them at link time");
   // --sanitizer
   subCmd->add_option("--sanitizer", sanitizerCallback, "Enable sanitizer: none (default), address, thread, memory, type");
 }
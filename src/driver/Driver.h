@@ -90,12 +90,15 @@ struct CliOptions {
   bool ignoreCache = false;
   std::string llvmArgs;
   bool printDebugOutput = false;
+  bool timeTrace = false;
+  unsigned int timeTraceGranularity = 50; // Minimum span duration in µs. Shorter spans only show up in the totals
   struct DumpSettings {
     bool dumpCST = false;
     bool dumpAST = false;
     bool dumpSymbolTable = false;
     bool dumpTypes = false;
     bool dumpCacheStats = false;
+    bool dumpMemoryStats = false;
     bool dumpDependencyGraph = false;
     bool dumpIR = false;
     bool dumpAssembly = false;
@@ -106,14 +109,21 @@ struct CliOptions {
   bool namesForIRValues = false;
   bool useLifetimeMarkers = false;
   bool useTBAAMetadata = false;
+  bool useRefParamAttrs = false;
+  bool devirtualize = false;
+  bool directLambdaCalls = false;
   OptLevel optLevel = OptLevel::O0; // The default optimization level for debug build mode is O0
   bool useLTO = false;
   Backend backend = Backend::LLVM;  // Codegen backend selection (TPDE is experimental, opt-in at build time)
   bool noEntryFct = false;
   bool generateTestMain = false;
+  bool generateBenchMain = false;
   bool staticLinking = false;
   struct InstrumentationSettings {
     bool generateDebugInfo = false;
+    bool debugInfoLineTablesOnly = false;
+    bool splitDwarf = false;
+    bool debugTypeUnits = false;
     Sanitizer sanitizer = Sanitizer::NONE;
   } instrumentation;
   bool disableVerifier = !SPICE_DEBUG;
@@ -152,6 +162,7 @@ private:
   void addBuildSubcommand();
   void addRunSubcommand();
   void addTestSubcommand();
+  void addBenchSubcommand();
   void addInstallSubcommand();
   void addUninstallSubcommand();
   void addCompileSubcommandOptions(CLI::App *subCmd) const;
@@ -158,6 +158,10 @@ std::string SemanticError::getMessagePrefix(SemanticErrorType errorType) {
     return "The type of a field value does not match the declaration";
   case ARRAY_SIZE_INVALID:
     return "Array size invalid";
+  case VECTOR_LANE_TYPE_INVALID:
+    return "Vector lane type invalid";
+  case VECTOR_LANE_COUNT_INVALID:
+    return "Vector lane count invalid";
   case FOREACH_IDX_NOT_LONG:
     return "Foreach index not of type long";
   case ARRAY_INDEX_NOT_INT_OR_LONG:
@@ -246,8 +250,18 @@ std::string SemanticError::getMessagePrefix(SemanticErrorType errorType) {
     return "Test function with parameters";
   case TEST_FUNCTION_WRONG_RETURN_TYPE:
     return "Test function with wrong return type";
+  case BENCH_FUNCTION_INVALID:
+    return "Invalid benchmark function";
   case LAMBDA_CAPTURE_ESCAPE:
     return "Lambda may outlive its captures";
+  case COMPILE_TIME_FCT_INVALID:
+    return "Invalid compile-time function";
+  case COMPILE_TIME_EVALUATION_FAILED:
+    return "Compile-time evaluation failed";
+  case ASYNC_FCT_INVALID:
+    return "Invalid async function";
+  case AWAIT_OUTSIDE_ASYNC_FCT:
+    return "Await outside of async function";
   }
   assert_fail("Unknown error"); // GCOV_EXCL_LINE
   return "Unknown error";       // GCOV_EXCL_LINE
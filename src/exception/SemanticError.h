@@ -78,6 +78,8 @@ enum SemanticErrorType : uint8_t {
   NUMBER_OF_FIELDS_NOT_MATCHING,
   FIELD_TYPE_NOT_MATCHING,
   ARRAY_SIZE_INVALID,
+  VECTOR_LANE_TYPE_INVALID,
+  VECTOR_LANE_COUNT_INVALID,
   FOREACH_IDX_NOT_LONG,
   ARRAY_INDEX_NOT_INT_OR_LONG,
   ARRAY_ITEM_TYPE_NOT_MATCHING,
@@ -122,7 +124,12 @@ enum SemanticErrorType : uint8_t {
   DIVISION_BY_ZERO,
   TEST_FUNCTION_WITH_PARAMS,
   TEST_FUNCTION_WRONG_RETURN_TYPE,
+  BENCH_FUNCTION_INVALID,
   LAMBDA_CAPTURE_ESCAPE,
+  COMPILE_TIME_FCT_INVALID,
+  COMPILE_TIME_EVALUATION_FAILED,
+  ASYNC_FCT_INVALID,
+  AWAIT_OUTSIDE_ASYNC_FCT,
 };
 
 /**
@@ -27,8 +27,15 @@ std::string CacheManager::computeCacheKey(const std::string &sourceCode, const s
   components << static_cast<uint8_t>(cliOptions.optLevel);
   components << static_cast<uint8_t>(cliOptions.instrumentation.sanitizer);
   components << cliOptions.instrumentation.generateDebugInfo;
+  components << cliOptions.instrumentation.debugInfoLineTablesOnly;
+  components << cliOptions.instrumentation.splitDwarf;
+  components << cliOptions.instrumentation.debugTypeUnits;
   components << cliOptions.targetTriple.str();
   components << cliOptions.useLTO;
+  components << cliOptions.useTBAAMetadata;
+  components << cliOptions.useRefParamAttrs;
+  components << cliOptions.devirtualize;
+  components << cliOptions.directLambdaCalls;
   // The output container influences codegen (PIC/PIE levels, DSO-local attributes for symbols,
   // etc.), so reusing an object emitted for a different container would produce wrong output.
   components << static_cast<uint8_t>(cliOptions.outputContainer);
@@ -62,6 +69,10 @@ bool CacheManager::lookupSourceFile(SourceFile *sourceFile) const {
     return false;
   }
 
+  // Restore the split debug info, that the object file references by path
+  if (cliOptions.instrumentation.splitDwarf && !restoreSplitDwarfFile(metadata))
+    return false;
+
   // Verify all transitive dependency object files exist and collect their paths. We keep
   // these even though Spice imports register themselves via their own concludeCompilation,
   // because runtime modules (string-rt, memory-rt, ...) are pulled in implicitly during
@@ -74,6 +85,8 @@ bool CacheManager::lookupSourceFile(SourceFile *sourceFile) const {
       const std::filesystem::path depObjectFilePath = cacheDir / (key + "." + objectFileExtension);
       if (!exists(depObjectFilePath))
         return false;
+      if (cliOptions.instrumentation.splitDwarf && !restoreSplitDwarfFile(key))
+        return false;
       sourceFile->cachedObjectFilePaths.push_back(depObjectFilePath);
     }
   }
@@ -97,9 +110,8 @@ void CacheManager::cacheSourceFile(const SourceFile *sourceFile) const {
   if (cliOptions.useLTO && !sourceFile->isMainFile)
     return;
 
-  // Determine the source object file path (mirrors runObjectEmitter's path logic)
-  std::filesystem::path sourceObjFilePath = cliOptions.outputDir / sourceFile->filePath.filename();
-  sourceObjFilePath.replace_extension("o");
+  // Determine the source object file path
+  const std::filesystem::path sourceObjFilePath = sourceFile->getObjectFilePath();
 
   // Determine cache paths
   const char *objectFileExtension = SystemUtil::getOutputFileExtension(cliOptions, OutputContainer::OBJECT_FILE);
@@ -121,6 +133,16 @@ void CacheManager::cacheSourceFile(const SourceFile *sourceFile) const {
   if (error)
     return;
 
+  // Copy the split debug info to the cache. The object file references it by its output path, so we remember that as well
+  const std::filesystem::path splitDwarfFilePath = sourceFile->getSplitDwarfFilePath();
+  if (cliOptions.instrumentation.splitDwarf) {
+    const std::filesystem::path cachedSplitDwarfFilePath = cacheDir / (sourceFile->cacheKey + ".dwo");
+    std::filesystem::copy_file(splitDwarfFilePath, cachedSplitDwarfFilePath, std::filesystem::copy_options::overwrite_existing,
+                               error);
+    if (error)
+      return;
+  }
+
   // Collect all transitive dependency cache keys, linker flags, and additional source paths.
   // We need the transitive list so that cache-restored files can replay the full linker input
   // even for implicit deps (e.g. runtime modules requested during symbol-table building, which
@@ -155,11 +177,44 @@ void CacheManager::cacheSourceFile(const SourceFile *sourceFile) const {
   metadata["dependencies"] = depCacheKeys;
   metadata["linkerFlags"] = allLinkerFlags;
   metadata["additionalSourcePaths"] = allAdditionalSourcePaths;
+  if (cliOptions.instrumentation.splitDwarf)
+    metadata["splitDwarfFile"] = splitDwarfFilePath.string();
   std::ofstream metadataStream(metadataFilePath);
   if (metadataStream)
     metadataStream << metadata.dump();
 }
 
+bool CacheManager::restoreSplitDwarfFile(const std::string &cacheKey) const {
+  std::ifstream metadataFile(cacheDir / (cacheKey + ".json"));
+  if (!metadataFile)
+    return false;
+  try {
+    return restoreSplitDwarfFile(nlohmann::json::parse(metadataFile));
+  } catch (nlohmann::detail::parse_error &) {
+    return false;
+  }
+}
+
+/**
+ * Copy the cached .dwo file of a cache entry back to the path, the skeleton compile units of the cached object file point to.
+ * Without this, a debugger would not find the split debug info of cache-restored object files.
+ *
+ * @param metadata Metadata of the cache entry
+ * @return Restored successfully or not
+ */
+bool CacheManager::restoreSplitDwarfFile(const nlohmann::json &metadata) const {
+  if (!metadata.contains("cacheKey") || !metadata.contains("splitDwarfFile"))
+    return false;
+  const std::filesystem::path cachedSplitDwarfFilePath = cacheDir / (metadata["cacheKey"].get<std::string>() + ".dwo");
+  const std::filesystem::path splitDwarfFilePath = metadata["splitDwarfFile"].get<std::string>();
+  std::error_code error;
+  if (!std::filesystem::exists(cachedSplitDwarfFilePath, error) || error)
+    return false;
+  std::filesystem::create_directories(splitDwarfFilePath.parent_path(), error);
+  std::filesystem::copy_file(cachedSplitDwarfFilePath, splitDwarfFilePath, std::filesystem::copy_options::overwrite_existing, error);
+  return !error;
+}
+
 // Hash the content of a single linker input that's not produced by the Spice cache itself
 // (e.g. C/C++ files referenced via @core.linker.additionalSource). Returns a sentinel that
 // folds the path in if the file can't be opened, so a vanished file still produces a stable
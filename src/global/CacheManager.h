@@ -6,6 +6,8 @@
 #include <string>
 #include <vector>
 
+#include <nlohmann/json.hpp>
+
 namespace spice::compiler {
 
 // Forward declarations
@@ -39,6 +41,10 @@ private:
   // Private members
   const CliOptions &cliOptions;
   const std::filesystem::path &cacheDir;
+
+  // Private methods
+  bool restoreSplitDwarfFile(const std::string &cacheKey) const;
+  bool restoreSplitDwarfFile(const nlohmann::json &metadata) const;
 };
 
 } // namespace spice::compiler
\ No newline at end of file
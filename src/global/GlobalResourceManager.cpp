@@ -2,8 +2,11 @@
 
 #include "GlobalResourceManager.h"
 
+#include <iostream>
+
 #include <SourceFile.h>
 #include <driver/Driver.h>
+#include <exception/CompilerError.h>
 #include <global/TypeNameDisambiguator.h>
 #include <global/TypeRegistry.h>
 #include <symboltablebuilder/Scope.h> // IWYU pragma: keep - Scope
@@ -15,13 +18,21 @@
 #include <llvm/IR/Module.h>
 #include <llvm/Support/ManagedStatic.h>
 #include <llvm/Support/TargetSelect.h>
+#include <llvm/Support/TimeProfiler.h>
 #include <llvm/TargetParser/Host.h>
 #include <llvm/TargetParser/SubtargetFeature.h>
 
 namespace spice::compiler {
 
 GlobalResourceManager::GlobalResourceManager(const CliOptions &cliOptions)
-    : cliOptions(cliOptions), linker(cliOptions), cacheManager(cliOptions), runtimeModuleManager(*this) {
+    : cliOptions(cliOptions), linker(cliOptions), cacheManager(cliOptions), runtimeModuleManager(*this),
+      memoryStatsCollector(*this) {
+  // Start recording the time trace. LLVM picks up the profiler for its own passes automatically.
+  // The profiler instance is thread-local. This is fine, because all compile stages run on the main thread. Threads, that
+  // should show up in the trace, have to call llvm::timeTraceProfilerInitialize and llvm::timeTraceProfilerFinishThread.
+  if (cliOptions.timeTrace)
+    llvm::timeTraceProfilerInitialize(cliOptions.timeTraceGranularity, "spice");
+
   // Initialize the required LLVM targets
   if (cliOptions.isNativeTarget) {
     llvm::InitializeNativeTarget();
@@ -60,6 +71,9 @@ GlobalResourceManager::~GlobalResourceManager() {
   FunctionManager::cleanup();
   StructManager::cleanup();
   InterfaceManager::cleanup();
+  // Stop recording the time trace
+  if (llvm::timeTraceProfilerEnabled())
+    llvm::timeTraceProfilerCleanup();
   // Cleanup all LLVM statics
   llvm::llvm_shutdown();
 }
@@ -83,4 +97,21 @@ size_t GlobalResourceManager::getTotalLineCount() const {
   return std::accumulate(sourceFiles.begin(), sourceFiles.end(), 0, acc);
 }
 
+/**
+ * Write the recorded time trace in the Chrome trace event format to the output directory.
+ * The trace can be inspected with chrome://tracing or https://ui.perfetto.dev.
+ */
+void GlobalResourceManager::writeTimeTrace() const {
+  assert(cliOptions.timeTrace && llvm::timeTraceProfilerEnabled());
+  const std::string fileName = cliOptions.mainSourceFile.stem().string() + TIME_TRACE_FILE_SUFFIX;
+  const std::string traceFilePath = (cliOptions.outputDir / fileName).string();
+  if (llvm::Error error = llvm::timeTraceProfilerWrite(traceFilePath, traceFilePath)) { // GCOV_EXCL_START
+    const std::string errorMessage = llvm::toString(std::move(error));
+    throw CompilerError(CANT_OPEN_OUTPUT_FILE, "Time trace could not be written: " + errorMessage);
+  } // GCOV_EXCL_STOP
+
+  if (cliOptions.printDebugOutput)
+    std::cout << "Time trace written to: " << traceFilePath << "\n";
+}
+
 } // namespace spice::compiler
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include <exception/ErrorManager.h>
 #include <global/CacheManager.h>
+#include <global/MemoryStatsCollector.h>
 #include <global/RuntimeModuleManager.h>
 #include <linker/ExternalLinkerInterface.h>
 #include <util/BlockAllocator.h>
@@ -20,6 +21,7 @@ class SourceFile;
 // Constants
 const char *const MAIN_FILE_NAME = "root";
 const char *const LTO_FILE_NAME = "lto-module";
+const char *const TIME_TRACE_FILE_SUFFIX = "-time-trace.json";
 
 /**
  * The GlobalResourceManager is instantiated at startup of the compiler and serves as distribution point for globally used assets.
@@ -40,6 +42,7 @@ public:
   SourceFile *createSourceFile(SourceFile *parent, const std::string &depName, const std::filesystem::path &path, bool isStdFile);
   uint64_t getNextCustomTypeId();
   size_t getTotalLineCount() const;
+  void writeTimeTrace() const;
 
   // Public members
   std::string cpuName;
@@ -55,6 +58,7 @@ public:
   ExternalLinkerInterface linker;
   CacheManager cacheManager;
   RuntimeModuleManager runtimeModuleManager;
+  MemoryStatsCollector memoryStatsCollector;
   Timer totalTimer;
   ErrorManager errorManager;
   bool abortCompilation = false;
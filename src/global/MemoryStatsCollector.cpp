@@ -0,0 +1,321 @@
+// Copyright (c) 2021-2026 ChilliBits. All rights reserved.
+
+#include "MemoryStatsCollector.h"
+
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <ranges>
+#include <sstream>
+#include <string_view>
+
+#include <SourceFile.h>
+#include <ast/ASTNodes.h>
+#include <driver/Driver.h>
+#include <global/GlobalResourceManager.h>
+#include <global/TypeRegistry.h>
+#include <symboltablebuilder/Scope.h>
+#include <symboltablebuilder/Type.h>
+#include <util/CommonUtil.h>
+#include <util/SystemUtil.h>
+
+#include <llvm/IR/Module.h>
+
+namespace spice::compiler {
+
+namespace {
+
+// Overhead of a node in a std::map (color, parent, left and right) and in a std::unordered_map (next pointer and hash)
+constexpr size_t MAP_NODE_OVERHEAD = 4 * sizeof(void *);
+constexpr size_t UNORDERED_MAP_NODE_OVERHEAD = 2 * sizeof(void *);
+constexpr size_t SHARED_PTR_CTRL_BLOCK_SIZE = 2 * sizeof(void *) + 2 * sizeof(int);
+
+// Strings, that fit into the small string buffer, do not occupy heap memory
+size_t getHeapSize(const std::string &str) {
+  static const size_t smallStringCapacity = std::string().capacity();
+  return str.capacity() > smallStringCapacity ? str.capacity() + 1 : 0;
+}
+
+template <typename T> size_t getHeapSize(const std::vector<T> &vector) { return vector.capacity() * sizeof(T); }
+
+template <typename Map> size_t getMapNodeSize(const std::string &key) {
+  return MAP_NODE_OVERHEAD + sizeof(typename Map::value_type) + getHeapSize(key);
+}
+
+size_t getHeapSize(const TypeMapping &typeMapping) {
+  size_t size = typeMapping.bucket_count() * sizeof(void *);
+  for (const std::string &typeName : typeMapping | std::views::keys)
+    size += UNORDERED_MAP_NODE_OVERHEAD + sizeof(TypeMapping::value_type) + getHeapSize(typeName);
+  return size;
+}
+
+std::string formatByteDelta(int64_t bytes) {
+  const std::string formatted = CommonUtil::formatBytes(static_cast<size_t>(bytes < 0 ? -bytes : bytes));
+  return (bytes < 0 ? "-" : "+") + formatted;
+}
+
+} // namespace
+
+size_t SourceFileMemoryStats::getTotal() const {
+  return antlr + ast + scopes + symbolTables + functions + structs + llvmIR + other;
+}
+
+MemoryStatsCollector::MemoryStatsCollector(const GlobalResourceManager &resourceManager) : resourceManager(resourceManager) {
+  if (!resourceManager.cliOptions.dump.dumpMemoryStats)
+    return;
+  lastRss = SystemUtil::getResidentSetSize();
+  peakRss = SystemUtil::getPeakResidentSetSize();
+  // Resetting the peak after each stage makes the peak specific to the stage
+  isPeakResettable = SystemUtil::resetPeakResidentSetSize();
+}
+
+/**
+ * Sample the resident set size after a compile stage has finished. The growth since the previous sample is attributed to
+ * the stage and to the source file. Stages of other source files, that ran in between, e.g. because of imports, got
+ * sampled on their own.
+ *
+ * @param stageName Name of the compile stage
+ * @param sourceFile Source file, that the stage ran for
+ */
+void MemoryStatsCollector::sampleAfterStage(const char *stageName, const SourceFile *sourceFile) {
+  const size_t rss = SystemUtil::getResidentSetSize();
+  const size_t stagePeakRss = SystemUtil::getPeakResidentSetSize();
+  const int64_t rssGrowth = static_cast<int64_t>(rss) - static_cast<int64_t>(lastRss);
+
+  auto it = std::ranges::find_if(stageSamples, [&](const StageMemorySample &sample) {
+    return std::string_view(sample.stageName) == stageName;
+  });
+  if (it == stageSamples.end())
+    it = stageSamples.insert(stageSamples.end(), StageMemorySample{stageName});
+  it->runs++;
+  it->rssGrowth += rssGrowth;
+  it->peakRss = std::max(it->peakRss, stagePeakRss);
+  rssGrowthPerFile[sourceFile] += rssGrowth;
+
+  peakRss = std::max(peakRss, stagePeakRss);
+  if (isPeakResettable)
+    SystemUtil::resetPeakResidentSetSize();
+  // Read the RSS again to exclude the memory for the bookkeeping above from the next stage
+  lastRss = SystemUtil::getResidentSetSize();
+}
+
+/**
+ * Estimate the memory usage of the data structures, that belong to the given source file, per subsystem
+ *
+ * @param sourceFile Source file
+ * @return Estimated memory usage per subsystem
+ */
+SourceFileMemoryStats MemoryStatsCollector::collectSourceFileStats(const SourceFile *sourceFile) const {
+  SourceFileMemoryStats stats;
+  stats.fileName = sourceFile->fileName;
+  if (const auto it = rssGrowthPerFile.find(sourceFile); it != rssGrowthPerFile.end())
+    stats.rssGrowth = it->second;
+
+  // ANTLR
+  const SourceFileAntlrCtx &antlrCtx = sourceFile->antlrCtx;
+  if (antlrCtx.inputStream) // The input stream holds the source code as UTF-32
+    stats.antlr += sizeof(antlr4::ANTLRInputStream) + antlrCtx.inputStream->size() * sizeof(char32_t);
+  if (antlrCtx.tokenStream) {
+    const size_t tokenSize = sizeof(antlr4::CommonToken) + sizeof(std::unique_ptr<antlr4::Token>);
+    stats.antlr += sizeof(antlr4::CommonTokenStream) + antlrCtx.tokenStream->size() * tokenSize;
+  }
+
+  // AST. All nodes come from the same block allocator, so the nodes of the file are counted and weighted by the average size
+  const BlockAllocator<ASTNode> &astNodeAlloc = resourceManager.astNodeAlloc;
+  if (sourceFile->ast && astNodeAlloc.getAllocationCount() > 0)
+    stats.ast = countASTNodes(sourceFile->ast) * astNodeAlloc.getUsedSize() / astNodeAlloc.getAllocationCount();
+
+  // Scopes, symbol tables, functions, structs and interfaces
+  if (sourceFile->globalScope) {
+    std::unordered_set<const Scope *> visited;
+    collectScopeStats(sourceFile->globalScope.get(), stats, visited);
+  }
+
+  // LLVM IR. With LTO, the module got linked into the LTO module
+  if (sourceFile->llvmModule)
+    stats.llvmIR = estimateLLVMModuleSize(*sourceFile->llvmModule);
+
+  // Other
+  const CompilerOutput &output = sourceFile->compilerOutput;
+  for (const std::string *str : {&output.cstString, &output.astString, &output.symbolTableString, &output.depGraphString,
+                                 &output.irString, &output.irOptString, &output.asmString, &output.typesString,
+                                 &output.cacheStats})
+    stats.other += getHeapSize(*str);
+  for (const auto &[name, entry] : sourceFile->exportedNameRegistry)
+    stats.other += getMapNodeSize<std::map<std::string, NameRegistryEntry>>(name) + getHeapSize(entry.name);
+
+  return stats;
+}
+
+/**
+ * Build the report with the per-stage samples and the per-subsystem estimates for all source files
+ *
+ * @return Memory statistics as string
+ */
+std::string MemoryStatsCollector::dump() const {
+  std::stringstream stats;
+  const size_t currentPeakRss = std::max(peakRss, SystemUtil::getPeakResidentSetSize());
+  stats << "Current RSS: " << CommonUtil::formatBytes(SystemUtil::getResidentSetSize()) << "\n";
+  stats << "Peak RSS: " << CommonUtil::formatBytes(currentPeakRss) << "\n\n";
+
+  // Per stage
+  stats << "Sampled RSS per stage" << (isPeakResettable ? ":" : " (peak RSS since compiler start):") << "\n";
+  stats << std::left << std::setw(30) << "  Stage" << std::right << std::setw(6) << "Runs" << std::setw(16) << "RSS growth";
+  stats << std::setw(16) << "Peak RSS" << "\n";
+  for (const StageMemorySample &sample : stageSamples) {
+    stats << "  " << std::left << std::setw(28) << sample.stageName << std::right << std::setw(6) << sample.runs;
+    stats << std::setw(16) << formatByteDelta(sample.rssGrowth) << std::setw(16) << CommonUtil::formatBytes(sample.peakRss);
+    stats << "\n";
+  }
+
+  // Per source file and subsystem, largest files first
+  std::vector<SourceFileMemoryStats> fileStats;
+  for (const std::unique_ptr<SourceFile> &sourceFile : resourceManager.sourceFiles | std::views::values)
+    fileStats.push_back(collectSourceFileStats(sourceFile.get()));
+  std::ranges::sort(fileStats, [](const auto &lhs, const auto &rhs) { return lhs.getTotal() > rhs.getTotal(); });
+  SourceFileMemoryStats totals;
+  totals.fileName = "Total";
+  for (const SourceFileMemoryStats &file : fileStats) {
+    totals.rssGrowth += file.rssGrowth;
+    totals.antlr += file.antlr;
+    totals.ast += file.ast;
+    totals.scopes += file.scopes;
+    totals.symbolTables += file.symbolTables;
+    totals.functions += file.functions;
+    totals.structs += file.structs;
+    totals.llvmIR += file.llvmIR;
+    totals.other += file.other;
+  }
+  fileStats.push_back(totals);
+
+  stats << "\nEstimated memory usage per source file:\n";
+  static constexpr std::array COLUMNS = {"RSS growth", "ANTLR", "AST", "Scopes", "Symbols", "Functions",
+                                         "Structs",    "LLVM IR", "Other", "Total"};
+  stats << std::left << std::setw(30) << "  Source file" << std::right;
+  for (const char *column : COLUMNS)
+    stats << std::setw(13) << column;
+  stats << "\n";
+  for (const SourceFileMemoryStats &file : fileStats) {
+    stats << "  " << std::left << std::setw(28) << file.fileName << std::right;
+    stats << std::setw(13) << formatByteDelta(file.rssGrowth);
+    for (const size_t bytes : {file.antlr, file.ast, file.scopes, file.symbolTables, file.functions, file.structs, file.llvmIR,
+                               file.other, file.getTotal()})
+      stats << std::setw(13) << CommonUtil::formatBytes(bytes);
+    stats << "\n";
+  }
+
+  // Global data structures
+  const BlockAllocator<ASTNode> &astNodeAlloc = resourceManager.astNodeAlloc;
+  stats << "\nEstimated memory usage of global data structures:\n";
+  stats << "  Type registry: " << CommonUtil::formatBytes(estimateTypeRegistrySize()) << " for ";
+  stats << TypeRegistry::getTypeCount() << " types\n";
+  stats << "  AST node allocator: " << CommonUtil::formatBytes(astNodeAlloc.getTotalAllocatedSize()) << " reserved, ";
+  stats << CommonUtil::formatBytes(astNodeAlloc.getUsedSize()) << " used by " << astNodeAlloc.getAllocationCount() << " nodes\n";
+  if (resourceManager.ltoModule)
+    stats << "  LTO module: " << CommonUtil::formatBytes(estimateLLVMModuleSize(*resourceManager.ltoModule)) << "\n";
+  return stats.str();
+}
+
+/**
+ * Estimate the memory usage of all types in the type registry
+ *
+ * @return Estimated size in bytes
+ */
+size_t MemoryStatsCollector::estimateTypeRegistrySize() {
+  const auto &types = TypeRegistry::types;
+  size_t size = types.bucket_count() * sizeof(void *);
+  for (const std::unique_ptr<Type> &type : types | std::views::values) {
+    size += UNORDERED_MAP_NODE_OVERHEAD + sizeof(std::pair<const uint64_t, std::unique_ptr<Type>>) + sizeof(Type);
+    size += getHeapSize(type->typeChain);
+    for (const TypeChainElement &element : type->typeChain)
+      size += getHeapSize(element.subType) + getHeapSize(element.templateTypes) + getHeapSize(element.paramTypes);
+  }
+  return size;
+}
+
+/**
+ * Estimate the memory usage of an LLVM module by counting its globals, functions, basic blocks, instructions and operands.
+ * Types, constants and metadata are owned by the LLVM context and therefore not included.
+ *
+ * @param module LLVM module
+ * @return Estimated size in bytes
+ */
+size_t MemoryStatsCollector::estimateLLVMModuleSize(const llvm::Module &module) {
+  size_t size = sizeof(llvm::Module);
+  for (const llvm::GlobalVariable &global : module.globals())
+    size += sizeof(llvm::GlobalVariable) + global.getNumOperands() * sizeof(llvm::Use);
+  for (const llvm::Function &function : module) {
+    size += sizeof(llvm::Function) + function.arg_size() * sizeof(llvm::Argument);
+    for (const llvm::BasicBlock &block : function) {
+      size += sizeof(llvm::BasicBlock);
+      for (const llvm::Instruction &instruction : block)
+        size += sizeof(llvm::Instruction) + instruction.getNumOperands() * sizeof(llvm::Use);
+    }
+  }
+  return size;
+}
+
+void MemoryStatsCollector::collectScopeStats(const Scope *scope, SourceFileMemoryStats &stats, // NOLINT(misc-no-recursion)
+                                             std::unordered_set<const Scope *> &visited) {
+  if (!visited.insert(scope).second)
+    return;
+
+  // Scope
+  stats.scopes += sizeof(Scope);
+  for (const std::string &scopeName : scope->children | std::views::keys)
+    stats.scopes += getMapNodeSize<decltype(scope->children)>(scopeName) + SHARED_PTR_CTRL_BLOCK_SIZE;
+  for (const std::string &typeName : scope->genericTypes | std::views::keys)
+    stats.scopes += getMapNodeSize<decltype(scope->genericTypes)>(typeName);
+
+  // Symbol table
+  for (const auto &[name, entry] : scope->symbolTable.symbols)
+    stats.symbolTables += getMapNodeSize<SymbolMap>(name) + getHeapSize(entry.name);
+  for (const std::string &name : scope->symbolTable.captures | std::views::keys)
+    stats.symbolTables += getMapNodeSize<CaptureMap>(name);
+
+  // Functions
+  for (const auto &[fctId, manifestations] : scope->functions) {
+    stats.functions += getMapNodeSize<FunctionRegistry>(fctId);
+    for (const auto &[mangledName, function] : manifestations)
+      stats.functions += getMapNodeSize<FunctionManifestationList>(mangledName) + estimateFunctionSize(function);
+  }
+
+  // Structs and interfaces
+  for (const auto &[structId, manifestations] : scope->structs) {
+    stats.structs += getMapNodeSize<StructRegistry>(structId);
+    for (const auto &[mangledName, spiceStruct] : manifestations) {
+      stats.structs += getMapNodeSize<StructManifestationList>(mangledName) + estimateStructBaseSize(spiceStruct);
+      stats.structs += getHeapSize(spiceStruct.fieldTypes) + getHeapSize(spiceStruct.interfaceTypes);
+    }
+  }
+  for (const InterfaceManifestationList &manifestations : scope->interfaces | std::views::values) {
+    stats.structs += MAP_NODE_OVERHEAD + sizeof(InterfaceRegistry::value_type);
+    for (const auto &[mangledName, spiceInterface] : manifestations) {
+      stats.structs += getMapNodeSize<InterfaceManifestationList>(mangledName) + estimateStructBaseSize(spiceInterface);
+      stats.structs += getHeapSize(spiceInterface.methods);
+    }
+  }
+
+  for (const std::shared_ptr<Scope> &child : scope->children | std::views::values)
+    collectScopeStats(child.get(), stats, visited);
+}
+
+size_t MemoryStatsCollector::estimateFunctionSize(const Function &function) {
+  size_t size = getHeapSize(function.name) + getHeapSize(function.predefinedMangledName) + getHeapSize(function.getMangleSuffix());
+  size += getHeapSize(function.paramList) + getHeapSize(function.templateTypes) + getHeapSize(function.typeMapping);
+  return size;
+}
+
+size_t MemoryStatsCollector::estimateStructBaseSize(const StructBase &structBase) {
+  return getHeapSize(structBase.name) + getHeapSize(structBase.templateTypes) + getHeapSize(structBase.typeMapping);
+}
+
+size_t MemoryStatsCollector::countASTNodes(const ASTNode *node) { // NOLINT(misc-no-recursion)
+  size_t count = 1;
+  for (const ASTNode *child : node->getChildren())
+    if (child != nullptr)
+      count += countASTNodes(child);
+  return count;
+}
+
+} // namespace spice::compiler
\ No newline at end of file
@@ -0,0 +1,86 @@
+// Copyright (c) 2021-2026 ChilliBits. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Forward declarations
+namespace llvm {
+class Module;
+} // namespace llvm
+
+namespace spice::compiler {
+
+// Forward declarations
+class GlobalResourceManager;
+class SourceFile;
+class Scope;
+class ASTNode;
+class Function;
+class StructBase;
+
+struct StageMemorySample {
+  const char *stageName;
+  unsigned int runs = 0;
+  int64_t rssGrowth = 0; // Summed up over all runs. Negative if memory was given back to the OS
+  size_t peakRss = 0;    // Only specific to the stage if the peak can be reset, otherwise the process peak so far
+};
+
+struct SourceFileMemoryStats { // Estimated bytes per subsystem
+  std::string fileName;
+  int64_t rssGrowth = 0; // Summed up over all stages of the source file
+  size_t antlr = 0;      // Input stream and token stream. The CST is freed after the AST builder
+  size_t ast = 0;
+  size_t scopes = 0;
+  size_t symbolTables = 0;
+  size_t functions = 0;
+  size_t structs = 0; // Structs and interfaces
+  size_t llvmIR = 0;
+  size_t other = 0; // Dump strings and name registry
+
+  [[nodiscard]] size_t getTotal() const;
+};
+
+/**
+ * Collects the memory usage of the compiler, if the memory stats are requested via --dump-memory-stats.
+ * The resident set size is sampled after each compile stage. Additionally, the memory usage of the compiler-internal data
+ * structures is estimated per source file and per subsystem by traversing the data structures. The estimates cover the
+ * objects and their heap buffers, but not the bookkeeping of the heap allocator.
+ */
+class MemoryStatsCollector {
+public:
+  // Constructors
+  explicit MemoryStatsCollector(const GlobalResourceManager &resourceManager);
+
+  // Prevent copy
+  MemoryStatsCollector(const MemoryStatsCollector &) = delete;
+  MemoryStatsCollector &operator=(const MemoryStatsCollector &) = delete;
+
+  // Public methods
+  void sampleAfterStage(const char *stageName, const SourceFile *sourceFile);
+  [[nodiscard]] SourceFileMemoryStats collectSourceFileStats(const SourceFile *sourceFile) const;
+  [[nodiscard]] std::string dump() const;
+  static size_t estimateTypeRegistrySize();
+  static size_t estimateLLVMModuleSize(const llvm::Module &module);
+
+private:
+  // Private members
+  const GlobalResourceManager &resourceManager;
+  std::vector<StageMemorySample> stageSamples; // In order of the first run of the stages
+  std::unordered_map<const SourceFile *, int64_t> rssGrowthPerFile;
+  size_t lastRss = 0;
+  size_t peakRss = 0;
+  bool isPeakResettable = false;
+
+  // Private methods
+  static void collectScopeStats(const Scope *scope, SourceFileMemoryStats &stats, std::unordered_set<const Scope *> &visited);
+  static size_t estimateFunctionSize(const Function &function);
+  static size_t estimateStructBaseSize(const StructBase &structBase);
+  static size_t countASTNodes(const ASTNode *node);
+};
+
+} // namespace spice::compiler
\ No newline at end of file
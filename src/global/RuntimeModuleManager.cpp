@@ -70,6 +70,10 @@ ModuleNamePair RuntimeModuleManager::resolveNamePair(RuntimeModule runtimeModule
     return {MEMORY_RT_IMPORT_NAME, "memory_rt"};
   case RTTI_RT:
     return {RTTI_RT_IMPORT_NAME, "rtti_rt"};
+  case ASYNC_RT:
+    return {ASYNC_RT_IMPORT_NAME, "async_rt"};
+  case BENCH_RT:
+    return {BENCH_RT_IMPORT_NAME, "bench_rt"};
   default:                                                                   // LCOV_EXCL_LINE
     throw CompilerError(INTERNAL_ERROR, "Requested unknown runtime module"); // LCOV_EXCL_LINE
   }
@@ -18,6 +18,14 @@ const char *const RESULT_RT_IMPORT_NAME = "__rt_result";
 const char *const ERROR_RT_IMPORT_NAME = "__rt_error";
 const char *const MEMORY_RT_IMPORT_NAME = "__rt_memory";
 const char *const RTTI_RT_IMPORT_NAME = "__rt_rtti";
+const char *const ASYNC_RT_IMPORT_NAME = "__rt_async";
+const char *const BENCH_RT_IMPORT_NAME = "__rt_bench";
+
+// Functions of the bench runtime, that are called by the generated bench main
+const char *const BENCH_BEGIN_FCT_NAME = "__spice_bench_begin";
+const char *const BENCH_START_FCT_NAME = "__spice_bench_start";
+const char *const BENCH_NEXT_BATCH_FCT_NAME = "__spice_bench_next_batch";
+const char *const BENCH_END_FCT_NAME = "__spice_bench_end";
 
 enum RuntimeModule : uint8_t {
   STRING_RT = 1 << 0,
@@ -25,12 +33,16 @@ enum RuntimeModule : uint8_t {
   ERROR_RT = 1 << 2,
   MEMORY_RT = 1 << 3,
   RTTI_RT = 1 << 4,
+  ASYNC_RT = 1 << 5,
+  BENCH_RT = 1 << 6,
 };
 
 const std::unordered_map<const char *, RuntimeModule> TYPE_NAME_TO_RT_MODULE_MAPPING = {
     {STROBJ_NAME, STRING_RT},
+    {STRVIEWOBJ_NAME, STRING_RT},
     {RESULTOBJ_NAME, RESULT_RT},
     {ERROBJ_NAME, ERROR_RT},
+    {FUTUREOBJ_NAME, ASYNC_RT},
 };
 
 const std::unordered_map<const char *, RuntimeModule> FCT_NAME_TO_RT_MODULE_MAPPING = {
@@ -47,6 +59,7 @@ const std::unordered_map<const char *, RuntimeModule> FCT_NAME_TO_RT_MODULE_MAPP
     {"sDelete", MEMORY_RT},
     {"sYieldOwnership", MEMORY_RT},
     {"sCompare", MEMORY_RT},
+    {"sAddressOf", MEMORY_RT},
     // Result RT
     {"ok", RESULT_RT},
     {"err", RESULT_RT},
@@ -54,11 +67,13 @@ const std::unordered_map<const char *, RuntimeModule> FCT_NAME_TO_RT_MODULE_MAPP
 
 // This serves for the compiler to detect if a source file is a specific runtime module
 const std::unordered_map<RuntimeModule, const char *> IDENTIFYING_TOP_LEVEL_NAMES = {
-    {STRING_RT, STROBJ_NAME},    // String struct
-    {RESULT_RT, RESULTOBJ_NAME}, // Result struct
-    {ERROR_RT, ERROBJ_NAME},     // Error struct
-    {MEMORY_RT, "sAlloc"},       // sAlloc function
-    {RTTI_RT, TIOBJ_NAME},       // TypeInfo struct
+    {STRING_RT, STROBJ_NAME},         // String struct
+    {RESULT_RT, RESULTOBJ_NAME},      // Result struct
+    {ERROR_RT, ERROBJ_NAME},          // Error struct
+    {MEMORY_RT, "sAlloc"},            // sAlloc function
+    {RTTI_RT, TIOBJ_NAME},            // TypeInfo struct
+    {ASYNC_RT, FUTUREOBJ_NAME},       // Future struct
+    {BENCH_RT, BENCH_BEGIN_FCT_NAME}, // __spice_bench_begin function
 };
 
 struct ModuleNamePair {
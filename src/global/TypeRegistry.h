@@ -16,6 +16,9 @@ public:
   TypeRegistry() = delete;
   TypeRegistry(const TypeRegistry &) = delete;
 
+  // Friend classes
+  friend class MemoryStatsCollector;
+
   // Public methods
   static uint64_t getTypeHash(const Type &type);
   static const Type *getOrInsert(SuperType superType);
@@ -19,19 +19,24 @@ DebugInfoGenerator::DebugInfoGenerator(IRGenerator *irGenerator) : irGenerator(i
 
 void DebugInfoGenerator::initialize(const std::string &sourceFileName, std::filesystem::path sourceFileDir) {
   llvm::Module *module = irGenerator->module;
-  llvm::LLVMContext &context = irGenerator->context;
 
   // Create DIBuilder
   diBuilder = std::make_unique<llvm::DIBuilder>(*module);
 
   // Create compilation unit
+  const CliOptions &cliOptions = irGenerator->cliOptions;
+  lineTablesOnly = cliOptions.instrumentation.debugInfoLineTablesOnly;
+  const auto emissionKind = lineTablesOnly ? llvm::DICompileUnit::LineTablesOnly : llvm::DICompileUnit::FullDebug;
+  std::string splitDebugFileName;
+  if (cliOptions.instrumentation.splitDwarf)
+    splitDebugFileName = irGenerator->sourceFile->getSplitDwarfFilePath().string();
   std::filesystem::path absolutePath = absolute(sourceFileDir / sourceFileName);
   absolutePath.make_preferred();
   sourceFileDir.make_preferred();
   llvm::DIFile *cuDiFile = diBuilder->createFile(absolutePath.string(), sourceFileDir.string());
-  compileUnit = diBuilder->createCompileUnit(
-      llvm::dwarf::DW_LANG_C_plus_plus_14, cuDiFile, PRODUCER_STRING, irGenerator->cliOptions.optLevel > OptLevel::O0, "", 0, "",
-      llvm::DICompileUnit::FullDebug, 0, false, false, llvm::DICompileUnit::DebugNameTableKind::None);
+  compileUnit = diBuilder->createCompileUnit(llvm::dwarf::DW_LANG_C_plus_plus_14, cuDiFile, PRODUCER_STRING,
+                                             cliOptions.optLevel > OptLevel::O0, "", 0, splitDebugFileName, emissionKind, 0,
+                                             false, false, llvm::DICompileUnit::DebugNameTableKind::None);
 
   module->addModuleFlag(llvm::Module::Max, "Dwarf Version", 5);
   module->addModuleFlag(llvm::Module::Warning, "Debug Info Version", llvm::DEBUG_METADATA_VERSION);
@@ -41,44 +46,7 @@ void DebugInfoGenerator::initialize(const std::string &sourceFileName, std::file
 
   pointerWidth = irGenerator->module->getDataLayout().getPointerSizeInBits();
 
-  // Initialize primitive debug types
-  doubleTy = diBuilder->createBasicType("double", 64, llvm::dwarf::DW_ATE_float);
-  intTy = diBuilder->createBasicType("int", 32, llvm::dwarf::DW_ATE_signed);
-  uIntTy = diBuilder->createBasicType("unsigned int", 32, llvm::dwarf::DW_ATE_unsigned);
-  shortTy = diBuilder->createBasicType("short", 16, llvm::dwarf::DW_ATE_signed);
-  uShortTy = diBuilder->createBasicType("unsigned short", 16, llvm::dwarf::DW_ATE_unsigned);
-  longTy = diBuilder->createBasicType("long", 64, llvm::dwarf::DW_ATE_signed);
-  uLongTy = diBuilder->createBasicType("unsigned long", 64, llvm::dwarf::DW_ATE_unsigned);
-  byteTy = diBuilder->createBasicType("byte", 8, llvm::dwarf::DW_ATE_unsigned);
-  charTy = diBuilder->createBasicType("char", 8, llvm::dwarf::DW_ATE_unsigned_char);
-  stringTy = diBuilder->createPointerType(charTy, pointerWidth);
-  boolTy = diBuilder->createBasicType("bool", 8, llvm::dwarf::DW_ATE_boolean);
-  voidTy = diBuilder->createBasicType("void", 0, llvm::dwarf::DW_ATE_unsigned);
-
-  // Initialize lambda fat ptr type
-  llvm::PointerType *ptrTy = irGenerator->builder.getPtrTy();
-  llvm::IntegerType *int64Ty = irGenerator->builder.getInt64Ty();
-  const llvm::DataLayout &dataLayout = module->getDataLayout();
-  const llvm::StructLayout *structLayout = dataLayout.getStructLayout(irGenerator->llvmTypes.lambdaFatPtrType);
-  const uint32_t alignInBits = dataLayout.getABITypeAlign(irGenerator->llvmTypes.lambdaFatPtrType).value();
-  const uint32_t ptrAlignInBits = dataLayout.getABITypeAlign(ptrTy).value();
-  const uint32_t int64Width = dataLayout.getTypeSizeInBits(int64Ty);
-  const uint32_t int64AlignInBits = dataLayout.getABITypeAlign(int64Ty).value();
-  const uint64_t fctPtrOffset = structLayout->getElementOffsetInBits(0);
-  const uint64_t capturesOffset = structLayout->getElementOffsetInBits(1);
-  const uint64_t captureSizeOffset = structLayout->getElementOffsetInBits(2);
-
-  llvm::DIType *voidPtrDIType = diBuilder->createPointerType(voidTy, pointerWidth, ptrAlignInBits);
-  fatPtrTy = diBuilder->createStructType(diFile, "_lambda", diFile, 0, structLayout->getSizeInBits(), alignInBits,
-                                         llvm::DINode::FlagTypePassByValue | llvm::DINode::FlagNonTrivial, nullptr, {}, 0,
-                                         nullptr, "_lambda");
-  const auto firstType = diBuilder->createMemberType(fatPtrTy, "fct", diFile, 0, pointerWidth, ptrAlignInBits, fctPtrOffset,
-                                                     llvm::DINode::FlagZero, voidPtrDIType);
-  const auto secondType = diBuilder->createMemberType(fatPtrTy, "captures", diFile, 0, pointerWidth, ptrAlignInBits,
-                                                      capturesOffset, llvm::DINode::FlagZero, voidPtrDIType);
-  const auto thirdType = diBuilder->createMemberType(fatPtrTy, "captureSize", diFile, 0, int64Width, int64AlignInBits,
-                                                     captureSizeOffset, llvm::DINode::FlagZero, uLongTy);
-  fatPtrTy->replaceElements(llvm::MDTuple::get(context, {firstType, secondType, thirdType}));
+  // Debug types are created lazily on first use, so that only types, referenced by emitted code, end up in the module
 }
 
 void DebugInfoGenerator::generateFunctionDebugInfo(llvm::Function *llvmFunction, const Function *spiceFunc, bool isLambda) {
@@ -105,30 +73,32 @@ void DebugInfoGenerator::generateFunctionDebugInfo(llvm::Function *llvmFunction,
       spFlags |= llvm::DISubprogram::SPFlagVirtual;
   }
 
-  // Collect arguments
+  // Collect arguments. Line tables do not need any type information
   std::vector<llvm::Metadata *> argTypes;
-  if (spiceFunc->isProcedure())
-    argTypes.push_back(voidTy);
-  else
-    argTypes.push_back(getDITypeForQualType(node, spiceFunc->returnType)); // Add result type
-  if (spiceFunc->isMethod())
-    argTypes.push_back(getDITypeForQualType(node, spiceFunc->thisType)); // Add this type
-  if (isLambda) {
-    llvm::DICompositeType *captureStructType = generateCaptureStructDebugInfo(spiceFunc);
-    scope = captureStructType;
-    llvm::DIType *captureStructPtr = diBuilder->createPointerType(captureStructType, pointerWidth);
-    argTypes.push_back(captureStructPtr); // Add this type
+  if (!lineTablesOnly) {
+    if (spiceFunc->isProcedure())
+      argTypes.push_back(getVoidType());
+    else
+      argTypes.push_back(getDITypeForQualType(node, spiceFunc->returnType)); // Add result type
+    if (spiceFunc->isMethod())
+      argTypes.push_back(getDITypeForQualType(node, spiceFunc->thisType)); // Add this type
+    if (isLambda) {
+      llvm::DICompositeType *captureStructType = generateCaptureStructDebugInfo(spiceFunc);
+      scope = captureStructType;
+      llvm::DIType *captureStructPtr = diBuilder->createPointerType(captureStructType, pointerWidth);
+      argTypes.push_back(captureStructPtr); // Add this type
+    }
+    for (const QualType &argType : spiceFunc->getParamTypes()) // Add arg types
+      argTypes.push_back(getDITypeForQualType(node, argType));
   }
-  for (const QualType &argType : spiceFunc->getParamTypes()) // Add arg types
-    argTypes.push_back(getDITypeForQualType(node, argType));
 
   // Create function type
   llvm::DISubroutineType *functionTy = diBuilder->createSubroutineType(diBuilder->getOrCreateTypeArray(argTypes));
 
-  const std::string mangledName = spiceFunc->getMangledName();
+  const std::string &mangledName = spiceFunc->getMangledName();
   llvm::DISubprogram *subprogram;
   const std::string &name = spiceFunc->name;
-  if (spiceFunc->isMethod()) {
+  if (spiceFunc->isMethod() && !lineTablesOnly) {
     subprogram = diBuilder->createMethod(scope, name, mangledName, diFile, lineNo, functionTy, 0, 0, nullptr, flags, spFlags);
   } else {
     subprogram = diBuilder->createFunction(scope, name, mangledName, diFile, lineNo, functionTy, lineNo, flags, spFlags);
@@ -150,7 +120,7 @@ void DebugInfoGenerator::concludeFunctionDebugInfo() {
 }
 
 void DebugInfoGenerator::pushLexicalBlock(const ASTNode *node) {
-  if (!irGenerator->cliOptions.instrumentation.generateDebugInfo)
+  if (!irGenerator->cliOptions.instrumentation.generateDebugInfo || lineTablesOnly)
     return;
 
   const uint32_t line = node->codeLoc.line;
@@ -160,7 +130,7 @@ void DebugInfoGenerator::pushLexicalBlock(const ASTNode *node) {
 }
 
 void DebugInfoGenerator::popLexicalBlock() {
-  if (!irGenerator->cliOptions.instrumentation.generateDebugInfo)
+  if (!irGenerator->cliOptions.instrumentation.generateDebugInfo || lineTablesOnly)
     return;
 
   assert(!lexicalBlocks.empty());
@@ -213,7 +183,7 @@ llvm::DICompositeType *DebugInfoGenerator::generateCaptureStructDebugInfo(const
 }
 
 void DebugInfoGenerator::generateGlobalVarDebugInfo(llvm::GlobalVariable *global, const SymbolTableEntry *globalEntry) {
-  if (!irGenerator->cliOptions.instrumentation.generateDebugInfo)
+  if (!irGenerator->cliOptions.instrumentation.generateDebugInfo || lineTablesOnly)
     return;
 
   const uint32_t lineNo = globalEntry->getDeclCodeLoc().line;
@@ -226,6 +196,9 @@ void DebugInfoGenerator::generateGlobalVarDebugInfo(llvm::GlobalVariable *global
 
 void DebugInfoGenerator::generateGlobalStringDebugInfo(llvm::GlobalVariable *global, const std::string &name, size_t length,
                                                        const CodeLoc &codeLoc) const {
+  if (lineTablesOnly)
+    return;
+
   const uint32_t lineNo = codeLoc.line;
   const size_t sizeInBits = (length + 1) * 8; // +1 because of null-terminator
 
@@ -234,7 +207,7 @@ void DebugInfoGenerator::generateGlobalStringDebugInfo(llvm::GlobalVariable *glo
 }
 
 void DebugInfoGenerator::generateLocalVarDebugInfo(const std::string &varName, llvm::Value *address, size_t argNumber) {
-  if (!irGenerator->cliOptions.instrumentation.generateDebugInfo)
+  if (!irGenerator->cliOptions.instrumentation.generateDebugInfo || lineTablesOnly)
     return;
 
   // Get symbol table entry
@@ -296,28 +269,37 @@ llvm::DIType *DebugInfoGenerator::getDITypeForQualType(const ASTNode *node, cons
   llvm::DIType *baseDiType;
   switch (ty.getSuperType()) {
   case TY_DOUBLE:
-    baseDiType = doubleTy;
+    baseDiType = getBasicType(doubleTy, "double", 64, llvm::dwarf::DW_ATE_float);
     break;
   case TY_INT:
-    baseDiType = ty.isSigned() ? intTy : uIntTy;
+    if (ty.isSigned())
+      baseDiType = getBasicType(intTy, "int", 32, llvm::dwarf::DW_ATE_signed);
+    else
+      baseDiType = getBasicType(uIntTy, "unsigned int", 32, llvm::dwarf::DW_ATE_unsigned);
     break;
   case TY_SHORT:
-    baseDiType = ty.isSigned() ? shortTy : uShortTy;
+    if (ty.isSigned())
+      baseDiType = getBasicType(shortTy, "short", 16, llvm::dwarf::DW_ATE_signed);
+    else
+      baseDiType = getBasicType(uShortTy, "unsigned short", 16, llvm::dwarf::DW_ATE_unsigned);
     break;
   case TY_LONG:
-    baseDiType = ty.isSigned() ? longTy : uLongTy;
+    if (ty.isSigned())
+      baseDiType = getBasicType(longTy, "long", 64, llvm::dwarf::DW_ATE_signed);
+    else
+      baseDiType = getBasicType(uLongTy, "unsigned long", 64, llvm::dwarf::DW_ATE_unsigned);
     break;
   case TY_BYTE:
-    baseDiType = byteTy;
+    baseDiType = getBasicType(byteTy, "byte", 8, llvm::dwarf::DW_ATE_unsigned);
     break;
   case TY_CHAR:
-    baseDiType = charTy;
+    baseDiType = getBasicType(charTy, "char", 8, llvm::dwarf::DW_ATE_unsigned_char);
     break;
   case TY_STRING:
-    baseDiType = stringTy;
+    baseDiType = getStringType();
     break;
   case TY_BOOL:
-    baseDiType = boolTy;
+    baseDiType = getBasicType(boolTy, "bool", 8, llvm::dwarf::DW_ATE_boolean);
     break;
   case TY_STRUCT: {
     // Do cache lookup
@@ -408,7 +390,7 @@ llvm::DIType *DebugInfoGenerator::getDITypeForQualType(const ASTNode *node, cons
   }
   case TY_FUNCTION: // fall-through
   case TY_PROCEDURE:
-    baseDiType = fatPtrTy;
+    baseDiType = getLambdaFatPtrType();
     break;
   default:
     throw CompilerError(UNHANDLED_BRANCH, "Debug Info Type fallthrough"); // GCOV_EXCL_LINE
@@ -420,4 +402,52 @@ llvm::DIType *DebugInfoGenerator::getDITypeForQualType(const ASTNode *node, cons
   return baseDiType;
 }
 
-} // namespace spice::compiler
\ No newline at end of file
+llvm::DIType *DebugInfoGenerator::getBasicType(llvm::DIType *&cacheEntry, const char *name, uint64_t sizeInBits,
+                                               unsigned int encoding) const {
+  if (cacheEntry == nullptr)
+    cacheEntry = diBuilder->createBasicType(name, sizeInBits, encoding);
+  return cacheEntry;
+}
+
+llvm::DIType *DebugInfoGenerator::getVoidType() { return getBasicType(voidTy, "void", 0, llvm::dwarf::DW_ATE_unsigned); }
+
+llvm::DIType *DebugInfoGenerator::getStringType() {
+  if (stringTy == nullptr) {
+    llvm::DIType *charDiType = getBasicType(charTy, "char", 8, llvm::dwarf::DW_ATE_unsigned_char);
+    stringTy = diBuilder->createPointerType(charDiType, pointerWidth);
+  }
+  return stringTy;
+}
+
+llvm::DICompositeType *DebugInfoGenerator::getLambdaFatPtrType() {
+  if (fatPtrTy != nullptr)
+    return fatPtrTy;
+
+  llvm::PointerType *ptrTy = irGenerator->builder.getPtrTy();
+  llvm::IntegerType *int64Ty = irGenerator->builder.getInt64Ty();
+  const llvm::DataLayout &dataLayout = irGenerator->module->getDataLayout();
+  const llvm::StructLayout *structLayout = dataLayout.getStructLayout(irGenerator->llvmTypes.lambdaFatPtrType);
+  const uint32_t alignInBits = dataLayout.getABITypeAlign(irGenerator->llvmTypes.lambdaFatPtrType).value();
+  const uint32_t ptrAlignInBits = dataLayout.getABITypeAlign(ptrTy).value();
+  const uint32_t int64Width = dataLayout.getTypeSizeInBits(int64Ty);
+  const uint32_t int64AlignInBits = dataLayout.getABITypeAlign(int64Ty).value();
+  const uint64_t fctPtrOffset = structLayout->getElementOffsetInBits(0);
+  const uint64_t capturesOffset = structLayout->getElementOffsetInBits(1);
+  const uint64_t captureSizeOffset = structLayout->getElementOffsetInBits(2);
+
+  llvm::DIType *voidPtrDIType = diBuilder->createPointerType(getVoidType(), pointerWidth, ptrAlignInBits);
+  llvm::DIType *uLongDIType = getBasicType(uLongTy, "unsigned long", 64, llvm::dwarf::DW_ATE_unsigned);
+  fatPtrTy = diBuilder->createStructType(diFile, "_lambda", diFile, 0, structLayout->getSizeInBits(), alignInBits,
+                                         llvm::DINode::FlagTypePassByValue | llvm::DINode::FlagNonTrivial, nullptr, {}, 0,
+                                         nullptr, "_lambda");
+  const auto firstType = diBuilder->createMemberType(fatPtrTy, "fct", diFile, 0, pointerWidth, ptrAlignInBits, fctPtrOffset,
+                                                     llvm::DINode::FlagZero, voidPtrDIType);
+  const auto secondType = diBuilder->createMemberType(fatPtrTy, "captures", diFile, 0, pointerWidth, ptrAlignInBits,
+                                                      capturesOffset, llvm::DINode::FlagZero, voidPtrDIType);
+  const auto thirdType = diBuilder->createMemberType(fatPtrTy, "captureSize", diFile, 0, int64Width, int64AlignInBits,
+                                                     captureSizeOffset, llvm::DINode::FlagZero, uLongDIType);
+  fatPtrTy->replaceElements(llvm::MDTuple::get(irGenerator->context, {firstType, secondType, thirdType}));
+  return fatPtrTy;
+}
+
+} // namespace spice::compiler
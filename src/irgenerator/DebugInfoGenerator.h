@@ -50,7 +50,8 @@ private:
   std::stack<llvm::DIScope *> lexicalBlocks;
   std::unordered_map<size_t, llvm::DICompositeType *> structTypeCache;
   unsigned int pointerWidth = 0;
-  // Debug types
+  bool lineTablesOnly = false;
+  // Debug types (created lazily)
   llvm::DIType *doubleTy = nullptr;
   llvm::DIType *intTy = nullptr;
   llvm::DIType *uIntTy = nullptr;
@@ -67,6 +68,11 @@ private:
 
   // Private methods
   [[nodiscard]] llvm::DIType *getDITypeForQualType(const ASTNode *node, const QualType &ty);
+  [[nodiscard]] llvm::DIType *getBasicType(llvm::DIType *&cacheEntry, const char *name, uint64_t sizeInBits,
+                                           unsigned int encoding) const;
+  [[nodiscard]] llvm::DIType *getVoidType();
+  [[nodiscard]] llvm::DIType *getStringType();
+  [[nodiscard]] llvm::DICompositeType *getLambdaFatPtrType();
 };
 
 } // namespace spice::compiler
\ No newline at end of file
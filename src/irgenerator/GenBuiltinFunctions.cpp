@@ -10,10 +10,31 @@
 #include <typechecker/TypeChecker.h>
 
 #include <llvm/IR/InlineAsm.h>
+#include <llvm/IR/Intrinsics.h>
 #include <llvm/IR/Module.h>
 
 namespace spice::compiler {
 
+static llvm::AtomicOrdering getAtomicOrdering(uint64_t memoryOrder) {
+  switch (static_cast<BuiltinMemoryOrder>(memoryOrder)) {
+  case BuiltinMemoryOrder::RELAXED:
+    return llvm::AtomicOrdering::Monotonic;
+  case BuiltinMemoryOrder::ACQUIRE:
+    return llvm::AtomicOrdering::Acquire;
+  case BuiltinMemoryOrder::RELEASE:
+    return llvm::AtomicOrdering::Release;
+  case BuiltinMemoryOrder::ACQ_REL:
+    return llvm::AtomicOrdering::AcquireRelease;
+  default:
+    return llvm::AtomicOrdering::SequentiallyConsistent;
+  }
+}
+
+// Atomic instructions need a type with a width of at least one byte, so bools are accessed as the byte they live in
+static llvm::Type *getAtomicAccessType(llvm::Type *valueType, llvm::IRBuilderBase &builder) {
+  return valueType->isIntegerTy(1) ? builder.getInt8Ty() : valueType;
+}
+
 std::any IRGenerator::visitBuiltinCall(const FctCallNode *node) {
   // If we have a compile time value, but the computation is still there, we can simply use this constant value
   if (node->hasCompileTimeValue(manIdx)) {
@@ -56,10 +77,17 @@ std::any IRGenerator::visitBuiltinPrintfCall(const FctCallNode *node) {
       llvm::Type *argType = argSymbolType.toLLVMType(sourceFile);
       argVal = insertInBoundsGEP(argType, argValPtr, indices);
     } else if (argSymbolType.getBase().isStringObj()) {
+      // Short strings keep their chars inside the struct, so ask the String for its chars instead of loading a field
       llvm::Value *argValPtr = resolveAddress(arg);
       llvm::Type *argBaseType = argSymbolType.getBase().toLLVMType(sourceFile);
-      argValPtr = insertStructGEP(argBaseType, argValPtr, 0);
-      argVal = insertLoad(builder.getPtrTy(), argValPtr);
+      llvm::Function *getRawFct = stdFunctionManager.getStringGetRawFct(argSymbolType.getBase());
+      llvm::CallInst *getRawCall = builder.CreateCall(getRawFct, argValPtr);
+      getRawCall->addRetAttr(llvm::Attribute::NoUndef);
+      getRawCall->addParamAttr(0, llvm::Attribute::NoUndef);
+      getRawCall->addParamAttr(0, llvm::Attribute::NonNull);
+      getRawCall->addDereferenceableParamAttr(0, module->getDataLayout().getTypeStoreSize(argBaseType));
+      getRawCall->addParamAttr(0, llvm::Attribute::getWithAlignment(context, module->getDataLayout().getABITypeAlign(argBaseType)));
+      argVal = getRawCall;
     } else {
       argVal = resolveValue(arg);
     }
@@ -254,4 +282,376 @@ std::any IRGenerator::visitBuiltinPlacementNewCall(const FctCallNode *node) {
   return LLVMExprResult{.value = targetPtr};
 }
 
+std::any IRGenerator::visitBuiltinPtrToIntCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_PTR_TO_INT);
+
+  llvm::Value *ptr = resolveValue(node->argLst->args.front());
+
+  return LLVMExprResult{.value = builder.CreatePtrToInt(ptr, builder.getInt64Ty())};
+}
+
+std::any IRGenerator::visitBuiltinAtomicLoadCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_LOAD);
+
+  const std::vector<ExprNode *> &args = node->argLst->args;
+  llvm::Value *ptr = resolveValue(args.at(0));
+  llvm::Type *valueType = node->getEvaluatedSymbolType(manIdx).toLLVMType(sourceFile);
+  llvm::Type *accessType = getAtomicAccessType(valueType, builder);
+
+  llvm::Value *result = generateAtomicOp(args.at(1), accessType, [&](llvm::AtomicOrdering ordering) {
+    // Loads can't carry release semantics, so weaken invalid orders that were only known at runtime
+    if (ordering == llvm::AtomicOrdering::Release)
+      ordering = llvm::AtomicOrdering::Monotonic;
+    else if (ordering == llvm::AtomicOrdering::AcquireRelease)
+      ordering = llvm::AtomicOrdering::Acquire;
+    llvm::LoadInst *load = insertLoad(accessType, ptr);
+    load->setAtomic(ordering);
+    return load;
+  });
+
+  if (accessType != valueType)
+    result = builder.CreateTrunc(result, valueType);
+  return LLVMExprResult{.value = result};
+}
+
+std::any IRGenerator::visitBuiltinAtomicStoreCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_STORE);
+
+  const std::vector<ExprNode *> &args = node->argLst->args;
+  llvm::Value *ptr = resolveValue(args.at(0));
+  llvm::Value *value = resolveValue(args.at(1));
+  llvm::Type *accessType = getAtomicAccessType(value->getType(), builder);
+  if (accessType != value->getType())
+    value = builder.CreateZExt(value, accessType);
+
+  generateAtomicOp(args.at(2), nullptr, [&](llvm::AtomicOrdering ordering) {
+    // Stores can't carry acquire semantics, so weaken invalid orders that were only known at runtime
+    if (ordering == llvm::AtomicOrdering::Acquire)
+      ordering = llvm::AtomicOrdering::Monotonic;
+    else if (ordering == llvm::AtomicOrdering::AcquireRelease)
+      ordering = llvm::AtomicOrdering::Release;
+    llvm::StoreInst *store = insertStore(value, ptr);
+    store->setAtomic(ordering);
+    return store;
+  });
+
+  return nullptr;
+}
+
+std::any IRGenerator::visitBuiltinAtomicRMWCall(const FctCallNode *node) {
+  // Map the builtin to the corresponding atomicrmw operation
+  llvm::AtomicRMWInst::BinOp binOp;
+  if (node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_EXCHANGE)
+    binOp = llvm::AtomicRMWInst::Xchg;
+  else if (node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_FETCH_ADD)
+    binOp = llvm::AtomicRMWInst::Add;
+  else if (node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_FETCH_SUB)
+    binOp = llvm::AtomicRMWInst::Sub;
+  else if (node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_FETCH_AND)
+    binOp = llvm::AtomicRMWInst::And;
+  else if (node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_FETCH_OR)
+    binOp = llvm::AtomicRMWInst::Or;
+  else {
+    assert(node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_FETCH_XOR);
+    binOp = llvm::AtomicRMWInst::Xor;
+  }
+
+  const std::vector<ExprNode *> &args = node->argLst->args;
+  llvm::Value *ptr = resolveValue(args.at(0));
+  llvm::Value *value = resolveValue(args.at(1));
+  llvm::Type *valueType = value->getType();
+  llvm::Type *accessType = getAtomicAccessType(valueType, builder);
+  if (accessType != valueType)
+    value = builder.CreateZExt(value, accessType);
+
+  llvm::Value *result = generateAtomicOp(args.at(2), accessType, [&](llvm::AtomicOrdering ordering) {
+    return builder.CreateAtomicRMW(binOp, ptr, value, llvm::MaybeAlign(), ordering);
+  });
+
+  if (accessType != valueType)
+    result = builder.CreateTrunc(result, valueType);
+  return LLVMExprResult{.value = result};
+}
+
+std::any IRGenerator::visitBuiltinAtomicCompareExchangeCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_COMPARE_EXCHANGE);
+
+  const std::vector<ExprNode *> &args = node->argLst->args;
+  llvm::Value *ptr = resolveValue(args.at(0));
+  llvm::Value *expectedPtr = resolveValue(args.at(1));
+  llvm::Value *desired = resolveValue(args.at(2));
+  const bool isWeak = args.at(3)->getCompileTimeValue(manIdx).boolValue;
+  llvm::Type *valueType = desired->getType();
+  llvm::Type *accessType = getAtomicAccessType(valueType, builder);
+  llvm::Value *expected = insertLoad(valueType, expectedPtr);
+  if (accessType != valueType) {
+    expected = builder.CreateZExt(expected, accessType);
+    desired = builder.CreateZExt(desired, accessType);
+  }
+  llvm::Type *resultType = llvm::StructType::get(context, {accessType, builder.getInt1Ty()});
+
+  llvm::Value *pair = generateAtomicOp(args.at(4), resultType, [&](llvm::AtomicOrdering successOrdering) {
+    // Derive the failure ordering from the success ordering, as the failure case performs no store
+    llvm::AtomicOrdering failureOrdering = successOrdering;
+    if (successOrdering == llvm::AtomicOrdering::AcquireRelease)
+      failureOrdering = llvm::AtomicOrdering::Acquire;
+    else if (successOrdering == llvm::AtomicOrdering::Release)
+      failureOrdering = llvm::AtomicOrdering::Monotonic;
+    llvm::AtomicCmpXchgInst *cmpXchg =
+        builder.CreateAtomicCmpXchg(ptr, expected, desired, llvm::MaybeAlign(), successOrdering, failureOrdering);
+    cmpXchg->setWeak(isWeak);
+    return cmpXchg;
+  });
+
+  // Write back the actual value on failure, so that retry loops can continue with it
+  llvm::Value *actual = builder.CreateExtractValue(pair, 0);
+  llvm::Value *success = builder.CreateExtractValue(pair, 1);
+  if (accessType != valueType)
+    actual = builder.CreateTrunc(actual, valueType);
+  insertStore(actual, expectedPtr);
+
+  return LLVMExprResult{.value = success};
+}
+
+std::any IRGenerator::visitBuiltinAtomicFenceCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_FENCE);
+
+  generateAtomicOp(node->argLst->args.front(), nullptr, [&](llvm::AtomicOrdering ordering) {
+    // A relaxed fence is a no-op, which LLVM does not allow to be expressed
+    if (ordering == llvm::AtomicOrdering::Monotonic)
+      return static_cast<llvm::Value *>(nullptr);
+    return static_cast<llvm::Value *>(builder.CreateFence(ordering));
+  });
+
+  return nullptr;
+}
+
+std::any IRGenerator::visitBuiltinSimdSplatCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_SPLAT);
+
+  const unsigned int laneCount = node->getEvaluatedSymbolType(manIdx).getVectorLaneCount();
+  llvm::Value *scalar = resolveValue(node->argLst->args.front());
+
+  return LLVMExprResult{.value = builder.CreateVectorSplat(laneCount, scalar)};
+}
+
+std::any IRGenerator::visitBuiltinSimdLoadCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_LOAD);
+
+  llvm::Type *vectorType = node->getEvaluatedSymbolType(manIdx).toLLVMType(sourceFile);
+  llvm::Value *ptr = resolveValue(node->argLst->args.front());
+
+  // The pointer is only guaranteed to be aligned for the lane type, not for the whole vector
+  llvm::LoadInst *load = insertLoad(vectorType, ptr);
+  load->setAlignment(module->getDataLayout().getABITypeAlign(vectorType->getScalarType()));
+
+  return LLVMExprResult{.value = load};
+}
+
+std::any IRGenerator::visitBuiltinSimdStoreCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_STORE);
+
+  const std::vector<ExprNode *> &args = node->argLst->args;
+  llvm::Value *ptr = resolveValue(args.at(0));
+  llvm::Value *vector = resolveValue(args.at(1));
+
+  // The pointer is only guaranteed to be aligned for the lane type, not for the whole vector
+  llvm::StoreInst *store = insertStore(vector, ptr);
+  store->setAlignment(module->getDataLayout().getABITypeAlign(vector->getType()->getScalarType()));
+
+  return nullptr;
+}
+
+std::any IRGenerator::visitBuiltinSimdSelectCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_SELECT);
+
+  const std::vector<ExprNode *> &args = node->argLst->args;
+  llvm::Value *mask = resolveValue(args.at(0));
+  llvm::Value *trueVector = resolveValue(args.at(1));
+  llvm::Value *falseVector = resolveValue(args.at(2));
+
+  return LLVMExprResult{.value = builder.CreateSelect(mask, trueVector, falseVector)};
+}
+
+std::any IRGenerator::visitBuiltinSimdShuffleCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_SHUFFLE);
+
+  const std::vector<ExprNode *> &args = node->argLst->args;
+  llvm::Value *lhs = resolveValue(args.at(0));
+  llvm::Value *rhs = resolveValue(args.at(1));
+
+  // The type checker ensured, that all lane indices are known at compile time
+  std::vector<int> shuffleMask;
+  shuffleMask.reserve(args.size() - 2);
+  for (size_t i = 2; i < args.size(); i++)
+    shuffleMask.push_back(args.at(i)->getCompileTimeValue(manIdx).intValue);
+
+  return LLVMExprResult{.value = builder.CreateShuffleVector(lhs, rhs, shuffleMask)};
+}
+
+std::any IRGenerator::visitBuiltinSimdReduceCall(const FctCallNode *node) {
+  const ExprNode *vectorNode = node->argLst->args.front();
+  const QualType laneSTy = vectorNode->getEvaluatedSymbolType(manIdx).removeReferenceWrapper().getContained();
+  const bool isFP = laneSTy.is(TY_DOUBLE);
+  llvm::Value *vector = resolveValue(vectorNode);
+
+  // Map the builtin to the corresponding vector reduction intrinsic
+  llvm::Value *result;
+  if (node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_REDUCE_ADD) {
+    if (isFP) {
+      // Allow reassociation, so that the lanes can be added up pairwise instead of strictly in order
+      llvm::Value *start = llvm::ConstantFP::getNegativeZero(vector->getType()->getScalarType());
+      llvm::CallInst *reduction = builder.CreateFAddReduce(start, vector);
+      llvm::FastMathFlags fastMathFlags;
+      fastMathFlags.setAllowReassoc();
+      reduction->setFastMathFlags(fastMathFlags);
+      result = reduction;
+    } else {
+      result = builder.CreateAddReduce(vector);
+    }
+  } else if (node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_REDUCE_MIN) {
+    result = isFP ? builder.CreateFPMinReduce(vector) : builder.CreateIntMinReduce(vector, laneSTy.isSigned());
+  } else if (node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_REDUCE_MAX) {
+    result = isFP ? builder.CreateFPMaxReduce(vector) : builder.CreateIntMaxReduce(vector, laneSTy.isSigned());
+  } else if (node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_REDUCE_AND) {
+    result = builder.CreateAndReduce(vector);
+  } else {
+    assert(node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_REDUCE_OR);
+    result = builder.CreateOrReduce(vector);
+  }
+
+  return LLVMExprResult{.value = result};
+}
+
+std::any IRGenerator::visitBuiltinCoroSuspendCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_CORO_SUSPEND);
+  assert(isInCoroutine());
+
+  // Hand out the handle before suspending, so that whoever owns the slot can resume the coroutine later on
+  llvm::Value *slot = resolveValue(node->argLst->args.front());
+  llvm::Value *saveToken = builder.CreateIntrinsic(llvm::Intrinsic::coro_save, {}, {coroutine.handle});
+  insertStore(coroutine.handle, slot);
+
+  llvm::BasicBlock *bResume = createBlock("coro.resume");
+  generateCoroSuspend(saveToken, bResume, node);
+  switchToBlock(bResume);
+
+  return nullptr;
+}
+
+std::any IRGenerator::visitBuiltinCoroResumeCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_CORO_RESUME);
+
+  generateCoroResume(resolveValue(node->argLst->args.front()));
+
+  return nullptr;
+}
+
+std::any IRGenerator::visitBuiltinCoroDestroyCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_CORO_DESTROY);
+
+  llvm::Value *frame = resolveValue(node->argLst->args.front());
+  builder.CreateIntrinsic(llvm::Intrinsic::coro_destroy, {}, {frame});
+
+  return nullptr;
+}
+
+std::any IRGenerator::visitBuiltinCoroDoneCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_CORO_DONE);
+
+  llvm::Value *stateAddr = getCoroStateAddr(node);
+  llvm::LoadInst *state = insertLoad(builder.getPtrTy(), stateAddr);
+  state->setAtomic(llvm::AtomicOrdering::Acquire);
+  state->setAlignment(llvm::Align(8));
+  llvm::Constant *doneMarker = llvm::ConstantExpr::getIntToPtr(builder.getInt64(CORO_STATE_DONE), builder.getPtrTy());
+
+  return LLVMExprResult{.value = builder.CreateICmpEQ(state, doneMarker)};
+}
+
+std::any IRGenerator::visitBuiltinCoroDetachCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_CORO_DETACH);
+
+  // Mark the coroutine as detached. If it has completed already, nobody else is going to free it
+  llvm::PointerType *ptrTy = builder.getPtrTy();
+  llvm::Value *frame = resolveValue(node->argLst->args.front());
+  llvm::Value *stateAddr = getCoroStateAddr(node, frame);
+  llvm::Constant *detachedMarker = llvm::ConstantExpr::getIntToPtr(builder.getInt64(CORO_STATE_DETACHED), ptrTy);
+  llvm::AtomicCmpXchgInst *cmpXchg = builder.CreateAtomicCmpXchg(
+      stateAddr, llvm::ConstantPointerNull::get(ptrTy), detachedMarker, llvm::MaybeAlign(8),
+      llvm::AtomicOrdering::AcquireRelease, llvm::AtomicOrdering::Acquire);
+  llvm::Value *detached = builder.CreateExtractValue(cmpXchg, 1);
+
+  llvm::BasicBlock *bDestroy = createBlock("coro.detach.destroy");
+  llvm::BasicBlock *bExit = createBlock("coro.detach.exit");
+  insertCondJump(detached, bExit, bDestroy, Likelihood::LIKELY);
+  switchToBlock(bDestroy);
+  builder.CreateIntrinsic(llvm::Intrinsic::coro_destroy, {}, {frame});
+  insertJump(bExit);
+  switchToBlock(bExit);
+
+  return nullptr;
+}
+
+std::any IRGenerator::visitBuiltinCoroResultCall(const FctCallNode *node) {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_CORO_RESULT);
+
+  const QualType resultSTy = node->templateTypeLst->dataTypes.front()->getEvaluatedSymbolType(manIdx);
+  llvm::StructType *promiseType = getCoroPromiseType(resultSTy);
+  llvm::Value *frame = resolveValue(node->argLst->args.front());
+  llvm::Value *promise = getCoroPromise(frame, promiseType);
+
+  return LLVMExprResult{.value = builder.CreateStructGEP(promiseType, promise, 1, "result.addr")};
+}
+
+/**
+ * Generate an atomic operation with the memory order, given by the order node.
+ * If the order is known at compile time, the operation is emitted once with the matching LLVM atomic ordering. Otherwise,
+ * a switch over the runtime value is emitted with one variant of the operation per memory order.
+ *
+ * @param orderNode Memory order argument of the builtin call
+ * @param resultType Type of the operation result or nullptr to not merge the results of the variants
+ * @param generateOp Callback, that emits the operation for a given atomic ordering
+ * @return Result of the atomic operation
+ */
+llvm::Value *IRGenerator::generateAtomicOp(const ExprNode *orderNode, llvm::Type *resultType,
+                                           const std::function<llvm::Value *(llvm::AtomicOrdering)> &generateOp) {
+  llvm::Value *orderValue = resolveValue(orderNode);
+
+  // Fast path: the memory order is known at compile time
+  if (const auto *constantOrder = llvm::dyn_cast<llvm::ConstantInt>(orderValue))
+    return generateOp(getAtomicOrdering(constantOrder->getZExtValue()));
+
+  // Slow path: the memory order is only known at runtime, so we branch to the matching variant
+  static constexpr std::array MEMORY_ORDERS = {BuiltinMemoryOrder::RELAXED, BuiltinMemoryOrder::ACQUIRE,
+                                               BuiltinMemoryOrder::RELEASE, BuiltinMemoryOrder::ACQ_REL};
+  const std::string codeLine = orderNode->codeLoc.toPrettyLine();
+  llvm::BasicBlock *bSeqCst = createBlock("atomic.seqcst." + codeLine);
+  llvm::BasicBlock *bExit = createBlock("atomic.exit." + codeLine);
+  llvm::SwitchInst *switchInst = builder.CreateSwitch(orderValue, bSeqCst, MEMORY_ORDERS.size());
+
+  std::vector<std::pair<llvm::Value *, llvm::BasicBlock *>> results;
+  const auto generateVariant = [&](llvm::BasicBlock *block, BuiltinMemoryOrder memoryOrder) {
+    switchToBlock(block);
+    llvm::Value *result = generateOp(getAtomicOrdering(static_cast<uint64_t>(memoryOrder)));
+    results.emplace_back(result, builder.GetInsertBlock());
+    insertJump(bExit);
+  };
+  for (const BuiltinMemoryOrder memoryOrder : MEMORY_ORDERS) {
+    llvm::BasicBlock *bCase = createBlock("atomic.order." + codeLine);
+    auto *orderType = llvm::cast<llvm::IntegerType>(orderValue->getType());
+    switchInst->addCase(llvm::ConstantInt::get(orderType, static_cast<uint64_t>(memoryOrder)), bCase);
+    generateVariant(bCase, memoryOrder);
+  }
+  generateVariant(bSeqCst, BuiltinMemoryOrder::SEQ_CST);
+  switchToBlock(bExit);
+
+  // Merge the results of all variants
+  if (resultType == nullptr)
+    return nullptr;
+  llvm::PHINode *phi = builder.CreatePHI(resultType, results.size());
+  for (const auto &[value, block] : results)
+    phi->addIncoming(value, block);
+  return phi;
+}
+
 } // namespace spice::compiler
\ No newline at end of file
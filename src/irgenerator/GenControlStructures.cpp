@@ -3,6 +3,7 @@
 #include "IRGenerator.h"
 
 #include <ast/ASTNodes.h>
+#include <driver/Driver.h>
 #include <symboltablebuilder/ScopeHandle.h>
 
 namespace spice::compiler {
@@ -56,7 +57,7 @@ std::any IRGenerator::visitForLoop(const ForLoopNode *node) {
   // Inc statement
   visit(node->incAssign);
   // Create jump from tail to head
-  insertJump(bHead);
+  mdGenerator.generateLoopMetadata(insertJump(bHead), node);
 
   // Switch to exit block
   switchToBlock(bExit);
@@ -85,24 +86,30 @@ std::any IRGenerator::visitForeachLoop(const ForeachLoopNode *node) {
   breakBlocks.push_back(bExit);
   continueBlocks.push_back(bTail);
 
-  // Resolve iterator
+  // When optimizing for speed, force inlining of the iterator methods, so that the iterator can live in registers
+  const bool inlineIteratorCalls = cliOptions.optLevel > OptLevel::O0 && cliOptions.optLevel <= OptLevel::O3;
+  const auto createIteratorCall = [&](llvm::Function *fct, llvm::ArrayRef<llvm::Value *> args) {
+    llvm::CallInst *call = builder.CreateCall(fct, args);
+    if (inlineIteratorCalls)
+      call->addFnAttr(llvm::Attribute::AlwaysInline);
+    return call;
+  };
+
+  // Resolve iterator. Arrays get lowered to a counted loop, that does not need an iterator at all
   ExprNode *iteratorAssignNode = node->iteratorAssign;
-  llvm::Value *iteratorPtr;
-  if (node->getIteratorFct != nullptr) { // The iteratorAssignExpr is of type Iterable
+  const QualType iterableType = iteratorAssignNode->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  const bool isArrayLoop = node->getIteratorFct != nullptr && iterableType.isArray();
+  llvm::Value *iteratorPtr = nullptr;
+  llvm::Value *arrayPtr = nullptr;
+  llvm::Value *counterPtr = nullptr;
+  if (isArrayLoop) {
+    arrayPtr = resolveAddress(iteratorAssignNode);
+    counterPtr = insertAlloca(builder.getInt64Ty(), "foreach.idx");
+  } else if (node->getIteratorFct != nullptr) { // The iteratorAssignExpr is of type Iterable
+    // Call .getIterator() on iterable
     llvm::Value *iterablePtr = resolveAddress(iteratorAssignNode);
-
-    llvm::Value *iterator;
-    if (!node->getIteratorFct->isMethod() && node->getIteratorFct->getParamTypes().front().isArray()) { // Array as iterable
-      // Call iterate() function from std/iterator/array-iterator
-      llvm::Function *iterateFct = stdFunctionManager.getIterateFct(node->getIteratorFct);
-      const size_t arraySize = iteratorAssignNode->getEvaluatedSymbolType(manIdx).getArraySize();
-      assert(arraySize > 0);
-      iterator = builder.CreateCall(iterateFct, {iterablePtr, builder.getInt64(arraySize)});
-    } else { // Struct as iterable
-      // Call .getIterator() on iterable
-      llvm::Function *getIteratorFct = stdFunctionManager.getIteratorFct(node->getIteratorFct);
-      iterator = builder.CreateCall(getIteratorFct, iterablePtr);
-    }
+    llvm::Function *getIteratorFct = stdFunctionManager.getIteratorFct(node->getIteratorFct);
+    llvm::Value *iterator = createIteratorCall(getIteratorFct, iterablePtr);
 
     // Resolve address of iterator
     LLVMExprResult callResult = {.value = iterator, .node = iteratorAssignNode};
@@ -115,23 +122,24 @@ std::any IRGenerator::visitForeachLoop(const ForeachLoopNode *node) {
     iteratorPtr = resolveAddress(iteratorAssignNode);
   }
 
-  // Check we have an idx
-  const DeclStmtNode *idxDeclNode = node->idxVarDecl;
-  const bool hasIdx = idxDeclNode != nullptr;
-  // Retrieve item ref type
-  assert(hasIdx ? node->getIdxFct != nullptr : node->getFct != nullptr);
-  const QualType itemRefSTy = hasIdx ? node->getIdxFct->returnType : node->getFct->returnType;
-
   // Visit idx variable declaration if required
+  const DeclStmtNode *idxDeclNode = node->idxVarDecl;
   const SymbolTableEntry *idxEntry = nullptr;
   llvm::Value *idxAddress = nullptr;
-  if (hasIdx) {
+  if (idxDeclNode != nullptr) {
     visit(idxDeclNode);
     // Get address of idx variable
     idxEntry = idxDeclNode->entries.at(manIdx);
     idxAddress = getAddress(idxEntry);
     assert(idxAddress != nullptr);
   }
+  // Only call .getIdx() if the idx is actually used. This saves the construction of a pair per iteration
+  const bool useGetIdxFct = node->getIdxFct != nullptr && (idxEntry->used || node->getFct == nullptr);
+  // Retrieve item ref type
+  assert(useGetIdxFct || node->getFct != nullptr);
+  QualType itemRefSTy = useGetIdxFct ? node->getIdxFct->returnType : node->getFct->returnType;
+  if (isArrayLoop && useGetIdxFct)
+    itemRefSTy = node->getIdxFct->returnType.getTemplateTypes().back();
 
   // Visit item variable declaration
   const DeclStmtNode *itemDeclNode = node->itemVarDecl;
@@ -141,16 +149,30 @@ std::any IRGenerator::visitForeachLoop(const ForeachLoopNode *node) {
   llvm::Value *itemAddress = getAddress(itemEntry);
   assert(itemAddress != nullptr);
 
+  // Initialize the counter
+  llvm::Type *arrayTy = nullptr;
+  if (isArrayLoop) {
+    arrayTy = iterableType.toLLVMType(sourceFile);
+    insertStore(builder.getInt64(0), counterPtr);
+  }
+
   // Create jump from original to head block
   insertJump(bHead);
 
   // Switch to head block
   switchToBlock(bHead);
   diGenerator.setSourceLocation(node);
-  // Call .isValid() on iterator
-  assert(node->isValidFct);
-  llvm::Function *isValidFct = stdFunctionManager.getIteratorIsValidFct(node->isValidFct);
-  llvm::Value *isValid = builder.CreateCall(isValidFct, iteratorPtr);
+  llvm::Value *isValid;
+  if (isArrayLoop) {
+    // Compare counter with the array size
+    llvm::Value *counter = insertLoad(builder.getInt64Ty(), counterPtr);
+    isValid = builder.CreateICmpULT(counter, builder.getInt64(iterableType.getArraySize()));
+  } else {
+    // Call .isValid() on iterator
+    assert(node->isValidFct);
+    llvm::Function *isValidFct = stdFunctionManager.getIteratorIsValidFct(node->isValidFct);
+    isValid = createIteratorCall(isValidFct, iteratorPtr);
+  }
   // Create conditional jump from head to body or exit block
   insertCondJump(isValid, bBody, bExit);
 
@@ -158,15 +180,23 @@ std::any IRGenerator::visitForeachLoop(const ForeachLoopNode *node) {
   switchToBlock(bBody);
   // Get the current iterator values
   LLVMExprResult itemResult;
-  if (hasIdx) {
+  if (isArrayLoop) {
+    llvm::Value *counter = insertLoad(builder.getInt64Ty(), counterPtr);
+    // Store counter to idx var
+    if (idxEntry != nullptr) {
+      LLVMExprResult idxResult = {.value = counter};
+      doAssignment(idxAddress, idxEntry, idxResult, QualType(TY_LONG), node, true);
+    }
+    // Address the current item directly
+    itemResult.ptr = insertInBoundsGEP(arrayTy, arrayPtr, {builder.getInt64(0), counter});
+  } else if (useGetIdxFct) {
     // Allocate space to save pair
     const QualType &pairSTy = node->getIdxFct->returnType;
     llvm::Type *pairTy = pairSTy.toLLVMType(sourceFile);
     llvm::Value *pairPtr = insertAlloca(pairSTy, "pair.addr");
     // Call .getIdx() on iterator
-    assert(node->getIdxFct);
     llvm::Function *getIdxFct = stdFunctionManager.getIteratorGetIdxFct(node->getIdxFct);
-    llvm::Value *pair = builder.CreateCall(getIdxFct, iteratorPtr);
+    llvm::Value *pair = createIteratorCall(getIdxFct, iteratorPtr);
     pair->setName("pair");
     insertStore(pair, pairPtr);
     // Store idx to idx var
@@ -178,9 +208,8 @@ std::any IRGenerator::visitForeachLoop(const ForeachLoopNode *node) {
     itemResult.refPtr = insertStructGEP(pairTy, pairPtr, 1, "item.addr");
   } else {
     // Call .get() on iterator
-    assert(node->getFct);
     llvm::Function *getFct = stdFunctionManager.getIteratorGetFct(node->getFct);
-    itemResult.ptr = builder.CreateCall(getFct, iteratorPtr);
+    itemResult.ptr = createIteratorCall(getFct, iteratorPtr);
   }
   if (node->calledItemCopyCtor != nullptr) {
     // Call copy ctor
@@ -199,12 +228,18 @@ std::any IRGenerator::visitForeachLoop(const ForeachLoopNode *node) {
   // Switch to tail block
   switchToBlock(bTail);
   diGenerator.setSourceLocation(node);
-  // Call .next() on iterator
-  assert(node->nextFct);
-  llvm::Function *nextFct = stdFunctionManager.getIteratorNextFct(node->nextFct);
-  builder.CreateCall(nextFct, iteratorPtr);
+  if (isArrayLoop) {
+    // Increment the counter. It cannot overflow, because it is bound by the array size
+    llvm::Value *counter = insertLoad(builder.getInt64Ty(), counterPtr);
+    insertStore(builder.CreateAdd(counter, builder.getInt64(1), "", true), counterPtr);
+  } else {
+    // Call .next() on iterator
+    assert(node->nextFct);
+    llvm::Function *nextFct = stdFunctionManager.getIteratorNextFct(node->nextFct);
+    createIteratorCall(nextFct, iteratorPtr);
+  }
   // Create jump from tail to head block
-  insertJump(bHead);
+  mdGenerator.generateLoopMetadata(insertJump(bHead), node);
 
   // Switch to exit block
   switchToBlock(bExit);
@@ -247,7 +282,7 @@ std::any IRGenerator::visitWhileLoop(const WhileLoopNode *node) {
   // Visit body
   visit(node->body);
   // Create jump to head block
-  insertJump(bHead);
+  mdGenerator.generateLoopMetadata(insertJump(bHead), node);
 
   // Switch to exit block
   switchToBlock(bExit);
@@ -290,7 +325,7 @@ std::any IRGenerator::visitDoWhileLoop(const DoWhileLoopNode *node) {
   // Evaluate condition
   llvm::Value *condValue = resolveValue(node->condition);
   // Jump to body or exit block, depending on the condition
-  insertCondJump(condValue, bBody, bExit);
+  mdGenerator.generateLoopMetadata(insertCondJump(condValue, bBody, bExit), node);
 
   // Switch to exit block
   switchToBlock(bExit);
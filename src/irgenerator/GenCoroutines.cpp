@@ -0,0 +1,317 @@
+// Copyright (c) 2021-2026 ChilliBits. All rights reserved.
+
+#include "IRGenerator.h"
+
+#include <SourceFile.h>
+#include <ast/ASTNodes.h>
+#include <model/Function.h>
+
+#include <llvm/IR/Intrinsics.h>
+#include <llvm/IR/Module.h>
+
+namespace spice::compiler {
+
+// Constants
+static constexpr auto CORO_NEXT_HANDLE_GLOBAL_NAME = "__spice_coro_next";
+
+/**
+ * Turn the function, that is currently generated, into a switched-resume coroutine.
+ *
+ * The coroutine starts eagerly: Calling it runs the body up to the first suspension point and then returns a Future, which
+ * holds the handle to the coroutine frame. The frame contains a promise of the form { state, result }. The state word
+ * is either nil (running or suspended without awaiter), the handle of the awaiting coroutine, or one of the markers
+ * CORO_STATE_DETACHED and CORO_STATE_DONE.
+ *
+ * @param spiceFunc Async function
+ * @param func LLVM function
+ * @return Address of the result variable
+ */
+llvm::Value *IRGenerator::generateCoroPrologue(const Function *spiceFunc, llvm::Function *func) {
+  llvm::PointerType *ptrTy = builder.getPtrTy();
+  llvm::Constant *nullPtr = llvm::ConstantPointerNull::get(ptrTy);
+  coroutine = CoroutineState{.fct = func, .promiseType = getCoroPromiseType(spiceFunc->returnType)};
+  func->addFnAttr(llvm::Attribute::PresplitCoroutine);
+
+  // Allocate the promise. Its alignment must match the one, the awaiting side passes to llvm.coro.promise
+  llvm::AllocaInst *promise = insertAlloca(coroutine.promiseType, "promise");
+  promise->setAlignment(module->getDataLayout().getABITypeAlign(coroutine.promiseType));
+  coroutine.promise = promise;
+  coroutine.id = builder.CreateIntrinsic(llvm::Intrinsic::coro_id, {}, {builder.getInt32(0), promise, nullPtr, nullPtr});
+
+  // Allocate the coroutine frame on the heap, unless the optimizer was able to elide the allocation
+  llvm::BasicBlock *bEntry = builder.GetInsertBlock();
+  llvm::BasicBlock *bAlloc = createBlock("coro.alloc");
+  llvm::BasicBlock *bBegin = createBlock("coro.begin");
+  llvm::Value *needsAlloc = builder.CreateIntrinsic(llvm::Intrinsic::coro_alloc, {}, {coroutine.id});
+  insertCondJump(needsAlloc, bAlloc, bBegin, Likelihood::LIKELY);
+  switchToBlock(bAlloc);
+  llvm::Value *frameSize = builder.CreateIntrinsic(llvm::Intrinsic::coro_size, {builder.getInt64Ty()}, {});
+  llvm::Value *allocatedMem = builder.CreateCall(stdFunctionManager.getMallocFct(), {frameSize});
+  insertJump(bBegin);
+  switchToBlock(bBegin);
+  llvm::PHINode *frameMem = builder.CreatePHI(ptrTy, 2, "coro.mem");
+  frameMem->addIncoming(nullPtr, bEntry);
+  frameMem->addIncoming(allocatedMem, bAlloc);
+  coroutine.handle = builder.CreateIntrinsic(llvm::Intrinsic::coro_begin, {}, {coroutine.id, frameMem});
+
+  // Nobody awaits the coroutine yet
+  insertStore(nullPtr, builder.CreateStructGEP(coroutine.promiseType, promise, 0, "state.addr"));
+
+  // Prepare the blocks, that conclude the coroutine. They get filled in by generateCoroEpilogue()
+  coroutine.finalBlock = createBlock("coro.final");
+  coroutine.cleanupBlock = createBlock("coro.cleanup");
+  coroutine.suspendBlock = createBlock("coro.suspend");
+
+  // The result variable lives in the promise, so that the awaiting side can read it after completion
+  return builder.CreateStructGEP(coroutine.promiseType, promise, 1, RETURN_VARIABLE_NAME);
+}
+
+/**
+ * Complete the coroutine with the given return value. The scope cleanup must be done already.
+ *
+ * @param returnValue Return value or nullptr, if the result variable holds the value already
+ */
+void IRGenerator::generateCoroReturn(llvm::Value *returnValue) {
+  assert(isInCoroutine());
+  if (returnValue != nullptr) {
+    llvm::Value *resultAddr = builder.CreateStructGEP(coroutine.promiseType, coroutine.promise, 1);
+    insertStore(returnValue, resultAddr);
+  }
+  builder.CreateBr(coroutine.finalBlock);
+}
+
+/**
+ * Generate the final suspend point, the cleanup and the suspend blocks of the coroutine, that is currently generated
+ *
+ * @param spiceFunc Async function
+ */
+void IRGenerator::generateCoroEpilogue(const Function *spiceFunc) {
+  assert(isInCoroutine());
+  llvm::PointerType *ptrTy = builder.getPtrTy();
+  llvm::Constant *nullPtr = llvm::ConstantPointerNull::get(ptrTy);
+
+  // Final suspend point: publish the completion and find out, who is interested in the result
+  switchToBlock(coroutine.finalBlock);
+  llvm::Value *finalSave = builder.CreateIntrinsic(llvm::Intrinsic::coro_save, {}, {coroutine.handle});
+  llvm::Value *stateAddr = builder.CreateStructGEP(coroutine.promiseType, coroutine.promise, 0, "state.addr");
+  llvm::Constant *doneMarker = llvm::ConstantExpr::getIntToPtr(builder.getInt64(CORO_STATE_DONE), ptrTy);
+  llvm::Value *prevState = builder.CreateAtomicRMW(llvm::AtomicRMWInst::Xchg, stateAddr, doneMarker, llvm::MaybeAlign(8),
+                                                   llvm::AtomicOrdering::AcquireRelease);
+  // A detached coroutine frees itself
+  llvm::BasicBlock *bCheckAwaiter = createBlock("coro.final.check");
+  llvm::BasicBlock *bScheduleAwaiter = createBlock("coro.final.schedule");
+  llvm::BasicBlock *bFinalSuspend = createBlock("coro.final.suspend");
+  llvm::Constant *detachedMarker = llvm::ConstantExpr::getIntToPtr(builder.getInt64(CORO_STATE_DETACHED), ptrTy);
+  insertCondJump(builder.CreateICmpEQ(prevState, detachedMarker), coroutine.cleanupBlock, bCheckAwaiter);
+  // An awaiting coroutine gets resumed by the resume loop, as soon as this coroutine is suspended
+  switchToBlock(bCheckAwaiter);
+  insertCondJump(builder.CreateICmpNE(prevState, nullPtr), bScheduleAwaiter, bFinalSuspend);
+  switchToBlock(bScheduleAwaiter);
+  insertStore(prevState, builder.CreateThreadLocalAddress(getCoroNextHandleGlobal()));
+  insertJump(bFinalSuspend);
+  switchToBlock(bFinalSuspend);
+  llvm::Value *suspendResult = builder.CreateIntrinsic(llvm::Intrinsic::coro_suspend, {}, {finalSave, builder.getTrue()});
+  llvm::SwitchInst *switchInst = builder.CreateSwitch(suspendResult, coroutine.suspendBlock, 1);
+  switchInst->addCase(builder.getInt8(1), coroutine.cleanupBlock);
+  blockAlreadyTerminated = true;
+
+  // Cleanup: free the coroutine frame
+  switchToBlock(coroutine.cleanupBlock);
+  llvm::BasicBlock *bFree = createBlock("coro.free");
+  llvm::Value *frameMem = builder.CreateIntrinsic(llvm::Intrinsic::coro_free, {}, {coroutine.id, coroutine.handle});
+  insertCondJump(builder.CreateICmpNE(frameMem, nullPtr), bFree, coroutine.suspendBlock);
+  switchToBlock(bFree);
+  builder.CreateCall(stdFunctionManager.getFreeFct(), {frameMem});
+  insertJump(coroutine.suspendBlock);
+
+  // Suspend: return the future to the caller. In the resume and destroy parts, this becomes a plain return
+  switchToBlock(coroutine.suspendBlock);
+  llvm::Constant *noneToken = llvm::ConstantTokenNone::get(context);
+  builder.CreateIntrinsic(llvm::Intrinsic::coro_end, {}, {nullPtr, builder.getFalse(), noneToken});
+  llvm::Type *futureType = spiceFunc->futureType.toLLVMType(sourceFile);
+  llvm::Value *future = builder.CreateInsertValue(llvm::PoisonValue::get(futureType), coroutine.handle, 0);
+  builder.CreateRet(future);
+  blockAlreadyTerminated = true;
+
+  coroutine = CoroutineState{};
+}
+
+/**
+ * Suspend the coroutine, that is currently generated. Resuming the coroutine continues in the given block, destroying it
+ * ends the lifetime of the local variables and runs the cleanup.
+ *
+ * @param saveToken Token of the llvm.coro.save call, that precedes the suspension
+ * @param resumeBlock Block to continue with after resumption
+ * @param node AST node of the suspension point
+ */
+void IRGenerator::generateCoroSuspend(llvm::Value *saveToken, llvm::BasicBlock *resumeBlock, const ASTNode *node) {
+  assert(isInCoroutine());
+  llvm::BasicBlock *bDestroy = createBlock("coro.destroy");
+  llvm::Value *suspendResult = builder.CreateIntrinsic(llvm::Intrinsic::coro_suspend, {}, {saveToken, builder.getFalse()});
+  llvm::SwitchInst *switchInst = builder.CreateSwitch(suspendResult, coroutine.suspendBlock, 2);
+  switchInst->addCase(builder.getInt8(0), resumeBlock);
+  switchInst->addCase(builder.getInt8(1), bDestroy);
+  blockAlreadyTerminated = true;
+
+  // Destroy: clean up the local variables, that are alive at the suspension point, then free the frame
+  switchToBlock(bDestroy);
+  generateCoroDestroyCleanup(node);
+  insertJump(coroutine.cleanupBlock);
+}
+
+/**
+ * Generate the cleanup of all scopes, that enclose the given suspension point. Only the variables, that are declared
+ * before the suspension point, are alive there. Scopes are cleaned up from the inside out, like returning would do.
+ *
+ * @param node AST node of the suspension point
+ */
+void IRGenerator::generateCoroDestroyCleanup(const ASTNode *node) {
+  const auto isAlive = [&](const SymbolTableEntry *entry) {
+    return entry->declNode->codeLoc < node->codeLoc && getAddress(entry) != nullptr;
+  };
+  for (const ASTNode *current = node; current != nullptr; current = current->parent) {
+    if (!current->isStmtLst())
+      continue;
+    const auto stmtLst = spice_pointer_cast<const StmtLstNode *>(current);
+    const auto &[dtorFunctionsToCall, heapVarsToFree] = stmtLst->resourcesToCleanup.at(manIdx);
+    // Call the dtors of the alive variables
+    for (auto [entry, dtor] : dtorFunctionsToCall)
+      if (isAlive(entry))
+        generateCtorOrDtorCall(entry, dtor, {});
+    // Deallocate the alive heap variables
+    for (const SymbolTableEntry *entry : heapVarsToFree)
+      if (isAlive(entry))
+        generateDeallocCall(getAddress(entry));
+  }
+}
+
+/**
+ * Wait for the completion of another coroutine, take its result and free it
+ *
+ * @param frame Frame of the awaited coroutine
+ * @param resultType Result type of the awaited coroutine
+ * @param node AST node of the await expression
+ * @return Result value
+ */
+llvm::Value *IRGenerator::generateCoroAwait(llvm::Value *frame, const QualType &resultType, const ASTNode *node) {
+  assert(isInCoroutine());
+  llvm::PointerType *ptrTy = builder.getPtrTy();
+  llvm::StructType *promiseType = getCoroPromiseType(resultType);
+  llvm::Value *promise = getCoroPromise(frame, promiseType);
+  llvm::Value *stateAddr = builder.CreateStructGEP(promiseType, promise, 0, "state.addr");
+
+  // Register as awaiter. This fails, if the awaited coroutine has completed already
+  llvm::BasicBlock *bSuspend = createBlock("await.suspend");
+  llvm::BasicBlock *bReady = createBlock("await.ready");
+  llvm::Value *saveToken = builder.CreateIntrinsic(llvm::Intrinsic::coro_save, {}, {coroutine.handle});
+  llvm::Value *nullPtr = llvm::ConstantPointerNull::get(ptrTy);
+  llvm::AtomicCmpXchgInst *cmpXchg = builder.CreateAtomicCmpXchg(stateAddr, nullPtr, coroutine.handle, llvm::MaybeAlign(8),
+                                                                 llvm::AtomicOrdering::AcquireRelease,
+                                                                 llvm::AtomicOrdering::Acquire);
+  llvm::Value *registered = builder.CreateExtractValue(cmpXchg, 1);
+  insertCondJump(registered, bSuspend, bReady);
+  switchToBlock(bSuspend);
+  generateCoroSuspend(saveToken, bReady, node);
+
+  // Take the result and free the awaited coroutine
+  switchToBlock(bReady);
+  llvm::Value *resultAddr = builder.CreateStructGEP(promiseType, promise, 1, "result.addr");
+  llvm::Value *result = insertLoad(promiseType->getElementType(1), resultAddr);
+  builder.CreateIntrinsic(llvm::Intrinsic::coro_destroy, {}, {frame});
+  return result;
+}
+
+/**
+ * Resume the given coroutine. If it completes and hands control to an awaiting coroutine, resume that one as well, and
+ * so forth. This keeps the stack depth constant, no matter how long the chain of awaiting coroutines is.
+ *
+ * @param frame Frame of the coroutine to resume
+ */
+void IRGenerator::generateCoroResume(llvm::Value *frame) {
+  llvm::PointerType *ptrTy = builder.getPtrTy();
+  llvm::BasicBlock *bBefore = builder.GetInsertBlock();
+  llvm::BasicBlock *bLoop = createBlock("coro.resume.loop");
+  llvm::BasicBlock *bExit = createBlock("coro.resume.exit");
+  insertJump(bLoop);
+  switchToBlock(bLoop);
+  llvm::PHINode *currentFrame = builder.CreatePHI(ptrTy, 2, "coro.frame");
+  currentFrame->addIncoming(frame, bBefore);
+  builder.CreateIntrinsic(llvm::Intrinsic::coro_resume, {}, {currentFrame});
+  // Check if the resumed coroutine has scheduled an awaiting coroutine
+  llvm::Value *nextHandleAddr = builder.CreateThreadLocalAddress(getCoroNextHandleGlobal());
+  llvm::Value *nextFrame = insertLoad(ptrTy, nextHandleAddr);
+  insertStore(llvm::ConstantPointerNull::get(ptrTy), nextHandleAddr);
+  currentFrame->addIncoming(nextFrame, builder.GetInsertBlock());
+  insertCondJump(builder.CreateIsNotNull(nextFrame), bLoop, bExit);
+  switchToBlock(bExit);
+}
+
+/**
+ * Retrieve the address of the promise in the given coroutine frame
+ *
+ * @param frame Coroutine frame
+ * @param promiseType Promise type
+ * @return Promise address
+ */
+llvm::Value *IRGenerator::getCoroPromise(llvm::Value *frame, llvm::StructType *promiseType) const {
+  const uint64_t promiseAlign = module->getDataLayout().getABITypeAlign(promiseType).value();
+  llvm::Value *alignment = builder.getInt32(static_cast<uint32_t>(promiseAlign));
+  return builder.CreateIntrinsic(llvm::Intrinsic::coro_promise, {}, {frame, alignment, builder.getFalse()});
+}
+
+/**
+ * Locate the state word in the promise of the coroutine, that the given builtin call operates on
+ *
+ * @param node Builtin call node with the result type of the coroutine as template type
+ * @param frame Coroutine frame or nullptr to resolve it from the first argument
+ * @return Address of the state word
+ */
+llvm::Value *IRGenerator::getCoroStateAddr(const FctCallNode *node, llvm::Value *frame) {
+  if (frame == nullptr)
+    frame = resolveValue(node->argLst->args.front());
+  const QualType resultSTy = node->templateTypeLst->dataTypes.front()->getEvaluatedSymbolType(manIdx);
+  llvm::StructType *promiseType = getCoroPromiseType(resultSTy);
+  llvm::Value *promise = getCoroPromise(frame, promiseType);
+  return builder.CreateStructGEP(promiseType, promise, 0, "state.addr");
+}
+
+/**
+ * Get the promise type for a coroutine with the given result type
+ *
+ * @param resultType Result type of the coroutine
+ * @return Promise type: { state, result }
+ */
+llvm::StructType *IRGenerator::getCoroPromiseType(const QualType &resultType) const {
+  return llvm::StructType::get(context, {builder.getPtrTy(), resultType.toLLVMType(sourceFile)});
+}
+
+/**
+ * Get the thread-local slot, in which a completing coroutine places the handle of the awaiting coroutine
+ *
+ * @return Global variable
+ */
+llvm::GlobalVariable *IRGenerator::getCoroNextHandleGlobal() const {
+  if (llvm::GlobalVariable *global = module->getNamedGlobal(CORO_NEXT_HANDLE_GLOBAL_NAME))
+    return global;
+
+  llvm::PointerType *ptrTy = builder.getPtrTy();
+  module->getOrInsertGlobal(CORO_NEXT_HANDLE_GLOBAL_NAME, ptrTy);
+  llvm::GlobalVariable *global = module->getNamedGlobal(CORO_NEXT_HANDLE_GLOBAL_NAME);
+  global->setInitializer(llvm::ConstantPointerNull::get(ptrTy));
+  global->setThreadLocal(true);
+  // Every module, that uses coroutines, emits the slot. The linker merges them
+  global->setLinkage(llvm::GlobalValue::WeakODRLinkage);
+  attachComdatToSymbol(global, CORO_NEXT_HANDLE_GLOBAL_NAME, true);
+  return global;
+}
+
+/**
+ * Check if the IR generator currently generates the body of a coroutine. Lambdas within coroutines do not count.
+ *
+ * @return In coroutine or not
+ */
+bool IRGenerator::isInCoroutine() const {
+  return coroutine.fct != nullptr && builder.GetInsertBlock()->getParent() == coroutine.fct;
+}
+
+} // namespace spice::compiler
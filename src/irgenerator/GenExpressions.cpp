@@ -694,6 +694,25 @@ std::any IRGenerator::visitPrefixUnaryExpr(const PrefixUnaryExprNode *node) {
     lhs = {.value = newValue, .ptr = newPtr};
     break;
   }
+  case PrefixUnaryExprNode::PrefixUnaryOp::OP_AWAIT: {
+    // Load the frame of the awaited coroutine from the future
+    const QualType futureSTy = lhsSTy.removeReferenceWrapper();
+    llvm::Value *futureAddr = resolveAddress(lhs);
+    llvm::Value *frameAddr = builder.CreateStructGEP(futureSTy.toLLVMType(sourceFile), futureAddr, 0);
+    llvm::Value *frame = insertLoad(builder.getPtrTy(), frameAddr);
+    // Wait for the result. This frees the awaited coroutine, so the future gets emptied
+    llvm::Value *result = generateCoroAwait(frame, futureSTy.getTemplateTypes().front(), node);
+    insertStore(llvm::ConstantPointerNull::get(builder.getPtrTy()), frameAddr);
+    lhs = {.value = result};
+    // Attach address to anonymous symbol to keep track of de-allocation
+    if (const SymbolTableEntry *anonymousSymbol = currentScope->symbolTable.lookupAnonymous(node)) {
+      lhs.ptr = insertAlloca(result->getType());
+      insertStore(result, lhs.ptr);
+      updateAddress(anonymousSymbol, lhs.ptr);
+      lhs.entry = anonymousSymbol;
+    }
+    break;
+  }
   default:                                                                 // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "PrefixUnaryExpr fall-through"); // GCOV_EXCL_LINE
   }
@@ -731,6 +750,7 @@ std::any IRGenerator::visitPostfixUnaryExpr(const PostfixUnaryExprNode *node) {
 
     // Get the index value
     llvm::Value *indexValue = resolveValue(indexExpr);
+    llvm::Value *laneValue = nullptr;
     // Come up with the address
     if (lhsSTy.isArray() && lhsSTy.getArraySize() != ARRAY_SIZE_UNKNOWN) { // Array
       // Make sure the address is present
@@ -740,6 +760,18 @@ std::any IRGenerator::visitPostfixUnaryExpr(const PostfixUnaryExprNode *node) {
       llvm::Type *lhsTy = lhsSTy.toLLVMType(sourceFile);
       llvm::Value *indices[2] = {builder.getInt64(0), indexValue};
       lhs.ptr = insertInBoundsGEP(lhsTy, lhs.ptr, indices);
+    } else if (lhsSTy.isVector()) { // SIMD vector
+      // Make sure the address is present
+      resolveAddress(lhs);
+
+      // Read the lane from the vector value, so that the optimizer keeps the vector in a register
+      laneValue = builder.CreateExtractElement(resolveValue(lhsSTy, lhs), indexValue);
+
+      // Writes go through the lane address. The lanes of non-bool vectors are laid out in memory like an array
+      llvm::Type *laneTy = lhsSTy.getContained().toLLVMType(sourceFile);
+      lhs.ptr = insertInBoundsGEP(laneTy, lhs.ptr, indexValue);
+      if (cliOptions.useTBAAMetadata)
+        mdGenerator.registerVectorLaneAccess(lhs.ptr);
     } else { // Pointer
       // Now the pointer is the value
       lhs.ptr = resolveValue(lhsNode, lhs);
@@ -750,7 +782,7 @@ std::any IRGenerator::visitPostfixUnaryExpr(const PostfixUnaryExprNode *node) {
     }
 
     // Reset value and entry
-    lhs.value = nullptr;
+    lhs.value = laneValue;
     lhs.entry = nullptr;
     break;
   }
@@ -779,6 +811,9 @@ std::any IRGenerator::visitPostfixUnaryExpr(const PostfixUnaryExprNode *node) {
       indices.push_back(builder.getInt32(index));
     const std::string name = fieldName + ".addr";
     llvm::Value *memberAddr = insertInBoundsGEP(lhsSTy.toLLVMType(sourceFile), lhs.ptr, indices, name);
+    // Remember the access path for struct-path TBAA
+    if (cliOptions.useTBAAMetadata)
+      mdGenerator.registerFieldAccess(memberAddr, lhsSTy, indexPath, fieldSymbolType);
 
     // Set as ptr or refPtr, depending on the type
     if (fieldSymbolType.isRef()) {
@@ -24,6 +24,8 @@ static const char *const TEST_CASE_RUN_MSG = "[ RUN      ] %s\n";
 static const char *const TEST_CASE_SUCCESS_MSG = "\033[1m\033[32m[ PASSED   ]\033[0m\033[22m %s\n";
 static const char *const TEST_CASE_FAILED_MSG = "\033[1m\033[31m[ FAILED   ]\033[0m\033[22m %s\n";
 static const char *const TEST_CASE_SKIPPED_MSG = "\033[1m\033[33m[ SKIPPED  ]\033[0m\033[22m %s\n";
+// Report for a program without benchmarks. Otherwise, the report is printed by the bench runtime
+static const char *const BENCH_EMPTY_REPORT_MSG = "{\n  \"benchmarks\": []\n}\n";
 
 llvm::Value *IRGenerator::doImplicitCast(llvm::Value *src, QualType dstSTy, QualType srcSTy) {
   assert(srcSTy != dstSTy); // We only need to cast implicitly, if the types do not match exactly
@@ -854,4 +856,117 @@ void IRGenerator::generateTestMain() {
   generateImplicitFunction(generateBody, &testMain);
 }
 
+void IRGenerator::generateBenchMain() {
+  // Collect all benchmarks
+  std::vector<const Function *> benchmarks;
+  for (const auto &sourceFile : resourceManager.sourceFiles | std::views::values)
+    benchmarks.insert(benchmarks.end(), sourceFile->benchFunctions.begin(), sourceFile->benchFunctions.end());
+
+  // Prepare entry for bench main
+  QualType functionType(TY_FUNCTION);
+  functionType.setQualifiers(TypeQualifiers::of(TY_FUNCTION));
+  functionType.makePublic();
+  SymbolTableEntry entry(MAIN_FUNCTION_NAME, functionType, rootScope, nullptr, 0, false);
+
+  // Prepare bench main function
+  Function benchMain(MAIN_FUNCTION_NAME, &entry, QualType(TY_DYN), QualType(TY_INT), {}, {}, nullptr);
+  benchMain.used = true; // Mark as used to prevent removal
+  benchMain.implicitDefault = true;
+  benchMain.mangleFunctionName = false;
+
+  // Prepare scope
+  rootScope->createChildScope(benchMain.getScopeName(), ScopeType::FUNC_PROC_BODY, nullptr);
+
+  // Generate
+  const std::function<void()> generateBody = [&] {
+    // Without benchmarks, the bench runtime is not linked. Print the empty report directly
+    if (benchmarks.empty()) {
+      llvm::Constant *emptyReportMsg = createGlobalStringConst("emptyReportMsg", BENCH_EMPTY_REPORT_MSG, *rootScope->codeLoc);
+      builder.CreateCall(stdFunctionManager.getPrintfFct(), emptyReportMsg);
+      builder.CreateRet(builder.getInt32(0));
+      return;
+    }
+
+    // Declare the functions of the bench runtime
+    llvm::Type *ptrTy = builder.getPtrTy();
+    llvm::Type *int32Ty = builder.getInt32Ty();
+    llvm::Type *int64Ty = builder.getInt64Ty();
+    llvm::Type *voidTy = builder.getVoidTy();
+    const llvm::FunctionCallee beginFct =
+        module->getOrInsertFunction(BENCH_BEGIN_FCT_NAME, llvm::FunctionType::get(ptrTy, {int32Ty}, false));
+    const llvm::FunctionCallee startFct =
+        module->getOrInsertFunction(BENCH_START_FCT_NAME, llvm::FunctionType::get(voidTy, {ptrTy, ptrTy, ptrTy}, false));
+    const llvm::FunctionCallee nextBatchFct =
+        module->getOrInsertFunction(BENCH_NEXT_BATCH_FCT_NAME, llvm::FunctionType::get(int64Ty, {ptrTy}, false));
+    const llvm::FunctionCallee endFct =
+        module->getOrInsertFunction(BENCH_END_FCT_NAME, llvm::FunctionType::get(int32Ty, {ptrTy}, false));
+
+    llvm::Value *handle = builder.CreateCall(beginFct, builder.getInt32(benchmarks.size()));
+    for (const Function *benchmark : benchmarks) {
+      assert(benchmark->isNormalProcedure());
+      assert(benchmark->paramList.empty());
+
+      // Retrieve attribute list for the benchmark
+      assert(benchmark->declNode->isFctOrProcDef());
+      const auto procDefNode = spice_pointer_cast<FctDefBaseNode *>(benchmark->declNode);
+      assert(procDefNode->attrs != nullptr);
+      const AttrLstNode *attrs = procDefNode->attrs->attrLst;
+      assert(attrs->getAttrValueByName(ATTR_BENCH)->boolValue); // The bench attribute must be present
+      const CompileTimeValue *benchNameAttr = attrs->getAttrValueByName(ATTR_BENCH_NAME);
+
+      // Prepare benchmark name. The bench runtime escapes it for the JSON report
+      std::string benchName = benchmark->name;
+      if (benchNameAttr)
+        benchName += " (" + resourceManager.compileTimeStringValues.at(benchNameAttr->stringValueOffset) + ")";
+      const CodeLoc &codeLoc = benchmark->getDeclCodeLoc();
+      llvm::Constant *benchNameValue = createGlobalStringConst("benchName", benchName, codeLoc);
+      const std::string &fileName = benchmark->bodyScope->sourceFile->fileName;
+      llvm::Constant *fileNameValue = createGlobalStringConst("fileName", fileName, codeLoc);
+
+      // Benchmark is not defined in the current module -> declare it
+      const std::string mangledName = benchmark->getMangledName();
+      if (!module->getFunction(mangledName))
+        module->getOrInsertFunction(mangledName, llvm::FunctionType::get(voidTy, {}, false));
+      llvm::Function *callee = module->getFunction(mangledName);
+      assert(callee != nullptr);
+
+      // Call the benchmark in batches, as long as the bench runtime requests more iterations:
+      // while ((n = nextBatch(handle)) != 0) for (i = 0; i < n; i++) benchmark();
+      builder.CreateCall(startFct, {handle, benchNameValue, fileNameValue});
+      llvm::BasicBlock *bBatchHead = createBlock("bench.batch.head");
+      llvm::BasicBlock *bIterHead = createBlock("bench.iter.head");
+      llvm::BasicBlock *bIterBody = createBlock("bench.iter.body");
+      llvm::BasicBlock *bExit = createBlock("bench.exit");
+      insertJump(bBatchHead);
+
+      // Fetch the size of the next batch
+      switchToBlock(bBatchHead);
+      llvm::Value *batchSize = builder.CreateCall(nextBatchFct, handle);
+      llvm::Value *isDone = builder.CreateICmpEQ(batchSize, builder.getInt64(0));
+      insertCondJump(isDone, bExit, bIterHead, Likelihood::UNLIKELY);
+
+      // Check if the batch is complete
+      switchToBlock(bIterHead);
+      llvm::PHINode *iteration = builder.CreatePHI(int64Ty, 2, "bench.iteration");
+      iteration->addIncoming(builder.getInt64(0), bBatchHead);
+      llvm::Value *isBatchComplete = builder.CreateICmpUGE(iteration, batchSize);
+      insertCondJump(isBatchComplete, bBatchHead, bIterBody, Likelihood::UNLIKELY);
+
+      // Run one iteration
+      switchToBlock(bIterBody);
+      builder.CreateCall(callee);
+      llvm::Value *nextIteration = builder.CreateAdd(iteration, builder.getInt64(1));
+      iteration->addIncoming(nextIteration, bIterBody);
+      insertJump(bIterHead);
+
+      switchToBlock(bExit);
+    }
+
+    // The bench runtime determines the exit code
+    llvm::Value *exitCode = builder.CreateCall(endFct, handle);
+    builder.CreateRet(exitCode);
+  };
+  generateImplicitFunction(generateBody, &benchMain);
+}
+
 } // namespace spice::compiler
\ No newline at end of file
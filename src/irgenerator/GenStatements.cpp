@@ -124,7 +124,7 @@ std::any IRGenerator::visitReturnStmt(const ReturnStmtNode *node) {
     } else {
       returnValue = node->returnType.isRef() ? resolveAddress(returnExpr) : resolveValue(returnExpr);
     }
-  } else { // Try to load result variable value
+  } else if (!isInCoroutine()) { // Try to load result variable value. Coroutines keep it in their promise anyway
     const SymbolTableEntry *resultEntry = currentScope->lookup(RETURN_VARIABLE_NAME);
     if (resultEntry != nullptr) {
       llvm::Type *resultSTy = resultEntry->getQualType().toLLVMType(sourceFile);
@@ -137,7 +137,10 @@ std::any IRGenerator::visitReturnStmt(const ReturnStmtNode *node) {
   terminateBlock(node->getParentScopeNode());
 
   // Create return instruction
-  if (returnValue != nullptr) {
+  if (isInCoroutine()) {
+    // Complete the coroutine
+    generateCoroReturn(returnValue);
+  } else if (returnValue != nullptr) {
     // Return with value
     builder.CreateRet(returnValue);
   } else {
@@ -10,6 +10,7 @@
 #include <typechecker/FunctionManager.h>
 
 #include <llvm/IR/Module.h>
+#include <llvm/Support/TimeProfiler.h>
 #include <llvm/Target/TargetLoweringObjectFile.h>
 
 namespace spice::compiler {
@@ -146,6 +147,8 @@ std::any IRGenerator::visitFctDef(const FctDefNode *node) {
       continue;
     }
 
+    llvm::TimeTraceScope timeTraceScope("IR Generator Function", [&] { return manifestation->getSignature(); });
+
     // Change to struct scope
     if (manifestation->isMethod()) {
       const QualType &thisType = manifestation->thisType;
@@ -188,8 +191,9 @@ std::any IRGenerator::visitFctDef(const FctDefNode *node) {
       }
     }
 
-    // Get return type
-    llvm::Type *returnType = manifestation->returnType.toLLVMType(sourceFile);
+    // Get return type. Async functions return a future to their result
+    const QualType &returnSType = manifestation->isAsync ? manifestation->futureType : manifestation->returnType;
+    llvm::Type *returnType = returnSType.toLLVMType(sourceFile);
 
     // Get function linkage
     bool externalLinkage = isPublic;
@@ -213,7 +217,7 @@ std::any IRGenerator::visitFctDef(const FctDefNode *node) {
     enableFunctionInstrumentation(func);
     // Set attributes to function parameters and return value
     setParamAttrs(func, paramInfoList);
-    setFunctionReturnValAttrs(func, manifestation->returnType);
+    setFunctionReturnValAttrs(func, returnSType);
 
     // Add debug info
     diGenerator.generateFunctionDebugInfo(func, manifestation);
@@ -227,13 +231,17 @@ std::any IRGenerator::visitFctDef(const FctDefNode *node) {
     allocaInsertBlock = bEntry;
     allocaInsertInst = nullptr;
 
-    // Declare result variable
-    llvm::Value *resultAddr = insertAlloca(manifestation->returnType, RETURN_VARIABLE_NAME);
+    // Declare result variable. Coroutines keep it in their promise
     const SymbolTableEntry *resultEntry = currentScope->lookupStrict(RETURN_VARIABLE_NAME);
     assert(resultEntry != nullptr);
-    updateAddress(resultEntry, resultAddr);
-    // Generate debug info
-    diGenerator.generateLocalVarDebugInfo(RETURN_VARIABLE_NAME, resultAddr);
+    if (manifestation->isAsync) {
+      updateAddress(resultEntry, generateCoroPrologue(manifestation, func));
+    } else {
+      llvm::Value *resultAddr = insertAlloca(manifestation->returnType, RETURN_VARIABLE_NAME);
+      updateAddress(resultEntry, resultAddr);
+      // Generate debug info
+      diGenerator.generateLocalVarDebugInfo(RETURN_VARIABLE_NAME, resultAddr);
+    }
 
     // Store function argument values
     for (auto &arg : func->args()) {
@@ -267,7 +275,11 @@ std::any IRGenerator::visitFctDef(const FctDefNode *node) {
     visit(node->body);
 
     // Create return statement if the block is not terminated yet
-    if (!blockAlreadyTerminated) {
+    if (manifestation->isAsync) {
+      if (!blockAlreadyTerminated)
+        generateCoroReturn(nullptr);
+      generateCoroEpilogue(manifestation);
+    } else if (!blockAlreadyTerminated) {
       llvm::Value *result = insertLoad(returnType, getAddress(resultEntry));
       builder.CreateRet(result);
     }
@@ -305,6 +317,8 @@ std::any IRGenerator::visitProcDef(const ProcDefNode *node) {
     }
     assert(manifestation->alreadyTypeChecked);
 
+    llvm::TimeTraceScope timeTraceScope("IR Generator Function", [&] { return manifestation->getSignature(); });
+
     // Change to struct scope
     if (manifestation->isMethod()) {
       const QualType &thisType = manifestation->thisType;
@@ -521,6 +535,16 @@ void IRGenerator::setParamAttrs(llvm::Function *function, const ParamInfoList &p
       function->addDereferenceableParamAttr(i, module->getDataLayout().getTypeStoreSize(pointeeType));
       // Alignment attribute
       function->addParamAttr(i, llvm::Attribute::getWithAlignment(context, module->getDataLayout().getABITypeAlign(pointeeType)));
+    } else if (paramType.isRef() && cliOptions.useRefParamAttrs) {
+      // References are always bound to a valid object
+      llvm::Type *referencedType = paramType.getContained().toLLVMType(sourceFile);
+      assert(referencedType != nullptr);
+      if (referencedType->isSized()) {
+        function->addParamAttr(i, llvm::Attribute::NonNull);
+        function->addDereferenceableParamAttr(i, module->getDataLayout().getTypeStoreSize(referencedType));
+        const llvm::Align alignment = module->getDataLayout().getABITypeAlign(referencedType);
+        function->addParamAttr(i, llvm::Attribute::getWithAlignment(context, alignment));
+      }
     }
 
     // ZExt or SExt attribute
@@ -4,8 +4,11 @@
 
 #include <SourceFile.h>
 #include <driver/Driver.h>
+#include <global/GlobalResourceManager.h>
 #include <irgenerator/NameMangling.h>
+#include <model/Function.h>
 
+#include <llvm/IR/Intrinsics.h>
 #include <llvm/IR/Module.h>
 
 namespace spice::compiler {
@@ -118,6 +121,10 @@ llvm::Constant *IRGenerator::generateVTable(StructBase *spiceStruct) const {
   global->setAlignment(llvm::MaybeAlign(8));
   attachComdatToSymbol(global, mangledName, isPublic);
 
+  // Attach type metadata for whole program devirtualization
+  if (cliOptions.useLTO && cliOptions.devirtualize && spiceStruct->entry->getQualType().is(TY_STRUCT))
+    attachVTableTypeMetadata(global, spiceStruct);
+
   return spiceStruct->vTableData.vtable = global;
 }
 
@@ -154,4 +161,98 @@ void IRGenerator::generateVTableInitializer(const StructBase *spiceStruct) {
   global->setInitializer(initializer);
 }
 
+void IRGenerator::attachVTableTypeMetadata(llvm::GlobalVariable *vtable, const StructBase *spiceStruct) const {
+  // The VTable pointer, stored in the struct instances, points behind the nullptr guard and the TypeInfo
+  const uint64_t addressPoint = 2 * module->getDataLayout().getPointerSize();
+
+  // The struct VTable is compatible to its own type and to the types of all implemented interfaces
+  vtable->addTypeMetadata(addressPoint, llvm::MDString::get(context, NameMangling::mangleTypeInfoName(spiceStruct)));
+  for (const QualType &interfaceType : static_cast<const Struct *>(spiceStruct)->interfaceTypes) {
+    const Interface *spiceInterface = interfaceType.getInterface(nullptr);
+    assert(spiceInterface != nullptr);
+    vtable->addTypeMetadata(addressPoint, llvm::MDString::get(context, NameMangling::mangleTypeInfoName(spiceInterface)));
+  }
+
+  // For executables, the linker sees all VTables, so LLVM may assume that there are no other implementations
+  if (cliOptions.outputContainer == OutputContainer::EXECUTABLE)
+    vtable->setVCallVisibilityMetadata(llvm::GlobalObject::VCallVisibilityLinkageUnit);
+}
+
+void IRGenerator::generateVTableTypeTest(llvm::Value *vtablePtr, const QualType &interfaceType) {
+  const Interface *spiceInterface = interfaceType.getInterface(nullptr);
+  assert(spiceInterface != nullptr);
+
+  // Tell LLVM, which VTables can be behind the loaded VTable pointer, so that the call can be devirtualized at link time
+  llvm::Metadata *typeId = llvm::MDString::get(context, NameMangling::mangleTypeInfoName(spiceInterface));
+  llvm::Value *typeIdValue = llvm::MetadataAsValue::get(context, typeId);
+  llvm::Value *typeTest = builder.CreateIntrinsic(llvm::Intrinsic::type_test, {}, {vtablePtr, typeIdValue});
+  builder.CreateAssumption(typeTest);
+}
+
+const Function *IRGenerator::getDevirtualizedCallee(const FctCallNode::FctCallData &data) {
+  assert(data.isVirtualMethodCall());
+  if (!cliOptions.devirtualize)
+    return nullptr;
+
+  // We can only know all implementations of the interface, if the interface is private to the current source file or
+  // if the whole program is compiled at once
+  const QualType interfaceType = data.thisType.getBase();
+  const Interface *spiceInterface = interfaceType.getInterface(nullptr);
+  assert(spiceInterface != nullptr);
+  const bool isWholeProgram = cliOptions.useLTO && cliOptions.outputContainer == OutputContainer::EXECUTABLE;
+  if (spiceInterface->entry->getQualType().isPublic() && !isWholeProgram)
+    return nullptr;
+
+  // Look up the struct, that implements the interface. Give up if there is more than one
+  indexInterfaceImplementations();
+  const auto it = interfaceImplementations.find(spiceInterface);
+  const Struct *implementation = it != interfaceImplementations.end() ? it->second : nullptr;
+
+  // If the struct is not used, there can be no instances of it. If the struct implements multiple interfaces, the method
+  // does not necessarily sit in the slot of the interface method
+  if (implementation == nullptr || !implementation->used || implementation->interfaceTypes.size() != 1)
+    return nullptr;
+
+  // Pick the method from the VTable slot, the virtual call would have used
+  const std::vector<const Function *> virtualMethods = implementation->scope->getVirtualMethods();
+  if (data.callee->vtableIndex >= virtualMethods.size())
+    return nullptr;
+  const Function *method = virtualMethods.at(data.callee->vtableIndex);
+  assert(method->name == data.callee->name);
+
+  // Private methods can only be referenced from the source file, that emits them
+  const bool isPublic = method->entry->getQualType().isPublic();
+  if (!isPublic && (implementation->scope->sourceFile != sourceFile || !method->used))
+    return nullptr;
+
+  return method;
+}
+
+/**
+ * Collect the implementing struct for each interface of the program. The type checker is done with all source files at
+ * this point, so the index is built on the first devirtualization attempt and reused for all following call sites.
+ */
+void IRGenerator::indexInterfaceImplementations() {
+  if (interfaceImplementationsIndexed)
+    return;
+  interfaceImplementationsIndexed = true;
+
+  for (const auto &sourceFile : resourceManager.sourceFiles | std::views::values) {
+    for (StructManifestationList &manifestations : sourceFile->globalScope->structs | std::views::values) {
+      for (const Struct &spiceStruct : manifestations | std::views::values) {
+        if (!spiceStruct.isFullySubstantiated())
+          continue;
+        for (const QualType &interfaceType : spiceStruct.interfaceTypes) {
+          const Interface *spiceInterface = interfaceType.getInterface(nullptr);
+          assert(spiceInterface != nullptr);
+          // A second implementation of the same interface rules out devirtualization
+          const auto [it, inserted] = interfaceImplementations.emplace(spiceInterface, &spiceStruct);
+          if (!inserted)
+            it->second = nullptr;
+        }
+      }
+    }
+  }
+}
+
 } // namespace spice::compiler
\ No newline at end of file
@@ -64,6 +64,17 @@ std::any IRGenerator::visitFctCall(const FctCallNode *node) {
 
   const FctCallNode::FctCallData &data = node->data.at(manIdx);
 
+  // Check if the call to a compile-time function was already evaluated
+  const QualType returnType = node->getEvaluatedSymbolType(manIdx);
+  if (data.hasCompileTimeValue())
+    return LLVMExprResult{.constant = getConst(data.compileTimeValue, returnType, node)};
+  if (data.compileTimeArrayItemsSet) {
+    size_t itemIdx = 0;
+    llvm::Constant *constantArray = getConstArray(data.compileTimeArrayItems, itemIdx, returnType, node);
+    llvm::Value *arrayAddr = createGlobalConst(ANON_GLOBAL_ARRAY_NAME, constantArray);
+    return LLVMExprResult{.constant = constantArray, .ptr = arrayAddr};
+  }
+
   const Function *spiceFunc = data.callee;
   assert(data.isFctPtrCall() || spiceFunc != nullptr); // If not a function pointer call, we must have a function
   std::string mangledName;
@@ -139,14 +150,21 @@ std::any IRGenerator::visitFctCall(const FctCallNode *node) {
   // Non-capturing lambdas and plain function references ignore it. This lets a lambda be called without the call
   // site knowing statically whether it captures (e.g. when it was retrieved from the std Lambda wrapper).
   llvm::Value *fctPtr = nullptr;
+  llvm::Function *directLambda = nullptr;
   if (data.isFctPtrCall()) {
+    // If the function pointer can only point to the lambda it was initialized with, call the lambda directly
+    directLambda = getDirectlyCallableLambda(data, firstFragEntry);
     llvm::Value *fatPtr = getAddress(firstFragEntry);
     // Load fctPtr
     fctPtr = insertStructGEP(llvmTypes.lambdaFatPtrType, fatPtr, 0);
-    // Load the captures pointer and add it to the argument list
-    llvm::Value *capturesPtrPtr = insertStructGEP(llvmTypes.lambdaFatPtrType, fatPtr, 1);
-    llvm::Value *capturesPtr = insertLoad(builder.getPtrTy(), capturesPtrPtr, false, CAPTURES_PARAM_NAME);
-    argValues.push_back(capturesPtr);
+    // Load the captures pointer and add it to the argument list. Lambdas without captures ignore it anyway
+    if (directLambda != nullptr && data.calleeLambda->bodyScope->symbolTable.captures.empty()) {
+      argValues.push_back(llvm::PoisonValue::get(builder.getPtrTy()));
+    } else {
+      llvm::Value *capturesPtrPtr = insertStructGEP(llvmTypes.lambdaFatPtrType, fatPtr, 1);
+      llvm::Value *capturesPtr = insertLoad(builder.getPtrTy(), capturesPtrPtr, false, CAPTURES_PARAM_NAME);
+      argValues.push_back(capturesPtr);
+    }
   }
 
   // Get arg values
@@ -219,7 +237,8 @@ std::any IRGenerator::visitFctCall(const FctCallNode *node) {
       returnSType = firstFragEntry->getQualType().getBase().getFunctionReturnType();
     paramSTypes = firstFragEntry->getQualType().getBase().getFunctionParamTypes();
   } else {
-    returnSType = spiceFunc->returnType;
+    // Calling an async function yields a future to its result
+    returnSType = spiceFunc->isAsync ? spiceFunc->futureType : spiceFunc->returnType;
     paramSTypes = spiceFunc->getParamTypes();
   }
 
@@ -249,11 +268,20 @@ std::any IRGenerator::visitFctCall(const FctCallNode *node) {
   assert(fctType != nullptr);
 
   llvm::CallInst *callInst;
-  if (data.isVirtualMethodCall()) {
+  if (const Function *devirtualizedCallee = data.isVirtualMethodCall() ? getDevirtualizedCallee(data) : nullptr) {
+    assert(thisPtr != nullptr);
+    // There is only one possible implementation -> call it directly to make it inlinable
+    const llvm::FunctionCallee callee = module->getOrInsertFunction(devirtualizedCallee->getMangledName(), fctType);
+
+    // Generate function call
+    callInst = builder.CreateCall(callee, argValues);
+  } else if (data.isVirtualMethodCall()) {
     assert(data.callee->isVirtual);
     assert(thisPtr != nullptr);
     // Load VTable
     llvm::Value *vtablePtr = insertLoad(builder.getPtrTy(), thisPtr, false, "vtable.addr");
+    if (cliOptions.useLTO && cliOptions.devirtualize)
+      generateVTableTypeTest(vtablePtr, data.thisType.getBase());
     const size_t vtableIndex = data.callee->vtableIndex;
     // Lookup function pointer in VTable
     fctPtr = insertInBoundsGEP(builder.getPtrTy(), vtablePtr, builder.getInt64(vtableIndex), "vfct.addr");
@@ -261,6 +289,9 @@ std::any IRGenerator::visitFctCall(const FctCallNode *node) {
 
     // Generate function call
     callInst = builder.CreateCall({fctType, fct}, argValues);
+  } else if (directLambda != nullptr && directLambda->getFunctionType() == fctType) {
+    // There is only one possible lambda -> call it directly to make it inlinable
+    callInst = builder.CreateCall(directLambda, argValues);
   } else if (data.isFctPtrCall()) {
     assert(firstFragEntry != nullptr);
     QualType firstFragType = firstFragEntry->getQualType();
@@ -335,6 +366,16 @@ void IRGenerator::setCallArgAttrs(llvm::CallInst *callInst, const Function *spic
       callInst->addDereferenceableParamAttr(i, callInst->getModule()->getDataLayout().getTypeStoreSize(pointeeType));
       // Alignment attribute
       callInst->addParamAttr(i, llvm::Attribute::getWithAlignment(context, module->getDataLayout().getABITypeAlign(pointeeType)));
+    } else if (paramType.isRef() && cliOptions.useRefParamAttrs) {
+      // References are always bound to a valid object
+      llvm::Type *referencedType = paramType.getContained().toLLVMType(sourceFile);
+      assert(referencedType != nullptr);
+      if (referencedType->isSized()) {
+        callInst->addParamAttr(i, llvm::Attribute::NonNull);
+        callInst->addDereferenceableParamAttr(i, module->getDataLayout().getTypeStoreSize(referencedType));
+        const llvm::Align alignment = module->getDataLayout().getABITypeAlign(referencedType);
+        callInst->addParamAttr(i, llvm::Attribute::getWithAlignment(context, alignment));
+      }
     }
 
     // ZExt or SExt attribute
@@ -536,7 +577,7 @@ std::any IRGenerator::visitLambdaFunc(const LambdaFuncNode *node) {
   llvm::Type *returnType = spiceFunc.returnType.toLLVMType(sourceFile);
 
   // Create function or implement declared function
-  spiceFunc.mangleSuffix = "." + std::to_string(manIdx);
+  spiceFunc.setMangleSuffix("." + std::to_string(manIdx));
   const std::string mangledName = spiceFunc.getMangledName();
   llvm::FunctionType *funcType = llvm::FunctionType::get(returnType, paramTypes, false);
   module->getOrInsertFunction(mangledName, funcType);
@@ -692,7 +733,7 @@ std::any IRGenerator::visitLambdaProc(const LambdaProcNode *node) {
   }
 
   // Create function or implement declared function
-  spiceFunc.mangleSuffix = "." + std::to_string(manIdx);
+  spiceFunc.setMangleSuffix("." + std::to_string(manIdx));
   const std::string mangledName = spiceFunc.getMangledName();
   llvm::FunctionType *funcType = llvm::FunctionType::get(builder.getVoidTy(), paramTypes, false);
   module->getOrInsertFunction(mangledName, funcType);
@@ -1024,7 +1065,11 @@ llvm::Value *IRGenerator::buildFatFctPtr(Scope *bodyScope, llvm::Type *capturesS
       }
     } else {
       capturesPtr = insertAlloca(capturesStructType, CAPTURES_PARAM_NAME);
-      captureStructSize = module->getDataLayout().getTypeAllocSize(capturesStructType);
+      const llvm::DataLayout &dataLayout = module->getDataLayout();
+      captureStructSize = dataLayout.getTypeAllocSize(capturesStructType);
+      // The std Lambda type stores small capture structs inline, but can only guarantee pointer alignment there
+      if (dataLayout.getABITypeAlign(capturesStructType) > dataLayout.getPointerABIAlignment(0))
+        captureStructSize |= OVER_ALIGNED_CAPTURES_FLAG;
       size_t captureIdx = 0;
       for (const auto &capture : bodyScope->symbolTable.captures | std::views::values) {
         const SymbolTableEntry *capturedEntry = capture.capturedSymbol;
@@ -1057,6 +1102,19 @@ llvm::Value *IRGenerator::buildFatFctPtr(Scope *bodyScope, llvm::Type *capturesS
   return fatFctPtr;
 }
 
+llvm::Function *IRGenerator::getDirectlyCallableLambda(const FctCallNode::FctCallData &data,
+                                                       const SymbolTableEntry *fctPtrEntry) const {
+  assert(data.isFctPtrCall());
+  // Only if the function pointer is called and never used otherwise, it still points to the lambda it was initialized with
+  if (!cliOptions.directLambdaCalls || data.calleeLambda == nullptr || fctPtrEntry->escapes)
+    return nullptr;
+
+  // The lambda was already generated, because its declaration precedes the call
+  Function spiceFunc = data.calleeLambda->manifestations.at(manIdx);
+  spiceFunc.setMangleSuffix("." + std::to_string(manIdx));
+  return module->getFunction(spiceFunc.getMangledName());
+}
+
 llvm::Type *IRGenerator::buildCapturesContainerType(const CaptureMap &captures) const {
   assert(!captures.empty());
 
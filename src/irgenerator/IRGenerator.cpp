@@ -52,6 +52,9 @@ std::any IRGenerator::visitEntry(const EntryNode *node) {
   // Generate test main if required
   if (sourceFile->isMainFile && cliOptions.generateTestMain)
     generateTestMain();
+  // Generate bench main if required
+  if (sourceFile->isMainFile && cliOptions.generateBenchMain)
+    generateBenchMain();
 
   // Execute deferred VTable initializations
   for (DeferredLogic &deferredVTableInit : deferredVTableInitializations)
@@ -113,7 +116,7 @@ llvm::LoadInst *IRGenerator::insertLoad(const QualType &qualType, llvm::Value *p
   llvm::Type *llvmType = qualType.toLLVMType(sourceFile);
   llvm::LoadInst *load = insertLoad(llvmType, ptr, isVolatile, varName);
   if (cliOptions.useTBAAMetadata)
-    mdGenerator.generateTBAAMetadata(load, qualType);
+    mdGenerator.generateTBAAMetadata(load);
   return load;
 }
 
@@ -125,7 +128,7 @@ llvm::StoreInst *IRGenerator::insertStore(llvm::Value *val, llvm::Value *ptr, bo
 void IRGenerator::insertStore(llvm::Value *val, llvm::Value *ptr, const QualType &qualType, bool isVolatile) {
   llvm::StoreInst *store = insertStore(val, ptr, isVolatile);
   if (cliOptions.useTBAAMetadata)
-    mdGenerator.generateTBAAMetadata(store, qualType);
+    mdGenerator.generateTBAAMetadata(store);
 }
 
 llvm::Value *IRGenerator::insertInBoundsGEP(llvm::Type *type, llvm::Value *basePtr, llvm::ArrayRef<llvm::Value *> indices,
@@ -252,6 +255,10 @@ llvm::Constant *IRGenerator::getDefaultValueForSymbolType(const QualType &symbol
   if (symbolType.isOneOf({TY_PTR, TY_REF}))
     return llvm::Constant::getNullValue(builder.getPtrTy());
 
+  // SIMD vector
+  if (symbolType.isVector())
+    return llvm::Constant::getNullValue(symbolType.toLLVMType(sourceFile));
+
   // Array
   if (symbolType.isArray()) {
     // Get array size
@@ -346,6 +353,29 @@ llvm::Constant *IRGenerator::getConst(const CompileTimeValue &compileTimeValue,
   throw CompilerError(UNHANDLED_BRANCH, "Constant fall-through"); // GCOV_EXCL_LINE
 }
 
+/**
+ * Build a constant array from a list of scalars in memory order, e.g. from the result of a compile-time function
+ *
+ * @param items Flattened items of the (multi-dimensional) array
+ * @param itemIdx Index of the next item to consume
+ * @param type Array type
+ * @param node AST node for string constants
+ * @return Constant array
+ */
+llvm::Constant *IRGenerator::getConstArray(const std::vector<CompileTimeValue> &items, // NOLINT(misc-no-recursion)
+                                           size_t &itemIdx, const QualType &type, const ASTNode *node) const {
+  if (!type.isArray())
+    return getConst(items.at(itemIdx++), type, node);
+
+  const QualType itemType = type.getContained();
+  std::vector<llvm::Constant *> constants;
+  constants.reserve(type.getArraySize());
+  for (unsigned int i = 0; i < type.getArraySize(); i++)
+    constants.push_back(getConstArray(items, itemIdx, itemType, node));
+  llvm::ArrayType *arrayType = llvm::ArrayType::get(itemType.toLLVMType(sourceFile), type.getArraySize());
+  return llvm::ConstantArray::get(arrayType, constants);
+}
+
 llvm::BasicBlock *IRGenerator::createBlock(const std::string &blockName /*=""*/) const {
   return llvm::BasicBlock::Create(context, blockName);
 }
@@ -367,22 +397,24 @@ void IRGenerator::terminateBlock(const StmtLstNode *stmtLstNode) {
   blockAlreadyTerminated = true;
 }
 
-void IRGenerator::insertJump(llvm::BasicBlock *targetBlock) {
+llvm::Instruction *IRGenerator::insertJump(llvm::BasicBlock *targetBlock) {
   if (blockAlreadyTerminated)
-    return;
-  builder.CreateBr(targetBlock);
+    return nullptr;
+  llvm::Instruction *jumpInst = builder.CreateBr(targetBlock);
   blockAlreadyTerminated = true;
+  return jumpInst;
 }
 
-void IRGenerator::insertCondJump(llvm::Value *condition, llvm::BasicBlock *trueBlock, llvm::BasicBlock *falseBlock,
-                                 Likelihood likelihood /*=UNSPECIFIED*/) {
+llvm::Instruction *IRGenerator::insertCondJump(llvm::Value *condition, llvm::BasicBlock *trueBlock, llvm::BasicBlock *falseBlock,
+                                               Likelihood likelihood /*=UNSPECIFIED*/) {
   if (blockAlreadyTerminated)
-    return;
+    return nullptr;
   llvm::CondBrInst *jumpInst = builder.CreateCondBr(condition, trueBlock, falseBlock);
   blockAlreadyTerminated = true;
 
   if (likelihood != Likelihood::UNSPECIFIED)
     mdGenerator.generateBranchWeightsMetadata(jumpInst, likelihood);
+  return jumpInst;
 }
 
 void IRGenerator::verifyFunction(const llvm::Function *fct, const CodeLoc &codeLoc) const {
@@ -25,6 +25,9 @@ class Function;
 const char *const ANON_GLOBAL_STRING_NAME = "anon.string.";
 const char *const ANON_GLOBAL_ARRAY_NAME = "anon.array.";
 const char *const CAPTURES_PARAM_NAME = "captures";
+constexpr uint64_t OVER_ALIGNED_CAPTURES_FLAG = 1ull << 63; // Must match the flag in std/type/lambda
+constexpr uint64_t CORO_STATE_DETACHED = 1; // Nobody is interested in the result, the coroutine frees itself
+constexpr uint64_t CORO_STATE_DONE = 2;     // The coroutine has completed and the result is available
 extern const std::string PRODUCER_STRING;
 
 enum class Likelihood : uint8_t {
@@ -153,15 +156,35 @@ public:
   std::any visitBuiltinSyscallCall(const FctCallNode *node);
   std::any visitBuiltinNewCall(const FctCallNode *node);
   std::any visitBuiltinPlacementNewCall(const FctCallNode *node);
+  std::any visitBuiltinPtrToIntCall(const FctCallNode *node);
+  std::any visitBuiltinAtomicLoadCall(const FctCallNode *node);
+  std::any visitBuiltinAtomicStoreCall(const FctCallNode *node);
+  std::any visitBuiltinAtomicRMWCall(const FctCallNode *node);
+  std::any visitBuiltinAtomicCompareExchangeCall(const FctCallNode *node);
+  std::any visitBuiltinAtomicFenceCall(const FctCallNode *node);
+  std::any visitBuiltinSimdSplatCall(const FctCallNode *node);
+  std::any visitBuiltinSimdLoadCall(const FctCallNode *node);
+  std::any visitBuiltinSimdStoreCall(const FctCallNode *node);
+  std::any visitBuiltinSimdSelectCall(const FctCallNode *node);
+  std::any visitBuiltinSimdShuffleCall(const FctCallNode *node);
+  std::any visitBuiltinSimdReduceCall(const FctCallNode *node);
+  std::any visitBuiltinCoroSuspendCall(const FctCallNode *node);
+  std::any visitBuiltinCoroResumeCall(const FctCallNode *node);
+  std::any visitBuiltinCoroDestroyCall(const FctCallNode *node);
+  std::any visitBuiltinCoroDoneCall(const FctCallNode *node);
+  std::any visitBuiltinCoroDetachCall(const FctCallNode *node);
+  std::any visitBuiltinCoroResultCall(const FctCallNode *node);
 
 private:
   // Private methods
   llvm::Constant *getConst(const CompileTimeValue &compileTimeValue, const QualType &type, const ASTNode *node) const;
+  llvm::Constant *getConstArray(const std::vector<CompileTimeValue> &items, size_t &itemIdx, const QualType &type,
+                                const ASTNode *node) const;
   llvm::BasicBlock *createBlock(const std::string &blockName = "") const;
   void switchToBlock(llvm::BasicBlock *block, llvm::Function *parentFct = nullptr);
   void terminateBlock(const StmtLstNode *stmtLstNode);
-  void insertJump(llvm::BasicBlock *targetBlock);
-  void insertCondJump(llvm::Value *condition, llvm::BasicBlock *trueBlock, llvm::BasicBlock *falseBlock,
+  llvm::Instruction *insertJump(llvm::BasicBlock *targetBlock);
+  llvm::Instruction *insertCondJump(llvm::Value *condition, llvm::BasicBlock *trueBlock, llvm::BasicBlock *falseBlock,
                       Likelihood likelihood = Likelihood::UNSPECIFIED);
   void verifyFunction(const llvm::Function *fct, const CodeLoc &codeLoc) const;
   void verifyModule(const CodeLoc &codeLoc) const;
@@ -182,6 +205,7 @@ private:
   llvm::Value *buildFatFctPtr(Scope *bodyScope, llvm::Type *capturesStructType, llvm::Value *lambda);
   llvm::Function *getOrCreateFatFctPtrThunk(llvm::Function *target);
   llvm::Type *buildCapturesContainerType(const CaptureMap &captures) const;
+  llvm::Function *getDirectlyCallableLambda(const FctCallNode::FctCallData &data, const SymbolTableEntry *fctPtrEntry) const;
   void unpackCapturesToLocalVariables(const CaptureMap &captures, llvm::Value *val, llvm::Type *structType);
   bool bindDecayedArrayParam(llvm::Argument &arg, const std::string &paramName, const SymbolTableEntry *paramSymbol);
   llvm::Value *materializeDecayedArrayArg(llvm::Value *argValue, const QualType &paramType);
@@ -195,6 +219,8 @@ private:
   llvm::GlobalValue::LinkageTypes getVTableLinkageType(bool isPublic) const;
   void attachComdatToSymbol(llvm::GlobalVariable *global, const std::string &comdatName, bool isPublic) const;
   void addCommonFctAttrs(llvm::Function *fct, bool isAlwaysInline = false) const;
+  llvm::Value *generateAtomicOp(const ExprNode *orderNode, llvm::Type *resultType,
+                               const std::function<llvm::Value *(llvm::AtomicOrdering)> &generateOp);
 
   // Generate implicit
   llvm::Value *doImplicitCast(llvm::Value *src, QualType dstSTy, QualType srcSTy);
@@ -219,6 +245,7 @@ private:
   void generateDtorBodyPreamble(const Function *dtorFunction);
   void generateDefaultDtor(const Function *dtorFunction);
   void generateTestMain();
+  void generateBenchMain();
 
   // Generate target dependent
   std::string getSysCallAsmString(uint8_t numRegs) const;
@@ -229,10 +256,28 @@ private:
   llvm::Constant *generateTypeInfo(StructBase *spiceStruct) const;
   llvm::Constant *generateVTable(StructBase *spiceStruct) const;
   void generateVTableInitializer(const StructBase *spiceStruct);
+  void attachVTableTypeMetadata(llvm::GlobalVariable *vtable, const StructBase *spiceStruct) const;
+  void generateVTableTypeTest(llvm::Value *vtablePtr, const QualType &interfaceType);
+  const Function *getDevirtualizedCallee(const FctCallNode::FctCallData &data);
+  void indexInterfaceImplementations();
 
   // Generate code instrumentation
   void enableFunctionInstrumentation(llvm::Function *function) const;
 
+  // Generate coroutines
+  llvm::Value *generateCoroPrologue(const Function *spiceFunc, llvm::Function *func);
+  void generateCoroReturn(llvm::Value *returnValue);
+  void generateCoroEpilogue(const Function *spiceFunc);
+  void generateCoroSuspend(llvm::Value *saveToken, llvm::BasicBlock *resumeBlock, const ASTNode *node);
+  void generateCoroDestroyCleanup(const ASTNode *node);
+  llvm::Value *generateCoroAwait(llvm::Value *frame, const QualType &resultType, const ASTNode *node);
+  void generateCoroResume(llvm::Value *frame);
+  [[nodiscard]] llvm::Value *getCoroPromise(llvm::Value *frame, llvm::StructType *promiseType) const;
+  [[nodiscard]] llvm::StructType *getCoroPromiseType(const QualType &resultType) const;
+  [[nodiscard]] llvm::GlobalVariable *getCoroNextHandleGlobal() const;
+  [[nodiscard]] bool isInCoroutine() const;
+  llvm::Value *getCoroStateAddr(const FctCallNode *node, llvm::Value *frame = nullptr);
+
   // Private members
   llvm::LLVMContext &context;
   llvm::IRBuilder<> &builder;
@@ -251,10 +296,22 @@ private:
   llvm::AllocaInst *allocaInsertInst = nullptr;
   bool blockAlreadyTerminated = false;
   bool isInCtorBody = false;
+  struct CoroutineState {
+    llvm::Function *fct = nullptr;        // Coroutine, that is currently generated
+    llvm::Value *id = nullptr;            // Token, returned by llvm.coro.id
+    llvm::Value *handle = nullptr;        // Handle to the coroutine frame
+    llvm::Value *promise = nullptr;       // Promise, that is shared with the awaiting side: { state, result }
+    llvm::StructType *promiseType = nullptr;
+    llvm::BasicBlock *finalBlock = nullptr;   // Completes the coroutine and hands control to the awaiting side
+    llvm::BasicBlock *cleanupBlock = nullptr; // Frees the coroutine frame
+    llvm::BasicBlock *suspendBlock = nullptr; // Returns to the caller or resumer of the coroutine
+  } coroutine;
   std::vector<DeferredLogic> deferredVTableInitializations;
   // IR-side state: separate from semantic objects to keep the type-checker model clean
   std::unordered_map<const SymbolTableEntry *, std::stack<llvm::Value *>> addressMap;
   std::unordered_map<const Function *, llvm::Function *> llvmFunctions;
+  std::unordered_map<const Interface *, const Struct *> interfaceImplementations; // nullptr for multiple implementations
+  bool interfaceImplementationsIndexed = false;
 };
 
 } // namespace spice::compiler
\ No newline at end of file
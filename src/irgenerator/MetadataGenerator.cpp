@@ -2,10 +2,14 @@
 
 #include "MetadataGenerator.h"
 
+#include <ast/Attributes.h>
 #include <global/TypeRegistry.h>
 #include <irgenerator/IRGenerator.h>
+#include <symboltablebuilder/Scope.h>
 
+#include <llvm/IR/Instructions.h>
 #include <llvm/IR/Module.h>
+#include <llvm/Support/raw_ostream.h>
 
 namespace spice::compiler {
 
@@ -20,6 +24,63 @@ void MetadataGenerator::generateBranchWeightsMetadata(llvm::CondBrInst *jumpInst
   jumpInst->setMetadata(llvm::LLVMContext::MD_prof, profMetadata);
 }
 
+/**
+ * Attach the loop hints, that were requested via the attributes of the surrounding function, to the back edge of a loop
+ *
+ * @param backEdge Branch instruction, that jumps back to the loop header
+ * @param loopNode AST node of the loop
+ */
+void MetadataGenerator::generateLoopMetadata(llvm::Instruction *backEdge, const ASTNode *loopNode) const {
+  // Skip if the body of the loop terminates on all control paths
+  if (!backEdge)
+    return;
+
+  // Find the attributes of the surrounding function, procedure or lambda
+  const AttrLstNode *attrs = nullptr;
+  for (const ASTNode *node = loopNode->parent; node != nullptr; node = node->parent) {
+    if (const auto *mainFctDef = dynamic_cast<const MainFctDefNode *>(node)) {
+      attrs = mainFctDef->attrs ? mainFctDef->attrs->attrLst : nullptr;
+      break;
+    }
+    if (const auto *fctDef = dynamic_cast<const FctDefBaseNode *>(node)) {
+      attrs = fctDef->attrs ? fctDef->attrs->attrLst : nullptr;
+      break;
+    }
+    if (const auto *lambdaFunc = dynamic_cast<const LambdaFuncNode *>(node)) {
+      attrs = lambdaFunc->lambdaAttr ? lambdaFunc->lambdaAttr->attrLst : nullptr;
+      break;
+    }
+    if (const auto *lambdaProc = dynamic_cast<const LambdaProcNode *>(node)) {
+      attrs = lambdaProc->lambdaAttr ? lambdaProc->lambdaAttr->attrLst : nullptr;
+      break;
+    }
+  }
+  if (!attrs)
+    return;
+
+  // Collect the loop hints
+  llvm::LLVMContext &context = irGenerator->context;
+  std::vector<llvm::Metadata *> loopProperties = {nullptr}; // The first operand references the loop id itself
+  const CompileTimeValue *vectorizeWidth = attrs->getAttrValueByName(ATTR_VECTORIZE_WIDTH);
+  const CompileTimeValue *vectorize = attrs->getAttrValueByName(ATTR_VECTORIZE);
+  if (vectorize || vectorizeWidth) {
+    const bool enable = vectorize ? vectorize->boolValue : vectorizeWidth->intValue > 1;
+    llvm::Metadata *enableValue = mdBuilder.createConstant(irGenerator->builder.getInt1(enable));
+    loopProperties.push_back(llvm::MDNode::get(context, {mdBuilder.createString("llvm.loop.vectorize.enable"), enableValue}));
+  }
+  if (vectorizeWidth) {
+    llvm::Metadata *widthValue = mdBuilder.createConstant(irGenerator->builder.getInt32(vectorizeWidth->intValue));
+    loopProperties.push_back(llvm::MDNode::get(context, {mdBuilder.createString("llvm.loop.vectorize.width"), widthValue}));
+  }
+  if (loopProperties.size() == 1)
+    return;
+
+  // Create a distinct, self-referencing loop id
+  llvm::MDNode *loopId = llvm::MDNode::getDistinct(context, loopProperties);
+  loopId->replaceOperandWith(0, loopId);
+  backEdge->setMetadata(llvm::LLVMContext::MD_loop, loopId);
+}
+
 void MetadataGenerator::generateTypeMetadata(llvm::Instruction *inst, const QualType &type) {
   const uint64_t typeHash = TypeRegistry::getTypeHash(*type.getType());
 
@@ -30,9 +91,25 @@ void MetadataGenerator::generateTypeMetadata(llvm::Instruction *inst, const Qual
   inst->setMetadata(llvm::LLVMContext::MD_type, typeMetadata);
 }
 
-void MetadataGenerator::generateTBAAMetadata(llvm::Instruction *inst, const QualType &type) {
-  const std::string typeName = type.getName(true, true);
-  llvm::MDNode *tbaaTypeNode = mdBuilder.createTBAAScalarTypeNode(typeName, omnipotentByte);
+void MetadataGenerator::generateTBAAMetadata(llvm::Instruction *inst) {
+  // Aggregates get no access tag. A scalar tag for them would tell LLVM, that they do not alias with their own fields
+  llvm::MDNode *tbaaTypeNode = getTBAAScalarTypeNode(llvm::getLoadStoreType(inst));
+  if (!tbaaTypeNode)
+    return;
+
+  // Lanes get no access tag either, because they share their memory with the untagged vector
+  const llvm::Value *ptr = llvm::getLoadStorePointerOperand(inst);
+  resetFieldAccessesOnFunctionChange();
+  if (vectorLaneAddresses.contains(ptr))
+    return;
+
+  // Use the struct-path access tag, if the instruction accesses a struct field with a matching type
+  const FieldAccess *fieldAccess = lookupFieldAccess(ptr);
+  if (fieldAccess != nullptr && fieldAccess->accessType == tbaaTypeNode) {
+    inst->setMetadata(llvm::LLVMContext::MD_tbaa, fieldAccess->accessTag);
+    return;
+  }
+
   // Seems so new, that the verifier does not accept it
   //const llvm::TypeSize typeSize = irGenerator->module->getDataLayout().getTypeAllocSize(llvmType);
   //const bool isImmutable = type.isConst();
@@ -43,4 +120,126 @@ void MetadataGenerator::generateTBAAMetadata(llvm::Instruction *inst, const Qual
   inst->setMetadata(llvm::LLVMContext::MD_tbaa, tbaaAccessTag);
 }
 
+void MetadataGenerator::registerFieldAccess(llvm::Value *fieldAddress, const QualType &structType,
+                                            const std::vector<size_t> &indexPath, const QualType &fieldType) {
+  // Only scalar fields can be accessed via struct-path tags
+  if (fieldType.isRef())
+    return;
+  llvm::MDNode *accessType = getTBAAScalarTypeNode(fieldType.toLLVMType(irGenerator->sourceFile));
+  if (!accessType)
+    return;
+
+  // Accumulate the offset of the field within the outermost struct
+  const llvm::DataLayout &dataLayout = irGenerator->module->getDataLayout();
+  uint64_t offset = 0;
+  QualType currentType = structType;
+  for (const size_t index : indexPath) {
+    auto *llvmStructType = llvm::cast<llvm::StructType>(currentType.toLLVMType(irGenerator->sourceFile));
+    offset += dataLayout.getStructLayout(llvmStructType)->getElementOffset(index);
+    const SymbolTableEntry *fieldEntry = currentType.getBodyScope()->lookupField(index);
+    assert(fieldEntry != nullptr && fieldEntry->isField());
+    currentType = fieldEntry->getQualType();
+  }
+
+  llvm::MDNode *baseType = getTBAAStructTypeNode(structType);
+  llvm::MDNode *accessTag = mdBuilder.createTBAAStructTagNode(baseType, accessType, offset);
+  resetFieldAccessesOnFunctionChange();
+  fieldAccesses[fieldAddress] = FieldAccess{accessType, accessTag};
+}
+
+void MetadataGenerator::registerVectorLaneAccess(llvm::Value *laneAddress) {
+  resetFieldAccessesOnFunctionChange();
+  vectorLaneAddresses.insert(laneAddress);
+}
+
+/**
+ * The field accesses are keyed by the address values of the current function. Values of other functions may already be
+ * freed and their memory reused for new values, so the recorded accesses are dropped as soon as another function is generated.
+ */
+void MetadataGenerator::resetFieldAccessesOnFunctionChange() {
+  const llvm::Function *currentFunction = irGenerator->builder.GetInsertBlock()->getParent();
+  if (currentFunction == fieldAccessesFunction)
+    return;
+  fieldAccesses.clear();
+  vectorLaneAddresses.clear();
+  fieldAccessesFunction = currentFunction;
+}
+
+const MetadataGenerator::FieldAccess *MetadataGenerator::lookupFieldAccess(const llvm::Value *fieldAddress) {
+  resetFieldAccessesOnFunctionChange();
+  const auto it = fieldAccesses.find(fieldAddress);
+  return it != fieldAccesses.end() ? &it->second : nullptr;
+}
+
+/**
+ * Get the TBAA type node for a scalar type. The nodes are keyed by the LLVM type, so that qualifiers (const, signed, etc.)
+ * and aliases do not result in distinct nodes for the same memory. Like in C, byte and char may alias with everything.
+ *
+ * @param type LLVM type
+ * @return TBAA type node or nullptr for aggregate types
+ */
+llvm::MDNode *MetadataGenerator::getTBAAScalarTypeNode(llvm::Type *type) {
+  if (type->isAggregateType() || type->isVectorTy())
+    return nullptr;
+  if (type->isIntegerTy(8))
+    return omnipotentByte;
+  if (const auto it = scalarTypeNodes.find(type); it != scalarTypeNodes.end())
+    return it->second;
+
+  std::string typeName;
+  if (type->isPointerTy()) {
+    typeName = "any pointer";
+  } else if (type->isIntegerTy(1)) {
+    typeName = "bool";
+  } else if (type->isIntegerTy(16)) {
+    typeName = "short";
+  } else if (type->isIntegerTy(32)) {
+    typeName = "int";
+  } else if (type->isIntegerTy(64)) {
+    typeName = "long";
+  } else if (type->isDoubleTy()) {
+    typeName = "double";
+  } else {
+    llvm::raw_string_ostream typeNameStream(typeName);
+    type->print(typeNameStream);
+  }
+  llvm::MDNode *typeNode = mdBuilder.createTBAAScalarTypeNode(typeName, omnipotentByte);
+  scalarTypeNodes.emplace(type, typeNode);
+  return typeNode;
+}
+
+llvm::MDNode *MetadataGenerator::getTBAAStructTypeNode(const QualType &structType) { // NOLINT(*-no-recursion)
+  assert(structType.is(TY_STRUCT));
+  auto *llvmStructType = llvm::cast<llvm::StructType>(structType.toLLVMType(irGenerator->sourceFile));
+  if (const auto it = structTypeNodes.find(llvmStructType); it != structTypeNodes.end())
+    return it->second;
+
+  // Collect the type nodes of all fields, including the implicit ones, together with their offsets
+  const llvm::StructLayout *structLayout = irGenerator->module->getDataLayout().getStructLayout(llvmStructType);
+  Scope *structScope = structType.getBodyScope();
+  std::vector<std::pair<llvm::MDNode *, uint64_t>> fields;
+  for (size_t i = 0; i < structScope->getFieldCount(); i++) {
+    const SymbolTableEntry *fieldEntry = structScope->lookupField(i);
+    assert(fieldEntry != nullptr && fieldEntry->isField());
+    fields.emplace_back(getTBAAFieldTypeNode(fieldEntry->getQualType()), structLayout->getElementOffset(i));
+  }
+
+  llvm::MDNode *typeNode = mdBuilder.createTBAAStructTypeNode(llvmStructType->getName(), fields);
+  structTypeNodes.emplace(llvmStructType, typeNode);
+  return typeNode;
+}
+
+llvm::MDNode *MetadataGenerator::getTBAAFieldTypeNode(const QualType &fieldType) { // NOLINT(*-no-recursion)
+  // Arrays are represented by their item type
+  QualType baseType = fieldType;
+  while (baseType.isArray())
+    baseType = baseType.getContained();
+  // Nested structs get a struct type node on their own, so that accesses through them remain distinguishable
+  if (baseType.is(TY_STRUCT) && !baseType.isRef())
+    return getTBAAStructTypeNode(baseType);
+  // Other aggregates like vectors or function types may be accessed in any way
+  llvm::MDNode *scalarTypeNode = getTBAAScalarTypeNode(baseType.toLLVMType(irGenerator->sourceFile));
+  return scalarTypeNode ? scalarTypeNode : omnipotentByte;
+}
+
 } // namespace spice::compiler
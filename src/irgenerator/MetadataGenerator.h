@@ -2,6 +2,10 @@
 
 #pragma once
 
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include <llvm/IR/MDBuilder.h>
 
 // Forward declarations
@@ -12,6 +16,7 @@ class CondBrInst;
 namespace spice::compiler {
 
 // Forward declarations
+class ASTNode;
 class IRGenerator;
 enum class Likelihood : uint8_t;
 class QualType;
@@ -23,15 +28,37 @@ public:
 
   // Public methods
   void generateBranchWeightsMetadata(llvm::CondBrInst *jumpInst, Likelihood likeliness);
+  void generateLoopMetadata(llvm::Instruction *backEdge, const ASTNode *loopNode) const;
   void generateTypeMetadata(llvm::Instruction *inst, const QualType &type);
-  void generateTBAAMetadata(llvm::Instruction *inst, const QualType &type);
+  void generateTBAAMetadata(llvm::Instruction *inst);
+  void registerFieldAccess(llvm::Value *fieldAddress, const QualType &structType, const std::vector<size_t> &indexPath,
+                           const QualType &fieldType);
+  void registerVectorLaneAccess(llvm::Value *laneAddress);
 
 private:
+  // Private structs
+  struct FieldAccess {
+    llvm::MDNode *accessType;
+    llvm::MDNode *accessTag;
+  };
+
   // Private members
   IRGenerator *irGenerator;
   llvm::MDBuilder mdBuilder;
   llvm::MDNode *tbaaRoot;
   llvm::MDNode *omnipotentByte;
+  std::unordered_map<const llvm::Type *, llvm::MDNode *> scalarTypeNodes;
+  std::unordered_map<const llvm::StructType *, llvm::MDNode *> structTypeNodes;
+  std::unordered_map<const llvm::Value *, FieldAccess> fieldAccesses; // Only for the function below
+  std::unordered_set<const llvm::Value *> vectorLaneAddresses;         // Only for the function below
+  const llvm::Function *fieldAccessesFunction = nullptr;
+
+  // Private methods
+  void resetFieldAccessesOnFunctionChange();
+  [[nodiscard]] const FieldAccess *lookupFieldAccess(const llvm::Value *fieldAddress);
+  [[nodiscard]] llvm::MDNode *getTBAAScalarTypeNode(llvm::Type *type);
+  [[nodiscard]] llvm::MDNode *getTBAAStructTypeNode(const QualType &structType);
+  [[nodiscard]] llvm::MDNode *getTBAAFieldTypeNode(const QualType &fieldType);
 };
 
 } // namespace spice::compiler
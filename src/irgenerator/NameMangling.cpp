@@ -2,6 +2,8 @@
 
 #include "NameMangling.h"
 
+#include <charconv>
+
 #include <exception/CompilerError.h>
 #include <global/TypeNameDisambiguator.h>
 #include <model/Function.h>
@@ -32,6 +34,125 @@ static bool containsFctOrProcType(const QualType &type) {
 }
 #endif
 
+// Reusable buffers for the mangling runs. Mangling is not re-entrant, so one set of buffers per thread is sufficient
+static thread_local std::string outBuffer;
+static thread_local std::string expandedBuffer;
+static thread_local std::vector<std::pair</*expandedStart=*/size_t, /*length=*/size_t>> substitutionBuffer;
+
+NameMangling::Context::Context(std::string &out, std::string &expanded, std::vector<std::pair<size_t, size_t>> &substitutions)
+    : out(out), expanded(expanded), substitutions(substitutions) {}
+
+/**
+ * Append the given string to the output
+ *
+ * @param str Input string
+ */
+void NameMangling::Context::append(std::string_view str) const {
+  out.append(str);
+  expanded.append(str);
+}
+
+/**
+ * Append the given character to the output
+ *
+ * @param c Input character
+ */
+void NameMangling::Context::append(char c) const {
+  out.push_back(c);
+  expanded.push_back(c);
+}
+
+/**
+ * Append the decimal representation of the given number to the output
+ *
+ * @param number Input number
+ */
+void NameMangling::Context::append(size_t number) const {
+  char digits[20];
+  const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), number);
+  append(std::string_view(digits, result.ptr - digits));
+}
+
+/**
+ * Append the given character only to the expanded form, but not to the output
+ *
+ * @param c Input character
+ */
+void NameMangling::Context::appendExpandedOnly(char c) const { expanded.push_back(c); }
+
+/**
+ * Insert the given character into the output at the given position, without touching the expanded form
+ *
+ * @param pos Output position
+ * @param c Input character
+ */
+void NameMangling::Context::insertOutputOnly(size_t pos, char c) const { out.insert(out.begin() + static_cast<long>(pos), c); }
+
+/**
+ * Mark the start of a component, that is a candidate for the substitution table
+ *
+ * @return Component start
+ */
+NameMangling::Component NameMangling::Context::beginComponent() const { return {out.size(), expanded.size()}; }
+
+/**
+ * Mark the end of a component, that is a candidate for the substitution table.
+ * If an equal component was emitted before, the output of the component is replaced by a reference to it (S_, S0_, ...).
+ * Otherwise, the component is added to the substitution table.
+ * This can be called multiple times for the same component start, e.g. to register all prefixes of a nested name.
+ *
+ * @param component Component start
+ * @return Substituted or not
+ */
+bool NameMangling::Context::endComponent(const Component &component) const {
+  const std::string_view key(expanded.data() + component.expandedStart, expanded.size() - component.expandedStart);
+  for (size_t seqId = 0; seqId < substitutions.size(); seqId++) {
+    const auto &[expandedStart, length] = substitutions.at(seqId);
+    if (std::string_view(expanded.data() + expandedStart, length) != key)
+      continue;
+
+    // Replace the component output by the substitution. Sequence ids are base 36 numbers with upper case letters,
+    // starting with S_ for the first, S0_ for the second substitution and so on.
+    out.resize(component.outStart);
+    out.push_back('S');
+    if (seqId > 0) {
+      char digits[16];
+      size_t digitCount = 0;
+      for (size_t value = seqId - 1; digitCount == 0 || value > 0; value /= 36)
+        digits[digitCount++] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"[value % 36];
+      while (digitCount > 0)
+        out.push_back(digits[--digitCount]);
+    }
+    out.push_back('_');
+    return true;
+  }
+
+  substitutions.emplace_back(component.expandedStart, key.size());
+  return false;
+}
+
+/**
+ * Get the result of the mangling run
+ *
+ * @return Mangled name
+ */
+std::string NameMangling::Context::getResult() const { return out; }
+
+/**
+ * Create a fresh mangling context, which reuses the thread-local buffers of previous runs
+ *
+ * @param prefix Output prefix, e.g. _Z
+ * @return Mangling context
+ */
+NameMangling::Context NameMangling::createContext(std::string_view prefix) {
+  outBuffer.clear();
+  expandedBuffer.clear();
+  substitutionBuffer.clear();
+  const Context ctx(outBuffer, expandedBuffer, substitutionBuffer);
+  ctx.append(prefix);
+  return ctx;
+}
+
 /**
  * Mangle a function or procedure.
  * This should be mostly compatible with the C++ Itanium ABI name mangling scheme.
@@ -48,53 +169,59 @@ std::string NameMangling::mangleFunction(const Function &spiceFunc) {
   if (!spiceFunc.mangleFunctionName)
     return spiceFunc.name;
 
-  std::stringstream mangledName;
-  mangledName << "_Z";
+  const Context ctx = createContext("_Z");
 
   // This type
-  if (spiceFunc.isMethod()) {
-    mangledName << "N";
-    mangleType(mangledName, spiceFunc.thisType);
-  }
+  if (spiceFunc.isMethod())
+    ctx.append('N');
+  const Component namePrefix = ctx.beginComponent();
+  if (spiceFunc.isMethod())
+    mangleType(ctx, spiceFunc.thisType);
 
   // Function name
-  const std::string name = spiceFunc.name + spiceFunc.mangleSuffix;
-  mangledName << name.length() << name;
+  const std::string name = spiceFunc.name + spiceFunc.getMangleSuffix();
+  ctx.append(name.length());
+  ctx.append(name);
 
   // Template types
   bool isSelfGeneric = !spiceFunc.templateTypes.empty();
   if (spiceFunc.isMethod())
     isSelfGeneric = spiceFunc.templateTypes.size() > spiceFunc.thisType.getTemplateTypes().size();
   if (isSelfGeneric) {
-    mangledName << "I";
+    // The template name is a substitution candidate
+    ctx.endComponent(namePrefix);
+
+    ctx.append('I');
     // Template types themselves
     for (const GenericType &genericTemplateType : spiceFunc.templateTypes) {
       assert(spiceFunc.typeMapping.contains(genericTemplateType.getSubType()));
       const QualType &actualType = spiceFunc.typeMapping.at(genericTemplateType.getSubType());
-      mangleType(mangledName, actualType);
+      mangleType(ctx, actualType);
     }
-    mangledName << "E";
+    ctx.append('E');
 
     // Insert second end marker to end the nested type
     if (spiceFunc.isMethod())
-      mangledName << "E";
+      ctx.append('E');
 
     // Return type
     if (spiceFunc.isFunction())
-      mangleType(mangledName, spiceFunc.returnType);
+      mangleType(ctx, spiceFunc.returnType);
     else
-      mangledName << "v";
+      ctx.append('v');
   } else if (spiceFunc.isMethod()) {
-    mangledName << "E";
+    ctx.append('E');
   }
 
   // Parameter types
   for (const auto &[qualType, isOptional] : spiceFunc.paramList) {
     assert(!isOptional);
-    mangleType(mangledName, qualType);
+    mangleType(ctx, qualType);
   }
   if (spiceFunc.paramList.empty())
-    mangledName << "v";
+    ctx.append('v');
+
+  std::string mangledName = ctx.getResult();
 
 #ifndef NDEBUG
   const TypeMapping &typeMapping = spiceFunc.typeMapping;
@@ -110,10 +237,10 @@ std::string NameMangling::mangleFunction(const Function &spiceFunc) {
   };
   const bool templateTypeIsFctOrProc = std::ranges::any_of(spiceFunc.templateTypes, templateTypePredicate);
   if (!returnTypeIsFctOrProc && !paramTypeIsFctOrProc && !templateTypeIsFctOrProc)
-    assert(CommonUtil::isValidMangledName(mangledName.str()));
+    assert(CommonUtil::isValidMangledName(mangledName));
 #endif
 
-  return mangledName.str();
+  return mangledName;
 }
 
 /**
@@ -134,37 +261,75 @@ std::string NameMangling::mangleStruct(const Struct &spiceStruct) { return "stru
 std::string NameMangling::mangleInterface(const Interface &spiceInterface) { return "interface." + spiceInterface.name; }
 
 /**
- * Mangle a fully qualified name like e.g. test::s1::calledMethod to 4test2s112calledMethod
+ * Mangle the type of a struct or interface on its own, e.g. 4PairIiS_E
+ * This is the common part of the type info name, type info and vtable symbols.
+ *
+ * @param structBase Input struct or interface
+ * @return Mangled type name
+ */
+std::string NameMangling::mangleStructBaseType(const StructBase &structBase) {
+  const Context ctx = createContext("");
+  mangleType(ctx, structBase.entry->getQualType());
+  return ctx.getResult();
+}
+
+/**
+ * Mangle a fully qualified name like e.g. test::s1::calledMethod to N4test2s112calledMethodE
  * This should be mostly compatible with the C++ Itanium ABI name mangling scheme.
  *
- * @param out Output string stream
+ * @param ctx Mangling context
  * @param name Input name
- * @param nestedType True if the name is a nested type
- * @return Mangled name
+ * @param templateTypes Concrete template types
  */
-void NameMangling::mangleName(std::stringstream &out, const std::string &name, bool &nestedType) {
-  std::vector<std::string> fragments;
-  std::istringstream ss(name);
-  std::string token;
-
-  while (std::getline(ss, token, ':')) {
-    std::istringstream subStream(token);
-    std::string subToken;
-    while (std::getline(subStream, subToken, '/')) {
-      fragments.push_back(subToken);
+void NameMangling::mangleName(const Context &ctx, const std::string &name, const QualTypeList &templateTypes) {
+  // Invokes the given callback for each non-empty fragment of the name
+  const auto forEachFragment = [&](const auto &callback) {
+    size_t fragmentStart = 0;
+    for (size_t i = 0; i <= name.length(); i++) {
+      if (i < name.length() && name[i] != ':' && name[i] != '/')
+        continue;
+      if (i > fragmentStart)
+        callback(std::string_view(name).substr(fragmentStart, i - fragmentStart));
+      fragmentStart = i + 1;
     }
-  }
+  };
 
-  // Start a nested type if needed. The caller needs to emit the end marker.
-  if (fragments.size() > 1) {
-    out << "N";
-    nestedType = true;
+  size_t fragmentCount = 0;
+  forEachFragment([&](std::string_view) { fragmentCount++; });
+  const bool isNested = fragmentCount > 1;
+
+  // Start a nested type if needed. The N marker is only emitted to the output at the end, because a nested name that is
+  // substituted as a whole must not be wrapped in N ... E
+  const Component nestedName = ctx.beginComponent();
+  if (isNested)
+    ctx.appendExpandedOnly('N');
+
+  // Process each fragment and append it to the result. Each prefix is a substitution candidate
+  const Component prefix = ctx.beginComponent();
+  bool substituted = false;
+  forEachFragment([&](std::string_view fragment) {
+    ctx.append(fragment.length());
+    ctx.append(fragment);
+    substituted = ctx.endComponent(prefix);
+  });
+
+  // Template types. The resulting template id is a substitution candidate as well
+  if (!templateTypes.empty()) {
+    ctx.append('I');
+    for (const QualType &templateType : templateTypes)
+      mangleType(ctx, templateType);
+    ctx.append('E');
+    substituted = ctx.endComponent(prefix);
   }
 
-  // Process each fragment and append it to the result
-  for (const std::string &fragment : fragments) {
-    int fragmentLength = static_cast<int>(fragment.length());
-    out << std::to_string(fragmentLength) << fragment;
+  // End the nested type
+  if (isNested) {
+    if (substituted) {
+      ctx.appendExpandedOnly('E');
+    } else {
+      ctx.insertOutputOnly(nestedName.outStart, 'N');
+      ctx.append('E');
+    }
   }
 }
 
@@ -172,114 +337,152 @@ void NameMangling::mangleName(std::stringstream &out, const std::string &name, b
  * Mangle a symbol qualType
  * This should be mostly compatible with the C++ Itanium ABI name mangling scheme.
  *
- * @param out Output string stream
+ * @param ctx Mangling context
  * @param qualType Input symbol qualType
- * @return Mangled name
  */
-void NameMangling::mangleType(std::stringstream &out, const QualType &qualType) { // NOLINT(*-no-recursion)
-  const Type *type = qualType.getType();
+void NameMangling::mangleType(const Context &ctx, const QualType &qualType) { // NOLINT(*-no-recursion)
   assert(!qualType.hasAnyGenericParts());
+  assert(!qualType.getType()->typeChain.empty());
+  assert(qualType.getQualifiers().isSigned == !qualType.getQualifiers().isUnsigned);
 
   // Unwrap qualType chain
-  assert(!type->typeChain.empty());
-  for (size_t i = type->typeChain.size() - 1; i >= 1; i--)
-    mangleTypeChainElement(out, type->typeChain.at(i), false);
+  mangleTypeChain(ctx, qualType, qualType.getType()->typeChain.size() - 1);
+}
+
+/**
+ * Mangle the type chain of a symbol qualType from the given chain index downwards.
+ * Each wrapped type is mangled before the wrapping type is completed, so that inner types get registered in the
+ * substitution table first, like required by the Itanium ABI.
+ *
+ * @param ctx Mangling context
+ * @param qualType Input symbol qualType
+ * @param chainIdx Index of the type chain element to start with
+ */
+void NameMangling::mangleTypeChain(const Context &ctx, const QualType &qualType, size_t chainIdx) { // NOLINT(*-no-recursion)
+  const TypeChain &typeChain = qualType.getType()->typeChain;
+  const TypeQualifiers &qualifiers = qualType.getQualifiers();
+
+  // Wrapping chain elements, like pointers, references or arrays
+  if (chainIdx > 0) {
+    const Component component = ctx.beginComponent();
+    mangleTypeChainElement(ctx, typeChain.at(chainIdx), false);
+    mangleTypeChain(ctx, qualType, chainIdx - 1);
+    ctx.endComponent(component);
+    return;
+  }
 
   // Qualifiers
-  assert(qualType.getQualifiers().isSigned == !qualType.getQualifiers().isUnsigned);
-  const bool signedness = qualType.getQualifiers().isSigned;
-  if (qualType.getQualifiers().isConst && type->typeChain.size() > 1)
-    out << "K";
+  if (qualifiers.isConst && typeChain.size() > 1) {
+    const Component component = ctx.beginComponent();
+    ctx.append('K');
+    mangleTypeChainElement(ctx, typeChain.front(), qualifiers.isSigned);
+    ctx.endComponent(component);
+    return;
+  }
 
   // Base chain element
-  mangleTypeChainElement(out, type->typeChain.front(), signedness);
+  mangleTypeChainElement(ctx, typeChain.front(), qualifiers.isSigned);
 }
 
 /**
  * Mangle a type chain element
  *
- * @param out Output string stream
+ * @param ctx Mangling context
  * @param chainElement Input type chain element
  * @param signedness Signedness of the type
- * @return Mangled name
  */
-void NameMangling::mangleTypeChainElement(std::stringstream &out, const TypeChainElement &chainElement, bool signedness) {
+void NameMangling::mangleTypeChainElement(const Context &ctx, const TypeChainElement &chainElement, bool signedness) {
   switch (chainElement.superType) {
   case TY_PTR:
-    out << "P";
+    ctx.append('P');
     break;
   case TY_ARRAY:
-    if (chainElement.data.arraySize == ARRAY_SIZE_UNKNOWN)
-      out << "P";
-    else
-      out << "A" << chainElement.data.arraySize << "_";
+    if (chainElement.data.arraySize == ARRAY_SIZE_UNKNOWN) {
+      ctx.append('P');
+    } else {
+      ctx.append('A');
+      ctx.append(static_cast<size_t>(chainElement.data.arraySize));
+      ctx.append('_');
+    }
+    break;
+  case TY_VECTOR:
+    ctx.append("Dv");
+    ctx.append(static_cast<size_t>(chainElement.data.arraySize));
+    ctx.append('_');
     break;
   case TY_REF:
-    out << "R";
+    ctx.append('R');
     break;
   case TY_DOUBLE:
     assert(signedness && "Unsigned double types are forbidden");
-    out << "d";
+    ctx.append('d');
     break;
   case TY_INT:
-    out << (signedness ? "i" : "j");
+    ctx.append(signedness ? 'i' : 'j');
     break;
   case TY_SHORT:
-    out << (signedness ? "s" : "t");
+    ctx.append(signedness ? 's' : 't');
     break;
   case TY_LONG:
-    out << (signedness ? "l" : "m");
+    ctx.append(signedness ? 'l' : 'm');
     break;
   case TY_BYTE:
-    out << (signedness ? "a" : "h");
+    ctx.append(signedness ? 'a' : 'h');
     break;
   case TY_CHAR:
-    out << "c";
+    ctx.append('c');
     break;
-  case TY_STRING:
-    out << "PKc";
+  case TY_STRING: {
+    // Both, the const char and the pointer to it, are substitution candidates
+    const Component ptrComponent = ctx.beginComponent();
+    ctx.append('P');
+    const Component constComponent = ctx.beginComponent();
+    ctx.append("Kc");
+    ctx.endComponent(constComponent);
+    ctx.endComponent(ptrComponent);
     break;
+  }
   case TY_BOOL:
     assert(!signedness && "Signed bool types are forbidden");
-    out << "b";
+    ctx.append('b');
     break;
   case TY_STRUCT: // fall-through
   case TY_INTERFACE: {
-    bool nestedType = false;
     // Append a disambiguation suffix for same-named but distinct structs/interfaces (see issue #1253), so that two
     // independent types sharing a name do not end up with the same mangled name (and thus clash at link time).
     const std::string name =
         chainElement.subType + TypeNameDisambiguator::getDisambiguationSuffix(chainElement.subType, chainElement.typeId);
-    mangleName(out, name, nestedType);
-    if (!chainElement.templateTypes.empty()) {
-      out << "I";
-      for (const QualType &templateType : chainElement.templateTypes)
-        mangleType(out, templateType);
-      out << "E";
-    }
-    if (nestedType)
-      out << "E";
+    mangleName(ctx, name, chainElement.templateTypes);
     break;
   }
   case TY_ENUM: {
-    bool nestedType = false;
-    mangleName(out, chainElement.subType, nestedType);
-    if (nestedType)
-      out << "E";
+    mangleName(ctx, chainElement.subType, {});
     break;
   }
   case TY_FUNCTION: {
-    out << (chainElement.data.hasCaptures ? "PFC" : "PF");
+    // Both, the function type and the pointer to it, are substitution candidates
+    const Component ptrComponent = ctx.beginComponent();
+    ctx.append('P');
+    const Component fctComponent = ctx.beginComponent();
+    ctx.append(chainElement.data.hasCaptures ? "FC" : "F");
     for (const QualType &paramType : chainElement.paramTypes)
-      mangleType(out, paramType);
-    out << "E";
+      mangleType(ctx, paramType);
+    ctx.append('E');
+    ctx.endComponent(fctComponent);
+    ctx.endComponent(ptrComponent);
     break;
   }
   case TY_PROCEDURE: {
-    out << (chainElement.data.hasCaptures ? "PFCv" : "PFv");
+    // Both, the procedure type and the pointer to it, are substitution candidates
+    const Component ptrComponent = ctx.beginComponent();
+    ctx.append('P');
+    const Component fctComponent = ctx.beginComponent();
+    ctx.append(chainElement.data.hasCaptures ? "FCv" : "Fv");
     for (size_t i = 1; i < chainElement.paramTypes.size(); i++)
-      mangleType(out, chainElement.paramTypes.at(i));
-    out << "E";
+      mangleType(ctx, chainElement.paramTypes.at(i));
+    ctx.append('E');
+    ctx.endComponent(fctComponent);
+    ctx.endComponent(ptrComponent);
     break;
   }
   default:                                                                                                // GCOV_EXCL_LINE
@@ -288,31 +491,16 @@ void NameMangling::mangleTypeChainElement(std::stringstream &out, const TypeChai
   }
 }
 
-std::string NameMangling::mangleTypeInfoName(const StructBase *structBase) {
-  std::stringstream out;
-  out << "_ZTS";
-  mangleType(out, structBase->entry->getQualType());
-  return out.str();
-}
+std::string NameMangling::mangleTypeInfoName(const StructBase *structBase) { return "_ZTS" + structBase->getMangledTypeName(); }
 
 std::string NameMangling::mangleTypeInfoValue(const std::string &value) { return std::to_string(value.size()) + value; }
 
-std::string NameMangling::mangleTypeInfo(const StructBase *structBase) {
-  std::stringstream out;
-  out << "_ZTI";
-  mangleType(out, structBase->entry->getQualType());
-  return out.str();
-}
+std::string NameMangling::mangleTypeInfo(const StructBase *structBase) { return "_ZTI" + structBase->getMangledTypeName(); }
 
-std::string NameMangling::mangleVTable(const StructBase *structBase) {
-  std::stringstream out;
-  out << "_ZTV";
-  mangleType(out, structBase->entry->getQualType());
-  return out.str();
-}
+std::string NameMangling::mangleVTable(const StructBase *structBase) { return "_ZTV" + structBase->getMangledTypeName(); }
 
 std::string NameMangling::mangleVTable(const std::string &typeName) {
   return "_ZTV" + std::to_string(typeName.size()) + typeName;
 }
 
-} // namespace spice::compiler
\ No newline at end of file
+} // namespace spice::compiler
@@ -3,6 +3,10 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <vector>
+
+#include <symboltablebuilder/QualType.h>
 
 namespace spice::compiler {
 
@@ -11,7 +15,6 @@ class Function;
 class StructBase;
 class Struct;
 class Interface;
-class QualType;
 struct TypeChainElement;
 
 /**
@@ -37,6 +40,7 @@ struct TypeChainElement;
  * - v: void
  * - K: const
  * - C: capturing
+ * - S_, S0_, S1_, ...: substitution of a previously mangled component
  *
  * Reserved:
  * - I
@@ -48,6 +52,7 @@ public:
   [[nodiscard]] static std::string mangleFunction(const Function &spiceFunc);
   [[nodiscard]] static std::string mangleStruct(const Struct &spiceStruct);
   [[nodiscard]] static std::string mangleInterface(const Interface &spiceInterface);
+  [[nodiscard]] static std::string mangleStructBaseType(const StructBase &structBase);
   [[nodiscard]] static std::string mangleTypeInfoName(const StructBase *structBase);
   [[nodiscard]] static std::string mangleTypeInfoValue(const std::string &value);
   [[nodiscard]] static std::string mangleTypeInfo(const StructBase *structBase);
@@ -55,10 +60,47 @@ public:
   [[nodiscard]] static std::string mangleVTable(const std::string &typeName);
 
 private:
+  /**
+   * Start of a mangled component, that is a candidate for the substitution table
+   */
+  struct Component {
+    size_t outStart;
+    size_t expandedStart;
+  };
+
+  /**
+   * State of a single mangling run. Besides the (compressed) output, the context keeps the expanded form of all emitted
+   * components. The expanded form serves as key for the substitution table, because the compressed output of equal
+   * components may differ, depending on the substitutions, which were available when they were emitted.
+   */
+  class Context {
+  public:
+    // Constructors
+    Context(std::string &out, std::string &expanded, std::vector<std::pair<size_t, size_t>> &substitutions);
+
+    // Public methods
+    void append(std::string_view str) const;
+    void append(char c) const;
+    void append(size_t number) const;
+    void appendExpandedOnly(char c) const;
+    void insertOutputOnly(size_t pos, char c) const;
+    [[nodiscard]] Component beginComponent() const;
+    bool endComponent(const Component &component) const;
+    [[nodiscard]] std::string getResult() const;
+
+  private:
+    // Members
+    std::string &out;
+    std::string &expanded;
+    std::vector<std::pair</*expandedStart=*/size_t, /*length=*/size_t>> &substitutions;
+  };
+
   // Private methods
-  static void mangleName(std::stringstream &out, const std::string &name, bool &nestedType);
-  static void mangleType(std::stringstream &out, const QualType &qualType);
-  static void mangleTypeChainElement(std::stringstream &out, const TypeChainElement &chainElement, bool signedness);
+  static Context createContext(std::string_view prefix);
+  static void mangleName(const Context &ctx, const std::string &name, const QualTypeList &templateTypes);
+  static void mangleType(const Context &ctx, const QualType &qualType);
+  static void mangleTypeChain(const Context &ctx, const QualType &qualType, size_t chainIdx);
+  static void mangleTypeChainElement(const Context &ctx, const TypeChainElement &chainElement, bool signedness);
 };
 
-} // namespace spice::compiler
\ No newline at end of file
+} // namespace spice::compiler
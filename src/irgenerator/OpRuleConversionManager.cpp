@@ -30,6 +30,12 @@ LLVMExprResult OpRuleConversionManager::getPlusEqualInst(const ASTNode *node, LL
   if (callsOverloadedOpFct(node, DEFAULT_OP_IDX))
     return callOperatorOverloadFct<2>(node, {lhsV, lhsP, rhsV, rhsP}, DEFAULT_OP_IDX);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getPlusEqualInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE):
     return {.value = builder.CreateFAdd(lhsV(), rhsV())};
@@ -87,6 +93,12 @@ LLVMExprResult OpRuleConversionManager::getMinusEqualInst(const ASTNode *node, L
   if (callsOverloadedOpFct(node, DEFAULT_OP_IDX))
     return callOperatorOverloadFct<2>(node, {lhsV, lhsP, rhsV, rhsP}, DEFAULT_OP_IDX);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getMinusEqualInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE):
     return {.value = builder.CreateFSub(lhsV(), rhsV())};
@@ -145,6 +157,12 @@ LLVMExprResult OpRuleConversionManager::getMulEqualInst(const ASTNode *node, LLV
   if (callsOverloadedOpFct(node, DEFAULT_OP_IDX))
     return callOperatorOverloadFct<2>(node, {lhsV, lhsP, rhsV, rhsP}, DEFAULT_OP_IDX);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getMulEqualInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE):
     return {.value = builder.CreateFMul(lhsV(), rhsV())};
@@ -191,6 +209,12 @@ LLVMExprResult OpRuleConversionManager::getDivEqualInst(const ASTNode *node, LLV
   if (callsOverloadedOpFct(node, DEFAULT_OP_IDX))
     return callOperatorOverloadFct<2>(node, {lhsV, lhsP, rhsV, rhsP}, DEFAULT_OP_IDX);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getDivEqualInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE):
     return {.value = builder.CreateFDiv(lhsV(), rhsV())};
@@ -231,6 +255,12 @@ LLVMExprResult OpRuleConversionManager::getRemEqualInst(const ASTNode *node, LLV
   rhsSTy = rhsSTy.removeReferenceWrapper();
   llvm::Type *lhsT = lhsSTy.toLLVMType(irGenerator->sourceFile);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getRemEqualInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE): {
     // LLVM generates a call to fmod on Linux systems
@@ -276,6 +306,12 @@ LLVMExprResult OpRuleConversionManager::getSHLEqualInst(const ASTNode *node, LLV
   rhsSTy = rhsSTy.removeReferenceWrapper();
   llvm::Type *lhsT = lhsSTy.toLLVMType(irGenerator->sourceFile);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getSHLEqualInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_INT, TY_INT):
     return {.value = builder.CreateShl(lhsV(), rhsV())};
@@ -309,6 +345,12 @@ LLVMExprResult OpRuleConversionManager::getSHREqualInst(const ASTNode *node, LLV
   rhsSTy = rhsSTy.removeReferenceWrapper();
   llvm::Type *lhsT = lhsSTy.toLLVMType(irGenerator->sourceFile);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getSHREqualInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_INT, TY_INT):
     return {.value = generateSHR(lhsSTy, rhsSTy, lhsV(), rhsV())};
@@ -342,6 +384,12 @@ LLVMExprResult OpRuleConversionManager::getAndEqualInst(const ASTNode *node, LLV
   rhsSTy = rhsSTy.removeReferenceWrapper();
   llvm::Type *lhsT = lhsSTy.toLLVMType(irGenerator->sourceFile);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getAndEqualInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_INT, TY_INT):
     return {.value = builder.CreateAnd(lhsV(), rhsV())};
@@ -375,6 +423,12 @@ LLVMExprResult OpRuleConversionManager::getOrEqualInst(const ASTNode *node, LLVM
   rhsSTy = rhsSTy.removeReferenceWrapper();
   llvm::Type *lhsT = lhsSTy.toLLVMType(irGenerator->sourceFile);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getOrEqualInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_INT, TY_INT):
     return {.value = builder.CreateOr(lhsV(), rhsV())};
@@ -408,6 +462,12 @@ LLVMExprResult OpRuleConversionManager::getXorEqualInst(const ASTNode *node, LLV
   rhsSTy = rhsSTy.removeReferenceWrapper();
   llvm::Type *lhsT = lhsSTy.toLLVMType(irGenerator->sourceFile);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getXorEqualInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_INT, TY_INT):
     return {.value = builder.CreateXor(lhsV(), rhsV())};
@@ -447,6 +507,12 @@ LLVMExprResult OpRuleConversionManager::getBitwiseOrInst(const ASTNode *node, LL
   if (callsOverloadedOpFct(node, opIdx))
     return callOperatorOverloadFct<2>(node, {lhsV, lhsP, rhsV, rhsP}, opIdx);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getBitwiseOrInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy, opIdx);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_INT, TY_INT):     // fallthrough
   case COMB(TY_SHORT, TY_SHORT): // fallthrough
@@ -472,6 +538,12 @@ LLVMExprResult OpRuleConversionManager::getBitwiseXorInst(const ASTNode *node, L
   if (callsOverloadedOpFct(node, opIdx))
     return callOperatorOverloadFct<2>(node, {lhsV, lhsP, rhsV, rhsP}, opIdx);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getBitwiseXorInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy, opIdx);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_INT, TY_INT):     // fallthrough
   case COMB(TY_SHORT, TY_SHORT): // fallthrough
@@ -497,6 +569,12 @@ LLVMExprResult OpRuleConversionManager::getBitwiseAndInst(const ASTNode *node, L
   if (callsOverloadedOpFct(node, opIdx))
     return callOperatorOverloadFct<2>(node, {lhsV, lhsP, rhsV, rhsP}, opIdx);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getBitwiseAndInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy, opIdx);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_INT, TY_INT):     // fallthrough
   case COMB(TY_SHORT, TY_SHORT): // fallthrough
@@ -538,6 +616,12 @@ LLVMExprResult OpRuleConversionManager::getEqualInst(const ASTNode *node, LLVMEx
     return {.value = result};
   }
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getEqualInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   // Check for primitive type combinations
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE):
@@ -660,6 +744,12 @@ LLVMExprResult OpRuleConversionManager::getNotEqualInst(const ASTNode *node, LLV
     return {.value = builder.CreateNot(result)};
   }
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getNotEqualInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE):
     return {.value = builder.CreateFCmpONE(lhsV(), rhsV())};
@@ -761,6 +851,12 @@ LLVMExprResult OpRuleConversionManager::getLessInst(const ASTNode *node, LLVMExp
   llvm::Type *lhsT = lhsSTy.toLLVMType(irGenerator->sourceFile);
   llvm::Type *rhsT = rhsSTy.toLLVMType(irGenerator->sourceFile);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getLessInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE):
     return {.value = builder.CreateFCmpOLT(lhsV(), rhsV())};
@@ -827,6 +923,12 @@ LLVMExprResult OpRuleConversionManager::getGreaterInst(const ASTNode *node, LLVM
   llvm::Type *lhsT = lhsSTy.toLLVMType(irGenerator->sourceFile);
   llvm::Type *rhsT = rhsSTy.toLLVMType(irGenerator->sourceFile);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getGreaterInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE):
     return {.value = builder.CreateFCmpOGT(lhsV(), rhsV())};
@@ -893,6 +995,12 @@ LLVMExprResult OpRuleConversionManager::getLessEqualInst(const ASTNode *node, LL
   llvm::Type *lhsT = lhsSTy.toLLVMType(irGenerator->sourceFile);
   llvm::Type *rhsT = rhsSTy.toLLVMType(irGenerator->sourceFile);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getLessEqualInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE):
     return {.value = builder.CreateFCmpOLE(lhsV(), rhsV())};
@@ -959,6 +1067,12 @@ LLVMExprResult OpRuleConversionManager::getGreaterEqualInst(const ASTNode *node,
   llvm::Type *lhsT = lhsSTy.toLLVMType(irGenerator->sourceFile);
   llvm::Type *rhsT = rhsSTy.toLLVMType(irGenerator->sourceFile);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getGreaterEqualInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE):
     return {.value = builder.CreateFCmpOGE(lhsV(), rhsV())};
@@ -1030,6 +1144,12 @@ LLVMExprResult OpRuleConversionManager::getShiftLeftInst(const ASTNode *node, LL
   if (callsOverloadedOpFct(node, opIdx))
     return callOperatorOverloadFct<2>(node, {lhsV, lhsP, rhsV, rhsP}, opIdx);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getShiftLeftInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy, opIdx);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_INT, TY_INT):
     return {.value = builder.CreateShl(lhsV(), rhsV())};
@@ -1076,6 +1196,12 @@ LLVMExprResult OpRuleConversionManager::getShiftRightInst(const ASTNode *node, L
   if (callsOverloadedOpFct(node, opIdx))
     return callOperatorOverloadFct<2>(node, {lhsV, lhsP, rhsV, rhsP}, opIdx);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getShiftRightInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy, opIdx);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_INT, TY_INT):
     return {.value = generateSHR(lhsSTy, rhsSTy, lhsV(), rhsV())};
@@ -1123,6 +1249,12 @@ LLVMExprResult OpRuleConversionManager::getPlusInst(const ASTNode *node, LLVMExp
   if (callsOverloadedOpFct(node, opIdx))
     return callOperatorOverloadFct<2>(node, {lhsV, lhsP, rhsV, rhsP}, opIdx);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getPlusInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy, opIdx);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE):
     return {.value = builder.CreateFAdd(lhsV(), rhsV())};
@@ -1212,6 +1344,12 @@ LLVMExprResult OpRuleConversionManager::getMinusInst(const ASTNode *node, LLVMEx
   if (callsOverloadedOpFct(node, opIdx))
     return callOperatorOverloadFct<2>(node, {lhsV, lhsP, rhsV, rhsP}, opIdx);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getMinusInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy, opIdx);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE):
     return {.value = builder.CreateFSub(lhsV(), rhsV())};
@@ -1302,6 +1440,12 @@ LLVMExprResult OpRuleConversionManager::getMulInst(const ASTNode *node, LLVMExpr
   if (callsOverloadedOpFct(node, opIdx))
     return callOperatorOverloadFct<2>(node, {lhsV, lhsP, rhsV, rhsP}, opIdx);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getMulInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy, opIdx);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE):
     return {.value = builder.CreateFMul(lhsV(), rhsV())};
@@ -1371,6 +1515,12 @@ LLVMExprResult OpRuleConversionManager::getDivInst(const ASTNode *node, LLVMExpr
   if (callsOverloadedOpFct(node, opIdx))
     return callOperatorOverloadFct<2>(node, {lhsV, lhsP, rhsV, rhsP}, opIdx);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getDivInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy, opIdx);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE):
     return {.value = builder.CreateFDiv(lhsV(), rhsV())};
@@ -1435,6 +1585,12 @@ LLVMExprResult OpRuleConversionManager::getRemInst(const ASTNode *node, LLVMExpr
   llvm::Type *lhsT = lhsSTy.toLLVMType(irGenerator->sourceFile);
   llvm::Type *rhsT = rhsSTy.toLLVMType(irGenerator->sourceFile);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector() || rhsSTy.isVector()) {
+    auto [lhsLanes, rhsLanes, laneSTy] = getVectorOperands(lhsSTy, lhsV(), rhsSTy, rhsV());
+    return getRemInst(node, lhsLanes, laneSTy, rhsLanes, laneSTy);
+  }
+
   switch (getTypeCombination(lhsSTy, rhsSTy)) {
   case COMB(TY_DOUBLE, TY_DOUBLE): {
     // LLVM generates a call to fmod on Linux systems
@@ -1478,6 +1634,12 @@ LLVMExprResult OpRuleConversionManager::getPrefixMinusInst(const ASTNode *node,
   ResolverFct lhsV = [&] { return irGenerator->resolveValue(lhsSTy, lhs); };
   lhsSTy = lhsSTy.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector()) {
+    LLVMExprResult lhsLanes = {.value = lhsV()};
+    return getPrefixMinusInst(node, lhsLanes, lhsSTy.getContained());
+  }
+
   switch (lhsSTy.getSuperType()) {
   case TY_DOUBLE:
     return {.value = builder.CreateFNeg(lhsV())};
@@ -1551,6 +1713,12 @@ LLVMExprResult OpRuleConversionManager::getPrefixBitwiseNotInst(const ASTNode *n
   if (callsOverloadedOpFct(node, DEFAULT_OP_IDX))
     return callOperatorOverloadFct<1>(node, {lhsV, lhsP}, DEFAULT_OP_IDX);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsSTy.isVector()) {
+    LLVMExprResult lhsLanes = {.value = lhsV()};
+    return getPrefixBitwiseNotInst(node, lhsLanes, lhsSTy.getContained());
+  }
+
   switch (lhsSTy.getSuperType()) {
   case TY_INT:   // fallthrough
   case TY_SHORT: // fallthrough
@@ -1788,6 +1956,19 @@ LLVMExprResult OpRuleConversionManager::callOperatorOverloadFct(const ASTNode *n
   return {.value = result, .ptr = resultPtr, .entry = anonymousSymbol};
 }
 
+OpRuleConversionManager::VectorOperands OpRuleConversionManager::getVectorOperands(const QualType &lhsSTy, llvm::Value *lhsV,
+                                                                                  const QualType &rhsSTy,
+                                                                                  llvm::Value *rhsV) const {
+  // Broadcast a scalar operand to all lanes of the vector operand
+  const QualType &vectorSTy = lhsSTy.isVector() ? lhsSTy : rhsSTy;
+  const unsigned int laneCount = vectorSTy.getVectorLaneCount();
+  if (!lhsSTy.isVector())
+    lhsV = builder.CreateVectorSplat(laneCount, lhsV);
+  if (!rhsSTy.isVector())
+    rhsV = builder.CreateVectorSplat(laneCount, rhsV);
+  return {.lhs = {.value = lhsV}, .rhs = {.value = rhsV}, .laneSTy = vectorSTy.getContained()};
+}
+
 llvm::Value *OpRuleConversionManager::generateIToFp(const QualType &srcSTy, llvm::Value *srcV, llvm::Type *tgtT) const {
   if (srcSTy.isSigned())
     return builder.CreateSIToFP(srcV, tgtT);
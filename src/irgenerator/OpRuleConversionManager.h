@@ -92,12 +92,21 @@ public:
   LLVMExprResult callOperatorOverloadFct(const ASTNode *node, const std::array<ResolverFct, N * 2> &opV, size_t opIdx);
 
 private:
+  // Structs
+  struct VectorOperands {
+    LLVMExprResult lhs;
+    LLVMExprResult rhs;
+    QualType laneSTy;
+  };
+
   // Members
   llvm::IRBuilder<> &builder;
   IRGenerator *irGenerator;
   const StdFunctionManager &stdFunctionManager;
 
   // Private methods
+  [[nodiscard]] VectorOperands getVectorOperands(const QualType &lhsSTy, llvm::Value *lhsV, const QualType &rhsSTy,
+                                                 llvm::Value *rhsV) const;
   [[nodiscard]] llvm::Value *generateIToFp(const QualType &srcSTy, llvm::Value *srcV, llvm::Type *tgtT) const;
   [[nodiscard]] llvm::Value *generateSHR(const QualType &lhsSTy, const QualType &rhsSTy, llvm::Value *lhsV,
                                          llvm::Value *rhsV) const;
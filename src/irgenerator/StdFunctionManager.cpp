@@ -52,6 +52,15 @@ llvm::Function *StdFunctionManager::getExitFct() const {
   return exitFct;
 }
 
+llvm::Function *StdFunctionManager::getMallocFct() const {
+  llvm::Function *mallocFct = getFunction("malloc", builder.getPtrTy(), builder.getInt64Ty());
+  // Set attributes
+  mallocFct->addFnAttr(llvm::Attribute::NoUnwind);
+  mallocFct->addRetAttr(llvm::Attribute::NoAlias);
+  mallocFct->addParamAttr(0, llvm::Attribute::NoUndef);
+  return mallocFct;
+}
+
 llvm::Function *StdFunctionManager::getFreeFct() const {
   llvm::Function *freeFct = getProcedure("free", builder.getPtrTy());
   // Set attributes
@@ -95,6 +104,12 @@ llvm::Function *StdFunctionManager::getStringIsRawEqualStringStringFct() const {
   return getFunction(mangledName.c_str(), builder.getInt1Ty(), {builder.getPtrTy(), builder.getPtrTy()});
 }
 
+llvm::Function *StdFunctionManager::getStringGetRawFct(const QualType &stringObjType) const {
+  const Function function("getRaw", nullptr, stringObjType, QualType(TY_STRING), {}, {}, nullptr);
+  const std::string mangledName = NameMangling::mangleFunction(function);
+  return getFunction(mangledName.c_str(), builder.getPtrTy(), {builder.getPtrTy()});
+}
+
 llvm::Function *StdFunctionManager::getAllocUnsafeLongFct() const {
   QualType unsignedLong(TY_LONG);
   unsignedLong.makeUnsigned();
@@ -111,36 +126,30 @@ llvm::Function *StdFunctionManager::getDeallocBytePtrRefFct() const {
   return getProcedure(mangledName.c_str(), {builder.getPtrTy()});
 }
 
-llvm::Function *StdFunctionManager::getIterateFct(const Function *spiceFunc) const {
-  const std::string functionName = NameMangling::mangleFunction(*spiceFunc);
-  llvm::Type *iteratorType = spiceFunc->returnType.toLLVMType(sourceFile);
-  return getFunction(functionName.c_str(), iteratorType, {builder.getPtrTy(), builder.getInt64Ty()});
-}
-
 llvm::Function *StdFunctionManager::getIteratorFct(const Function *spiceFunc) const {
-  const std::string functionName = NameMangling::mangleFunction(*spiceFunc);
+  const std::string &functionName = spiceFunc->getMangledName();
   llvm::Type *iteratorType = spiceFunc->returnType.toLLVMType(sourceFile);
   return getFunction(functionName.c_str(), iteratorType, builder.getPtrTy());
 }
 
 llvm::Function *StdFunctionManager::getIteratorGetFct(const Function *spiceFunc) const {
-  const std::string functionName = NameMangling::mangleFunction(*spiceFunc);
+  const std::string &functionName = spiceFunc->getMangledName();
   return getFunction(functionName.c_str(), builder.getPtrTy(), builder.getPtrTy());
 }
 
 llvm::Function *StdFunctionManager::getIteratorGetIdxFct(const Function *spiceFunc) const {
-  const std::string functionName = NameMangling::mangleFunction(*spiceFunc);
+  const std::string &functionName = spiceFunc->getMangledName();
   llvm::Type *pairTy = spiceFunc->returnType.toLLVMType(sourceFile);
   return getFunction(functionName.c_str(), pairTy, builder.getPtrTy());
 }
 
 llvm::Function *StdFunctionManager::getIteratorIsValidFct(const Function *spiceFunc) const {
-  const std::string functionName = NameMangling::mangleFunction(*spiceFunc);
+  const std::string &functionName = spiceFunc->getMangledName();
   return getFunction(functionName.c_str(), builder.getInt1Ty(), builder.getPtrTy());
 }
 
 llvm::Function *StdFunctionManager::getIteratorNextFct(const Function *spiceFunc) const {
-  const std::string functionName = NameMangling::mangleFunction(*spiceFunc);
+  const std::string &functionName = spiceFunc->getMangledName();
   return getProcedure(functionName.c_str(), builder.getPtrTy());
 }
 
@@ -14,6 +14,7 @@ namespace spice::compiler {
 // Forward declarations
 class Function;
 class GlobalResourceManager;
+class QualType;
 class SourceFile;
 
 class StdFunctionManager {
@@ -25,14 +26,15 @@ public:
   [[nodiscard]] llvm::Function *getPrintfFct() const;
   [[nodiscard]] llvm::Function *getFPrintfFct() const;
   [[nodiscard]] llvm::Function *getExitFct() const;
+  [[nodiscard]] llvm::Function *getMallocFct() const;
   [[nodiscard]] llvm::Function *getFreeFct() const;
   [[nodiscard]] llvm::Function *getMemcmpFct() const;
   [[nodiscard]] llvm::Function *getMemcpyIntrinsic() const;
   [[nodiscard]] llvm::Function *getStringGetRawLengthStringFct() const;
   [[nodiscard]] llvm::Function *getStringIsRawEqualStringStringFct() const;
+  [[nodiscard]] llvm::Function *getStringGetRawFct(const QualType &stringObjType) const;
   [[nodiscard]] llvm::Function *getAllocUnsafeLongFct() const;
   [[nodiscard]] llvm::Function *getDeallocBytePtrRefFct() const;
-  [[nodiscard]] llvm::Function *getIterateFct(const Function *spiceFunc) const;
   [[nodiscard]] llvm::Function *getIteratorFct(const Function *spiceFunc) const;
   [[nodiscard]] llvm::Function *getIteratorGetFct(const Function *spiceFunc) const;
   [[nodiscard]] llvm::Function *getIteratorGetIdxFct(const Function *spiceFunc) const;
@@ -8,6 +8,7 @@
 #include <driver/Driver.h>
 #include <exception/CompilerError.h>
 #include <exception/LinkerError.h>
+#include <util/CommonUtil.h>
 #include <util/GlobalDefinitions.h>
 #include <util/SystemUtil.h>
 #include <util/Timer.h>
@@ -145,8 +146,8 @@ void ExternalLinkerInterface::link() const {
     std::cout << "Linking result: " << output << "\n\n"; // GCOV_EXCL_LINE
 
   // Print link time
-  if (cliOptions.printDebugOutput)                                                    // GCOV_EXCL_LINE
-    std::cout << "Total link time: " << timer.getDurationMilliseconds() << " ms\n\n"; // GCOV_EXCL_LINE
+  if (cliOptions.printDebugOutput)                                                                            // GCOV_EXCL_LINE
+    std::cout << "Total link time: " << CommonUtil::formatDuration(timer.getDurationNanoseconds()) << "\n\n"; // GCOV_EXCL_LINE
 }
 
 /**
@@ -189,8 +190,8 @@ void ExternalLinkerInterface::archive() const {
     std::cout << "Archiving result: " << output << "\n\n"; // GCOV_EXCL_LINE
 
   // Print link time
-  if (cliOptions.printDebugOutput)                                                       // GCOV_EXCL_LINE
-    std::cout << "Total archive time: " << timer.getDurationMilliseconds() << " ms\n\n"; // GCOV_EXCL_LINE
+  if (cliOptions.printDebugOutput)                                                                               // GCOV_EXCL_LINE
+    std::cout << "Total archive time: " << CommonUtil::formatDuration(timer.getDurationNanoseconds()) << "\n\n"; // GCOV_EXCL_LINE
 }
 
 /**
@@ -10,6 +10,8 @@
 #include <global/GlobalResourceManager.h>
 #include <typechecker/MacroDefs.h>
 
+#include <llvm/Support/TimeProfiler.h>
+
 using namespace spice::compiler;
 
 /**
@@ -36,11 +38,16 @@ bool compileProject(const CliOptions &cliOptions) {
 
     // Link the target executable (link object files to executable/library)
     if (cliOptions.outputContainer != OutputContainer::OBJECT_FILE) {
+      llvm::TimeTraceScope timeTraceScope("Linker");
       resourceManager.linker.prepare();
       resourceManager.cacheManager.linkOrRestoreExecutable(resourceManager);
       resourceManager.linker.cleanup();
     }
 
+    // Write the time trace
+    if (cliOptions.timeTrace)
+      resourceManager.writeTimeTrace();
+
     // Print compiler warnings
     mainSourceFile->collectAndPrintWarnings();
 
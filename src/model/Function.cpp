@@ -143,11 +143,12 @@ std::string Function::getSignature(const std::string &name, const QualType &this
 std::string Function::getScopeName() const { return getSignature(false, true, false, true); }
 
 /**
- * Get the mangled name of the function
+ * Get the mangled name of the function.
+ * The mangled name is computed once and memoized afterwards.
  *
  * @return Mangled name
  */
-std::string Function::getMangledName() const {
+const std::string &Function::getMangledName() const {
   // Use predefined mangled name if available
   if (!predefinedMangledName.empty())
     return predefinedMangledName;
@@ -155,7 +156,18 @@ std::string Function::getMangledName() const {
   if (!mangleFunctionName)
     return name;
   // Use normal name mangling
-  return NameMangling::mangleFunction(*this);
+  return mangledName.get([&] { return NameMangling::mangleFunction(*this); });
+}
+
+/**
+ * Set the suffix, that gets appended to the function name when mangling, e.g. to distinguish lambda manifestations.
+ * This invalidates the memoized mangled name.
+ *
+ * @param suffix Mangle suffix
+ */
+void Function::setMangleSuffix(std::string suffix) {
+  mangleSuffix = std::move(suffix);
+  mangledName.reset();
 }
 
 /**
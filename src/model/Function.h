@@ -8,6 +8,7 @@
 #include <symboltablebuilder/QualType.h>
 #include <symboltablebuilder/TypeChain.h>
 #include <util/GlobalDefinitions.h>
+#include <util/Memoized.h>
 
 namespace spice::compiler {
 
@@ -45,7 +46,9 @@ public:
                                                 bool withReturnType = true, bool withThisType = true, bool ignorePublic = true,
                                                 bool withTypeAliases = true, bool withSize = false);
   [[nodiscard]] std::string getScopeName() const;
-  [[nodiscard]] std::string getMangledName() const;
+  [[nodiscard]] const std::string &getMangledName() const;
+  [[nodiscard]] const std::string &getMangleSuffix() const { return mangleSuffix; }
+  void setMangleSuffix(std::string suffix);
   [[nodiscard]] static std::string getSymbolTableEntryName(const std::string &functionName, const CodeLoc &codeLoc);
   [[nodiscard]] static std::string getSymbolTableEntryNameDefaultCtor(const CodeLoc &structCodeLoc);
   [[nodiscard]] static std::string getSymbolTableEntryNameDefaultCopyCtor(const CodeLoc &structCodeLoc);
@@ -76,16 +79,23 @@ public:
   ASTNode *declNode = nullptr;
   Scope *bodyScope = nullptr;
   std::string predefinedMangledName;
-  std::string mangleSuffix;
   Function *genericPreset = nullptr;
   bool isVararg = false;
   bool mangleFunctionName = true;
   bool alreadyTypeChecked = false;
   bool used = false;
   bool implicitDefault = false;
+  bool isCompileTime = false;
+  bool isAsync = false;
   bool isVirtual = false;
   bool isNewlyInserted = false;
   size_t vtableIndex = 0;
+  QualType futureType; // Future<T>, that is returned to the caller of an async function
+
+private:
+  // Members
+  std::string mangleSuffix;
+  Memoized<std::string> mangledName; // Only to be used once the function is fully type-checked
 };
 
 } // namespace spice::compiler
\ No newline at end of file
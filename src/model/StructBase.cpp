@@ -4,6 +4,7 @@
 
 #include <ast/ASTBuilder.h>
 #include <ast/ASTNodes.h>
+#include <irgenerator/NameMangling.h>
 #include <typechecker/TypeMatcher.h>
 #include <util/CommonUtil.h>
 
@@ -104,4 +105,14 @@ const CodeLoc &StructBase::getDeclCodeLoc() const { return declNode->codeLoc; }
  */
 bool StructBase::isGenericSubstantiation() const { return genericPreset != nullptr; }
 
+/**
+ * Get the mangled name of the struct type, which is the common part of the type info and vtable symbol names.
+ * The mangled name is computed once and memoized afterwards.
+ *
+ * @return Mangled type name
+ */
+const std::string &StructBase::getMangledTypeName() const {
+  return mangledTypeName.get([&] { return NameMangling::mangleStructBaseType(*this); });
+}
+
 } // namespace spice::compiler
\ No newline at end of file
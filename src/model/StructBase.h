@@ -7,6 +7,7 @@
 #include <vector>
 
 #include <symboltablebuilder/QualType.h>
+#include <util/Memoized.h>
 
 #include <llvm/IR/DebugInfoMetadata.h>
 
@@ -33,6 +34,7 @@ public:
   [[nodiscard]] QualTypeList getTemplateTypes() const;
   [[nodiscard]] const CodeLoc &getDeclCodeLoc() const;
   [[nodiscard]] bool isGenericSubstantiation() const;
+  [[nodiscard]] const std::string &getMangledTypeName() const;
 
   // Public members
   std::string name;
@@ -52,6 +54,10 @@ public:
   } vTableData;
   bool used = false;
   bool isNewlyInserted = false;
+
+private:
+  // Members
+  Memoized<std::string> mangledTypeName; // Only to be used once the struct is fully type-checked
 };
 
 } // namespace spice::compiler
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/Support/CodeGen.h>
 #include <llvm/Support/FileSystem.h>
+#include <llvm/Target/TargetMachine.h>
 
 namespace spice::compiler {
 
@@ -27,14 +28,28 @@ void LLVMObjectEmitter::emit(const std::filesystem::path &objectPath) const {
   if (errorCode)
     throw CompilerError(CANT_OPEN_OUTPUT_FILE, "File '" + objectPathString + "' could not be opened"); // GCOV_EXCL_LINE
 
+  // Open output stream for the split DWARF file, if required
+  std::unique_ptr<llvm::raw_fd_ostream> dwoStream;
+  llvm::TargetMachine *targetMachine = sourceFile->targetMachine.get();
+  if (cliOptions.instrumentation.splitDwarf) {
+    // Must match the split debug file name, that the compile units of the module reference
+    const std::string dwoPathString = sourceFile->getSplitDwarfFilePath().string();
+    dwoStream = std::make_unique<llvm::raw_fd_ostream>(dwoPathString, errorCode, llvm::sys::fs::OF_None);
+    if (errorCode)
+      throw CompilerError(CANT_OPEN_OUTPUT_FILE, "File '" + dwoPathString + "' could not be opened"); // GCOV_EXCL_LINE
+    targetMachine->Options.MCOptions.SplitDwarfFile = dwoPathString;
+  }
+
   llvm::legacy::PassManager passManager;
   constexpr auto fileType = llvm::CodeGenFileType::ObjectFile;
-  if (sourceFile->targetMachine->addPassesToEmitFile(passManager, stream, nullptr, fileType, cliOptions.disableVerifier))
+  if (targetMachine->addPassesToEmitFile(passManager, stream, dwoStream.get(), fileType, cliOptions.disableVerifier))
     throw CompilerError(WRONG_OUTPUT_TYPE, "Target machine can't emit a file of this type"); // GCOV_EXCL_LINE
 
   // Emit object file
   passManager.run(module);
   stream.flush();
+  if (dwoStream)
+    dwoStream->flush();
 }
 
 void LLVMObjectEmitter::getASMString(std::string &output) const {
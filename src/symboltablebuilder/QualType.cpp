@@ -44,6 +44,13 @@ const std::string &QualType::getSubType() const { return type->getSubType(); }
  */
 unsigned int QualType::getArraySize() const { return type->getArraySize(); }
 
+/**
+ * Get the lane count of the underlying SIMD vector type
+ *
+ * @return Lane count
+ */
+unsigned int QualType::getVectorLaneCount() const { return type->getVectorLaneCount(); }
+
 /**
  * Get the body scope of the underlying type
  *
@@ -241,6 +248,13 @@ bool QualType::isArray() const { return type->isArray(); }
  */
 bool QualType::isArrayOf(SuperType superType) const { return isArray() && getContained().is(superType); }
 
+/**
+ * Check if the underlying type is a SIMD vector
+ *
+ * @return Vector or not
+ */
+bool QualType::isVector() const { return type->isVector(); }
+
 /**
  * Check if the underlying type is an array that decays to a pointer to itself when passed to a function.
  *
@@ -320,6 +334,15 @@ bool QualType::isErrorObj() const {
   return is(TY_STRUCT) && getSubType() == ERROBJ_NAME && getBodyScope()->sourceFile->isStdFile;
 }
 
+/**
+ * Check if the current type is a future object, produced by calling an async function
+ *
+ * @return Future object or not
+ */
+bool QualType::isFutureObj() const {
+  return is(TY_STRUCT) && getSubType() == FUTUREOBJ_NAME && getBodyScope()->sourceFile->isStdFile;
+}
+
 /**
  * Check if the current type has any generic parts
  *
@@ -437,6 +460,34 @@ bool QualType::isTriviallyDestructible(const ASTNode *node) const {
   return true;
 }
 
+/**
+ * Check if an instance of the current type can be moved to another memory location by copying its bytes, without calling
+ * any ctor or dtor. This is the case, unless a contained struct has a user-defined move ctor, which may fix up pointers
+ * into the instance itself. Heap-allocated fields are fine, because their ownership moves along with the bytes.
+ *
+ * @param node Accessing ASTNode
+ * @return Trivially relocatable or not
+ */
+bool QualType::isTriviallyRelocatable(const ASTNode *node) const { // NOLINT(*-no-recursion)
+  // In case of an array, the item type is determining the relocation triviality
+  if (isArray())
+    return getBase().isTriviallyRelocatable(node);
+
+  // In case of a struct, the member types determine the relocation triviality
+  if (is(TY_STRUCT)) {
+    // If the struct has a user-defined move ctor, it is a non-trivially relocatable one
+    const Struct *spiceStruct = getStruct(node);
+    if (const Function *moveCtor = FunctionManager::findMoveCtor(spiceStruct->scope); moveCtor && !moveCtor->implicitDefault)
+      return false;
+
+    // Check if all member types are trivially relocatable
+    const auto pred = [&](const QualType &fieldType) { return fieldType.isTriviallyRelocatable(node); }; // NOLINT(*-no-recursion)
+    return std::ranges::all_of(spiceStruct->fieldTypes, pred);
+  }
+
+  return true;
+}
+
 /**
  * Check if the current type implements the given interface type
  *
@@ -739,6 +790,19 @@ QualType QualType::toArr(const ASTNode *node, size_t size, bool skipDynCheck /*=
   return newType;
 }
 
+/**
+ * Retrieve the SIMD vector type with this type as lane type. The lanes share the qualifiers of the vector.
+ *
+ * @param node ASTNode
+ * @param laneCount Number of lanes
+ * @return New type
+ */
+QualType QualType::toVec(const ASTNode *node, unsigned int laneCount) const {
+  QualType newType = *this;
+  newType.type = type->toVec(node, laneCount);
+  return newType;
+}
+
 /**
  * Retrieve the non-const type of this type
  *
@@ -757,7 +821,7 @@ QualType QualType::toNonConst() const {
  * @return New type
  */
 QualType QualType::getContained() const {
-  assert(isOneOf({TY_PTR, TY_REF, TY_ARRAY, TY_STRING}));
+  assert(isOneOf({TY_PTR, TY_REF, TY_ARRAY, TY_VECTOR, TY_STRING}));
   QualType newType = *this;
   newType.type = type->getContained();
   return newType;
@@ -28,13 +28,16 @@ enum SuperType : uint8_t;
 
 // Constants
 constexpr const char *const STROBJ_NAME = "String";
+constexpr const char *const STRVIEWOBJ_NAME = "StringView";
 constexpr const char *const RESULTOBJ_NAME = "Result";
 constexpr const char *const ERROBJ_NAME = "Error";
 constexpr const char *const TIOBJ_NAME = "TypeInfo";
+constexpr const char *const FUTUREOBJ_NAME = "Future";
 constexpr const char *const IITERATOR_NAME = "IIterator";
 constexpr const char *const ARRAY_ITERATOR_NAME = "ArrayIterator";
 static constexpr const char *const RESERVED_TYPE_NAMES[] = {
-    STROBJ_NAME, RESULTOBJ_NAME, ERROBJ_NAME, TIOBJ_NAME, IITERATOR_NAME, ARRAY_ITERATOR_NAME,
+    STROBJ_NAME,    STRVIEWOBJ_NAME, RESULTOBJ_NAME,      ERROBJ_NAME,    TIOBJ_NAME,
+    IITERATOR_NAME, FUTUREOBJ_NAME,  ARRAY_ITERATOR_NAME,
 };
 static constexpr uint64_t TYPE_ID_ITERATOR_INTERFACE = 255;
 static constexpr uint64_t TYPE_ID_ITERABLE_INTERFACE = 256;
@@ -62,6 +65,7 @@ public:
   [[nodiscard]] SuperType getSuperType() const;
   [[nodiscard]] const std::string &getSubType() const;
   [[nodiscard]] unsigned int getArraySize() const;
+  [[nodiscard]] unsigned int getVectorLaneCount() const;
   [[nodiscard]] Scope *getBodyScope() const;
   [[nodiscard]] const QualType &getFunctionReturnType() const;
   [[nodiscard]] QualTypeList getFunctionParamTypes() const;
@@ -87,18 +91,21 @@ public:
   [[nodiscard]] bool isRefTo(SuperType superType) const;
   [[nodiscard]] bool isArray() const;
   [[nodiscard]] bool isArrayOf(SuperType superType) const;
+  [[nodiscard]] bool isVector() const;
   [[nodiscard]] bool isDecayedArray() const;
   [[nodiscard]] bool isConstRef() const;
   [[nodiscard]] bool isIterator(const ASTNode *node) const;
   [[nodiscard]] bool isIterable(const ASTNode *node) const;
   [[nodiscard]] bool isStringObj() const;
   [[nodiscard]] bool isErrorObj() const;
+  [[nodiscard]] bool isFutureObj() const;
   [[nodiscard]] bool hasAnyGenericParts() const;
 
   // Complex queries on the type
   [[nodiscard]] bool isTriviallyConstructible(const ASTNode *node) const;
   [[nodiscard]] bool isTriviallyCopyable(const ASTNode *node) const;
   [[nodiscard]] bool isTriviallyDestructible(const ASTNode *node) const;
+  [[nodiscard]] bool isTriviallyRelocatable(const ASTNode *node) const;
   [[nodiscard]] bool doesImplement(const QualType &implementedInterfaceType, const ASTNode *node) const;
   [[nodiscard]] bool canBind(const QualType &inputType, bool isTemporary) const;
   [[nodiscard]] bool matches(const QualType &otherType, bool ignoreArraySize, bool ignoreQualifiers, bool allowConstify) const;
@@ -122,6 +129,7 @@ public:
   [[nodiscard]] QualType toRef(const ASTNode *node) const;
   [[nodiscard]] QualType toConstRef(const ASTNode *node) const;
   [[nodiscard]] QualType toArr(const ASTNode *node, size_t size, bool skipDynCheck = false) const;
+  [[nodiscard]] QualType toVec(const ASTNode *node, unsigned int laneCount) const;
   [[nodiscard]] QualType toNonConst() const;
   [[nodiscard]] QualType getContained() const;
   [[nodiscard]] QualType getBase() const;
@@ -76,6 +76,7 @@ public:
   friend class FunctionManager;
   friend class StructManager;
   friend class InterfaceManager;
+  friend class MemoryStatsCollector;
 
   // Public methods
   // Scope management
@@ -49,6 +49,7 @@ public:
   bool used = false;
   bool omitDtorCall = false;
   bool isImplicitField = false;
+  bool escapes = false; // Set for function pointers, that are used in other ways than being called
 
 private:
   // Members
@@ -16,6 +16,7 @@
 #include <symboltablebuilder/Scope.h>
 #include <symboltablebuilder/SymbolTableEntry.h>
 
+#include <llvm/IR/DerivedTypes.h>
 #include <llvm/IR/Module.h>
 #include <llvm/IR/Type.h>
 
@@ -62,6 +63,16 @@ unsigned int Type::getArraySize() const {
   return typeChain.back().data.arraySize;
 }
 
+/**
+ * Get the number of lanes of the current SIMD vector type
+ *
+ * @return Lane count
+ */
+unsigned int Type::getVectorLaneCount() const {
+  assert(isVector());
+  return typeChain.back().data.arraySize;
+}
+
 /**
  * Get the body scope of the current type
  *
@@ -169,10 +180,13 @@ bool Type::isPrimitive() const { return isOneOf({TY_DOUBLE, TY_INT, TY_SHORT, TY
  * - structs
  * - interfaces
  * - functions/procedures
+ * - SIMD vectors
  *
  * @return Extended primitive or not
  */
-bool Type::isExtendedPrimitive() const { return isPrimitive() || isOneOf({TY_STRUCT, TY_INTERFACE, TY_FUNCTION, TY_PROCEDURE}); }
+bool Type::isExtendedPrimitive() const {
+  return isPrimitive() || isOneOf({TY_STRUCT, TY_INTERFACE, TY_FUNCTION, TY_PROCEDURE, TY_VECTOR});
+}
 
 /**
  * Check if the current type is a pointer type
@@ -195,6 +209,13 @@ bool Type::isRef() const { return getSuperType() == TY_REF; }
  */
 bool Type::isArray() const { return getSuperType() == TY_ARRAY; }
 
+/**
+ * Check if the current type is a SIMD vector type
+ *
+ * @return Vector type or not
+ */
+bool Type::isVector() const { return getSuperType() == TY_VECTOR; }
+
 /**
  * Checks if the base type is generic itself or has generic parts in its template types
  *
@@ -224,7 +245,7 @@ bool Type::hasAnyGenericParts() const { // NOLINT(misc-no-recursion)
 
 /**
  * Check if the current type is of the same container type like the other type.
- * Only TY_PTR, TY_REF and TY_ARRAY are considered as container types.
+ * Only TY_PTR, TY_REF, TY_ARRAY and TY_VECTOR are considered as container types. Vectors additionally need the same lane count.
  *
  * @param other Other symbol type
  * @return Same container type or not
@@ -233,7 +254,8 @@ bool Type::isSameContainerTypeAs(const Type *other) const {
   const bool bothPtr = isPtr() && other->isPtr();
   const bool bothRef = isRef() && other->isRef();
   const bool bothArray = isArray() && other->isArray();
-  return bothPtr || bothRef || bothArray;
+  const bool bothVector = isVector() && other->isVector() && getVectorLaneCount() == other->getVectorLaneCount();
+  return bothPtr || bothRef || bothArray || bothVector;
 }
 
 /**
@@ -355,6 +377,29 @@ const Type *Type::toArr(const ASTNode *node, unsigned int size, bool skipDynChec
   return TypeRegistry::getOrInsert(newTypeChain);
 }
 
+/**
+ * Get the SIMD vector type with the current type as lane type as a new type
+ *
+ * @param node AST node for error messages
+ * @param laneCount Number of lanes
+ * @return Vector type of the current type
+ */
+const Type *Type::toVec(const ASTNode *node, unsigned int laneCount) const {
+  if (!isOneOf({TY_DOUBLE, TY_INT, TY_SHORT, TY_LONG, TY_BYTE, TY_CHAR, TY_BOOL, TY_GENERIC}))
+    throw SemanticError(node, VECTOR_LANE_TYPE_INVALID, "Only numeric, char and bool types can be used as vector lane type");
+  if (laneCount < 2 || laneCount > MAX_VECTOR_LANE_COUNT || (laneCount & (laneCount - 1)) != 0)
+    throw SemanticError(node, VECTOR_LANE_COUNT_INVALID,
+                        "The lane count of a vector must be a power of two between 2 and " +
+                            std::to_string(MAX_VECTOR_LANE_COUNT));
+
+  // Create new type chain
+  TypeChain newTypeChain = typeChain;
+  newTypeChain.emplace_back(TY_VECTOR, TypeChainElementData{.arraySize = laneCount});
+
+  // Register new type or return if already registered
+  return TypeRegistry::getOrInsert(newTypeChain);
+}
+
 /**
  * Retrieve the base type of an array or a pointer
  *
@@ -508,6 +553,11 @@ llvm::Type *Type::toLLVMType(SourceFile *sourceFile) const { // NOLINT(misc-no-r
     return llvm::ArrayType::get(containedType, getArraySize());
   }
 
+  if (isVector()) {
+    llvm::Type *laneType = sourceFile->getLLVMType(getContained());
+    return llvm::FixedVectorType::get(laneType, getVectorLaneCount());
+  }
+
   assert(!hasAnyGenericParts());
 
   if (is(TY_DOUBLE))
@@ -36,6 +36,7 @@ public:
   [[nodiscard]] SuperType getSuperType() const;
   [[nodiscard]] const std::string &getSubType() const;
   [[nodiscard]] unsigned int getArraySize() const;
+  [[nodiscard]] unsigned int getVectorLaneCount() const;
   [[nodiscard]] Scope *getBodyScope() const;
   [[nodiscard]] const QualType &getFunctionReturnType() const;
   [[nodiscard]] QualTypeList getFunctionParamTypes() const;
@@ -53,6 +54,7 @@ public:
   [[nodiscard]] bool isPtr() const;
   [[nodiscard]] bool isRef() const;
   [[nodiscard]] bool isArray() const;
+  [[nodiscard]] bool isVector() const;
   [[nodiscard]] bool hasAnyGenericParts() const;
 
   // Complex queries on the type
@@ -67,6 +69,7 @@ public:
   [[nodiscard]] const Type *toPtr(const ASTNode *node) const;
   [[nodiscard]] const Type *toRef(const ASTNode *node) const;
   [[nodiscard]] const Type *toArr(const ASTNode *node, unsigned int size, bool skipDynCheck) const;
+  [[nodiscard]] const Type *toVec(const ASTNode *node, unsigned int laneCount) const;
   [[nodiscard]] const Type *getContained() const;
   [[nodiscard]] const Type *replaceBase(const Type *newBaseType) const;
   [[nodiscard]] const Type *removeReferenceWrapper() const;
@@ -14,7 +14,8 @@ bool operator==(const TypeChainElement &lhs, const TypeChainElement &rhs) {
 
   // Check data
   switch (lhs.superType) {
-  case TY_ARRAY:
+  case TY_ARRAY: // fall-through
+  case TY_VECTOR:
     return lhs.data.arraySize == rhs.data.arraySize;
   case TY_STRUCT:
     assert(lhs.data.bodyScope != nullptr && rhs.data.bodyScope != nullptr);
@@ -55,6 +56,9 @@ void TypeChainElement::getName(std::stringstream &name, bool withSize, bool igno
       name << std::to_string(data.arraySize);
     name << "]";
     break;
+  case TY_VECTOR:
+    name << "<" << std::to_string(data.arraySize) << ">";
+    break;
   case TY_DOUBLE:
     name << "double";
     break;
@@ -15,6 +15,7 @@ class Scope;
 
 // Constants
 static constexpr long ARRAY_SIZE_UNKNOWN = 0;
+static constexpr unsigned int MAX_VECTOR_LANE_COUNT = 64;
 
 enum SuperType : uint8_t {
   TY_INVALID,
@@ -36,13 +37,14 @@ enum SuperType : uint8_t {
   TY_PTR,
   TY_REF,
   TY_ARRAY,
+  TY_VECTOR,
   TY_FUNCTION,
   TY_PROCEDURE,
   TY_IMPORT,
 };
 
 union TypeChainElementData {
-  unsigned int arraySize;     // TY_ARRAY
+  unsigned int arraySize;     // TY_ARRAY, TY_VECTOR (number of lanes)
   Scope *bodyScope = nullptr; // TY_STRUCT, TY_INTERFACE, TY_ENUM
   bool hasCaptures;           // TY_FUNCTION, TY_PROCEDURE (lambdas) or TY_STRUCT (special Lambda std type only)
 };
@@ -27,6 +27,7 @@ TypeQualifiers TypeQualifiers::of(uint16_t superType) {
   case TY_PTR:       // fall-through
   case TY_REF:       // fall-through
   case TY_ARRAY:     // fall-through
+  case TY_VECTOR:    // fall-through
   case TY_STRUCT:    // fall-through
   case TY_INTERFACE: // fall-through
   case TY_FUNCTION:  // fall-through
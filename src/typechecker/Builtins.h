@@ -47,8 +47,45 @@ static constexpr std::string_view BUILTIN_FCT_NAME_GET_BUILD_VAR = "__get_build_
 static constexpr std::string_view BUILTIN_FCT_NAME_IS_TRIVIALLY_CONSTRUCTIBLE = "__is_trivially_constructible";
 static constexpr std::string_view BUILTIN_FCT_NAME_IS_TRIVIALLY_COPYABLE = "__is_trivially_copyable";
 static constexpr std::string_view BUILTIN_FCT_NAME_IS_TRIVIALLY_DESTRUCTIBLE = "__is_trivially_destructible";
+static constexpr std::string_view BUILTIN_FCT_NAME_IS_TRIVIALLY_RELOCATABLE = "__is_trivially_relocatable";
 static constexpr std::string_view BUILTIN_FCT_NAME_NEW = "__new";
 static constexpr std::string_view BUILTIN_FCT_NAME_PLACEMENT_NEW = "__placement_new";
+static constexpr std::string_view BUILTIN_FCT_NAME_PTR_TO_INT = "__ptr_to_int";
+static constexpr std::string_view BUILTIN_FCT_NAME_ATOMIC_LOAD = "__atomic_load";
+static constexpr std::string_view BUILTIN_FCT_NAME_ATOMIC_STORE = "__atomic_store";
+static constexpr std::string_view BUILTIN_FCT_NAME_ATOMIC_EXCHANGE = "__atomic_exchange";
+static constexpr std::string_view BUILTIN_FCT_NAME_ATOMIC_COMPARE_EXCHANGE = "__atomic_compare_exchange";
+static constexpr std::string_view BUILTIN_FCT_NAME_ATOMIC_FETCH_ADD = "__atomic_fetch_add";
+static constexpr std::string_view BUILTIN_FCT_NAME_ATOMIC_FETCH_SUB = "__atomic_fetch_sub";
+static constexpr std::string_view BUILTIN_FCT_NAME_ATOMIC_FETCH_AND = "__atomic_fetch_and";
+static constexpr std::string_view BUILTIN_FCT_NAME_ATOMIC_FETCH_OR = "__atomic_fetch_or";
+static constexpr std::string_view BUILTIN_FCT_NAME_ATOMIC_FETCH_XOR = "__atomic_fetch_xor";
+static constexpr std::string_view BUILTIN_FCT_NAME_ATOMIC_FENCE = "__atomic_fence";
+static constexpr std::string_view BUILTIN_FCT_NAME_SIMD_SPLAT = "__simd_splat";
+static constexpr std::string_view BUILTIN_FCT_NAME_SIMD_LOAD = "__simd_load";
+static constexpr std::string_view BUILTIN_FCT_NAME_SIMD_STORE = "__simd_store";
+static constexpr std::string_view BUILTIN_FCT_NAME_SIMD_SELECT = "__simd_select";
+static constexpr std::string_view BUILTIN_FCT_NAME_SIMD_SHUFFLE = "__simd_shuffle";
+static constexpr std::string_view BUILTIN_FCT_NAME_SIMD_REDUCE_ADD = "__simd_reduce_add";
+static constexpr std::string_view BUILTIN_FCT_NAME_SIMD_REDUCE_MIN = "__simd_reduce_min";
+static constexpr std::string_view BUILTIN_FCT_NAME_SIMD_REDUCE_MAX = "__simd_reduce_max";
+static constexpr std::string_view BUILTIN_FCT_NAME_SIMD_REDUCE_AND = "__simd_reduce_and";
+static constexpr std::string_view BUILTIN_FCT_NAME_SIMD_REDUCE_OR = "__simd_reduce_or";
+static constexpr std::string_view BUILTIN_FCT_NAME_CORO_SUSPEND = "__coro_suspend";
+static constexpr std::string_view BUILTIN_FCT_NAME_CORO_RESUME = "__coro_resume";
+static constexpr std::string_view BUILTIN_FCT_NAME_CORO_DESTROY = "__coro_destroy";
+static constexpr std::string_view BUILTIN_FCT_NAME_CORO_DONE = "__coro_done";
+static constexpr std::string_view BUILTIN_FCT_NAME_CORO_DETACH = "__coro_detach";
+static constexpr std::string_view BUILTIN_FCT_NAME_CORO_RESULT = "__coro_result";
+
+// Memory orders, accepted by the atomic builtins. Must be kept in sync with the MemoryOrder enum in std/os/atomic.spice
+enum class BuiltinMemoryOrder : uint8_t {
+  RELAXED = 0,
+  ACQUIRE = 1,
+  RELEASE = 2,
+  ACQ_REL = 3,
+  SEQ_CST = 4,
+};
 
 static constexpr std::array BUILTIN_FUNCTIONS = {
     BuiltinFunctionEntry{
@@ -183,6 +220,14 @@ static constexpr std::array BUILTIN_FUNCTIONS = {
             .maxTemplateTypes = 1,
         },
     },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_IS_TRIVIALLY_RELOCATABLE,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinIsTriviallyRelocatable,
+            .minTemplateTypes = 1,
+            .maxTemplateTypes = 1,
+        },
+    },
     BuiltinFunctionEntry{
         BUILTIN_FCT_NAME_NEW,
         BuiltinFunctionInfo{
@@ -204,6 +249,261 @@ static constexpr std::array BUILTIN_FUNCTIONS = {
             .maxArgTypes = std::numeric_limits<unsigned int>::max(),
         },
     },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_PTR_TO_INT,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinPtrToIntCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinPtrToIntCall,
+            .minArgTypes = 1,
+            .maxArgTypes = 1,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_ATOMIC_LOAD,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinAtomicLoadCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinAtomicLoadCall,
+            .minArgTypes = 2,
+            .maxArgTypes = 2,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_ATOMIC_STORE,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinAtomicStoreCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinAtomicStoreCall,
+            .minArgTypes = 3,
+            .maxArgTypes = 3,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_ATOMIC_EXCHANGE,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinAtomicRMWCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinAtomicRMWCall,
+            .minArgTypes = 3,
+            .maxArgTypes = 3,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_ATOMIC_FETCH_ADD,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinAtomicRMWCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinAtomicRMWCall,
+            .minArgTypes = 3,
+            .maxArgTypes = 3,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_ATOMIC_FETCH_SUB,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinAtomicRMWCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinAtomicRMWCall,
+            .minArgTypes = 3,
+            .maxArgTypes = 3,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_ATOMIC_FETCH_AND,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinAtomicRMWCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinAtomicRMWCall,
+            .minArgTypes = 3,
+            .maxArgTypes = 3,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_ATOMIC_FETCH_OR,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinAtomicRMWCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinAtomicRMWCall,
+            .minArgTypes = 3,
+            .maxArgTypes = 3,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_ATOMIC_FETCH_XOR,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinAtomicRMWCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinAtomicRMWCall,
+            .minArgTypes = 3,
+            .maxArgTypes = 3,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_ATOMIC_COMPARE_EXCHANGE,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinAtomicCompareExchangeCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinAtomicCompareExchangeCall,
+            .minArgTypes = 5,
+            .maxArgTypes = 5,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_ATOMIC_FENCE,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinAtomicFenceCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinAtomicFenceCall,
+            .minArgTypes = 1,
+            .maxArgTypes = 1,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_SIMD_SPLAT,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinSimdSplatCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinSimdSplatCall,
+            .minTemplateTypes = 1,
+            .maxTemplateTypes = 1,
+            .minArgTypes = 1,
+            .maxArgTypes = 1,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_SIMD_LOAD,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinSimdLoadCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinSimdLoadCall,
+            .minTemplateTypes = 1,
+            .maxTemplateTypes = 1,
+            .minArgTypes = 1,
+            .maxArgTypes = 1,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_SIMD_STORE,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinSimdStoreCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinSimdStoreCall,
+            .minArgTypes = 2,
+            .maxArgTypes = 2,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_SIMD_SELECT,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinSimdSelectCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinSimdSelectCall,
+            .minArgTypes = 3,
+            .maxArgTypes = 3,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_SIMD_SHUFFLE,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinSimdShuffleCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinSimdShuffleCall,
+            // Two vectors, followed by one lane index per result lane
+            .minArgTypes = 4,
+            .maxArgTypes = 2 + MAX_VECTOR_LANE_COUNT,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_SIMD_REDUCE_ADD,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinSimdReduceCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinSimdReduceCall,
+            .minArgTypes = 1,
+            .maxArgTypes = 1,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_SIMD_REDUCE_MIN,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinSimdReduceCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinSimdReduceCall,
+            .minArgTypes = 1,
+            .maxArgTypes = 1,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_SIMD_REDUCE_MAX,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinSimdReduceCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinSimdReduceCall,
+            .minArgTypes = 1,
+            .maxArgTypes = 1,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_SIMD_REDUCE_AND,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinSimdReduceCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinSimdReduceCall,
+            .minArgTypes = 1,
+            .maxArgTypes = 1,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_SIMD_REDUCE_OR,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinSimdReduceCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinSimdReduceCall,
+            .minArgTypes = 1,
+            .maxArgTypes = 1,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_CORO_SUSPEND,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinCoroSuspendCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinCoroSuspendCall,
+            .minArgTypes = 1,
+            .maxArgTypes = 1,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_CORO_RESUME,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinCoroHandleCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinCoroResumeCall,
+            .minArgTypes = 1,
+            .maxArgTypes = 1,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_CORO_DESTROY,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinCoroHandleCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinCoroDestroyCall,
+            .minArgTypes = 1,
+            .maxArgTypes = 1,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_CORO_DONE,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinCoroHandleCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinCoroDoneCall,
+            // The result type of the coroutine, to locate its promise
+            .minTemplateTypes = 1,
+            .maxTemplateTypes = 1,
+            .minArgTypes = 1,
+            .maxArgTypes = 1,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_CORO_DETACH,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinCoroHandleCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinCoroDetachCall,
+            .minTemplateTypes = 1,
+            .maxTemplateTypes = 1,
+            .minArgTypes = 1,
+            .maxArgTypes = 1,
+        },
+    },
+    BuiltinFunctionEntry{
+        BUILTIN_FCT_NAME_CORO_RESULT,
+        BuiltinFunctionInfo{
+            .typeCheckerVisitMethod = &TypeChecker::visitBuiltinCoroHandleCall,
+            .irGeneratorVisitMethod = &IRGenerator::visitBuiltinCoroResultCall,
+            .minTemplateTypes = 1,
+            .maxTemplateTypes = 1,
+            .minArgTypes = 1,
+            .maxArgTypes = 1,
+        },
+    },
 };
 
 static const std::unordered_map<std::string_view, BuiltinFunctionInfo> BUILTIN_FUNCTIONS_MAP = [] {
@@ -0,0 +1,81 @@
+// Copyright (c) 2021-2026 ChilliBits. All rights reserved.
+
+#include "CompileTimeEvaluator.h"
+
+#include <ast/ASTNodes.h>
+#include <model/Function.h>
+#include <symboltablebuilder/SymbolTableEntry.h>
+
+namespace spice::compiler {
+
+CompileTimeEvaluator::CompileTimeEvaluator(GlobalResourceManager &resourceManager, SourceFile *sourceFile)
+    : CompilerPass(resourceManager, sourceFile), interpreter(resourceManager, sourceFile) {}
+
+void CompileTimeEvaluator::evaluate(ASTNode *ast) { visit(ast); }
+
+std::any CompileTimeEvaluator::visitFctDef(FctDefNode *node) {
+  visitManifestations(node);
+  return nullptr;
+}
+
+std::any CompileTimeEvaluator::visitProcDef(ProcDefNode *node) {
+  visitManifestations(node);
+  return nullptr;
+}
+
+std::any CompileTimeEvaluator::visitFctCall(FctCallNode *node) {
+  // Evaluate nested calls in the arguments first
+  visitChildren(node);
+
+  FctCallNode::FctCallData &data = node->data.at(manIdx);
+  if (!data.isOrdinaryCall() || data.callee == nullptr || !data.callee->isCompileTime || data.hasCompileTimeValue())
+    return nullptr;
+
+  // Calls with arguments, that are only known at runtime, stay ordinary calls
+  InterpreterValue result;
+  if (!interpreter.tryEvaluate(node, manIdx, result))
+    return nullptr;
+
+  if (data.callee->returnType.isArray()) {
+    flattenArray(result, data.compileTimeArrayItems);
+    data.compileTimeArrayItemsSet = true;
+  } else {
+    data.setCompileTimeValue(result.value);
+  }
+  return nullptr;
+}
+
+/**
+ * Visit the body of all manifestations of a function or procedure, that will end up in the output
+ *
+ * @param node Function or procedure definition
+ */
+void CompileTimeEvaluator::visitManifestations(FctDefBaseNode *node) {
+  manIdx = 0;
+  for (const Function *manifestation : node->manifestations) {
+    // Skip manifestations, for which the IR generator does not emit any code
+    const bool isPublic = manifestation->entry->getQualType().isPublic();
+    if (manifestation->isFullySubstantiated() && (isPublic || manifestation->used))
+      visitChildren(node);
+    manIdx++;
+  }
+  manIdx = 0;
+}
+
+/**
+ * Flatten the items of a (multi-dimensional) array into a list of scalars in memory order
+ *
+ * @param value Array value
+ * @param items List of scalars
+ */
+void CompileTimeEvaluator::flattenArray(const InterpreterValue &value, // NOLINT(misc-no-recursion)
+                                        std::vector<CompileTimeValue> &items) {
+  if (value.items.empty()) {
+    items.push_back(value.value);
+    return;
+  }
+  for (const InterpreterValue &item : value.items)
+    flattenArray(item, items);
+}
+
+} // namespace spice::compiler
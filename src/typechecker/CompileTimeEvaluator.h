@@ -0,0 +1,38 @@
+// Copyright (c) 2021-2026 ChilliBits. All rights reserved.
+
+#pragma once
+
+#include <CompilerPass.h>
+#include <ast/ASTVisitor.h>
+#include <typechecker/CompileTimeInterpreter.h>
+
+namespace spice::compiler {
+
+/**
+ * Evaluates all calls to #[compileTime] functions, whose arguments are known at compile time, after the type checker
+ * has converged. The results are attached to the call nodes, so that the IR generator emits them as constants instead
+ * of calls.
+ */
+class CompileTimeEvaluator final : CompilerPass, public ASTVisitor {
+public:
+  // Constructors
+  CompileTimeEvaluator(GlobalResourceManager &resourceManager, SourceFile *sourceFile);
+
+  // Public methods
+  void evaluate(ASTNode *ast);
+
+private:
+  // Private members
+  CompileTimeInterpreter interpreter;
+
+  // Visitor methods
+  std::any visitFctDef(FctDefNode *node) override;
+  std::any visitProcDef(ProcDefNode *node) override;
+  std::any visitFctCall(FctCallNode *node) override;
+
+  // Private methods
+  void visitManifestations(FctDefBaseNode *node);
+  static void flattenArray(const InterpreterValue &value, std::vector<CompileTimeValue> &items);
+};
+
+} // namespace spice::compiler
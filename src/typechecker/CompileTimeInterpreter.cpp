@@ -0,0 +1,1094 @@
+// Copyright (c) 2021-2026 ChilliBits. All rights reserved.
+
+#include "CompileTimeInterpreter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <exception/CompilerError.h>
+#include <exception/SemanticError.h>
+#include <global/GlobalResourceManager.h>
+#include <model/Function.h>
+#include <symboltablebuilder/Scope.h>
+#include <symboltablebuilder/SymbolTableBuilder.h>
+#include <symboltablebuilder/SymbolTableEntry.h>
+
+namespace spice::compiler {
+
+CompileTimeInterpreter::CompileTimeInterpreter(GlobalResourceManager &resourceManager, SourceFile *sourceFile)
+    : CompilerPass(resourceManager, sourceFile) {}
+
+/**
+ * Try to evaluate a call to a compile-time function. This only succeeds if all arguments are known at compile time.
+ *
+ * @param node Call to evaluate
+ * @param callerManIdx Manifestation index of the function, that contains the call
+ * @param result Result of the evaluation
+ * @return Evaluated or not
+ */
+bool CompileTimeInterpreter::tryEvaluate(const FctCallNode *node, size_t callerManIdx, InterpreterValue &result) {
+  const Function *callee = node->data.at(callerManIdx).callee;
+  assert(callee != nullptr && callee->isCompileTime);
+  manIdx = callerManIdx;
+  steps = 0;
+  frames.reserve(MAX_COMPILE_TIME_CALL_DEPTH + 2); // Keep references to variables valid across nested calls
+
+  // Evaluate the arguments in the context of the caller, which has no variables, that are known at compile time
+  frames.emplace_back();
+  std::vector<InterpreterValue> args;
+  try {
+    args = evaluateArgs(node, callee);
+  } catch (NotCompileTimeKnown &) {
+    frames.clear();
+    return false;
+  }
+
+  result = callFunction(node, callee, args);
+  frames.clear();
+  return true;
+}
+
+/**
+ * Check if values of the given type can be handled by the interpreter
+ *
+ * @param type Type to check
+ * @return Supported or not
+ */
+bool CompileTimeInterpreter::isSupportedType(const QualType &type) {
+  QualType baseType = type;
+  while (baseType.isArray())
+    baseType = baseType.getContained();
+  return baseType.isPrimitive() || baseType.is(TY_GENERIC);
+}
+
+std::any CompileTimeInterpreter::visitUnsafeBlock(UnsafeBlockNode *node) {
+  abortEvaluation(node, "Unsafe blocks are not supported at compile time");
+}
+
+std::any CompileTimeInterpreter::visitForLoop(ForLoopNode *node) {
+  visit(node->initDecl);
+  while (evaluateCondition(node->condAssign)) {
+    countStep(node);
+    visit(node->body);
+    if (consumeLoopControl())
+      break;
+    evaluate(node->incAssign);
+  }
+  return nullptr;
+}
+
+std::any CompileTimeInterpreter::visitForeachLoop(ForeachLoopNode *node) {
+  abortEvaluation(node, "Foreach loops are not supported at compile time");
+}
+
+std::any CompileTimeInterpreter::visitWhileLoop(WhileLoopNode *node) {
+  while (evaluateCondition(node->condition)) {
+    countStep(node);
+    visit(node->body);
+    if (consumeLoopControl())
+      break;
+  }
+  return nullptr;
+}
+
+std::any CompileTimeInterpreter::visitDoWhileLoop(DoWhileLoopNode *node) {
+  do {
+    countStep(node);
+    visit(node->body);
+    if (consumeLoopControl())
+      break;
+  } while (evaluateCondition(node->condition));
+  return nullptr;
+}
+
+std::any CompileTimeInterpreter::visitIfStmt(IfStmtNode *node) {
+  if (evaluateCondition(node->condition))
+    visit(node->thenBody);
+  else if (node->elseStmt)
+    visit(node->elseStmt);
+  return nullptr;
+}
+
+std::any CompileTimeInterpreter::visitElseStmt(ElseStmtNode *node) {
+  if (node->isElseIf)
+    visit(node->ifStmt);
+  else
+    visit(node->body);
+  return nullptr;
+}
+
+std::any CompileTimeInterpreter::visitSwitchStmt(SwitchStmtNode *node) {
+  abortEvaluation(node, "Switch statements are not supported at compile time");
+}
+
+std::any CompileTimeInterpreter::visitAssertStmt(AssertStmtNode *node) {
+  if (!evaluateCondition(node->assignExpr))
+    throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, "Assertion failed at compile time: " + node->expressionString);
+  return nullptr;
+}
+
+std::any CompileTimeInterpreter::visitAnonymousBlockStmt(AnonymousBlockStmtNode *node) {
+  visit(node->body);
+  return nullptr;
+}
+
+std::any CompileTimeInterpreter::visitStmtLst(StmtLstNode *node) {
+  for (StmtNode *stmt : node->statements) {
+    countStep(stmt);
+    visit(stmt);
+    // Stop executing the block on return, break and continue
+    if (returned || pendingBreaks > 0 || pendingContinues > 0)
+      break;
+  }
+  return nullptr;
+}
+
+std::any CompileTimeInterpreter::visitDeclStmt(DeclStmtNode *node) {
+  const SymbolTableEntry *entry = node->entries.at(manIdx);
+  assert(entry != nullptr);
+  const QualType varType = entry->getQualType();
+  if (!isSupportedType(varType))
+    abortEvaluation(node, "Variables of type '" + varType.getName(false) + "' are not supported at compile time");
+
+  if (node->hasAssignment) {
+    const InterpreterValue value = evaluate(node->assignExpr);
+    InterpreterValue &var = frames.back().variables[entry];
+    var = convert(value, node->assignExpr->getEvaluatedSymbolType(manIdx), varType);
+    // Fill up arrays, that got initialized with fewer items than their size
+    if (varType.isArray() && var.items.size() < varType.getArraySize())
+      var.items.resize(varType.getArraySize(), getDefaultValue(node, varType.getContained()));
+  } else {
+    frames.back().variables[entry] = getDefaultValue(node, varType);
+  }
+  return nullptr;
+}
+
+std::any CompileTimeInterpreter::visitExprStmt(ExprStmtNode *node) {
+  evaluate(node->expr);
+  return nullptr;
+}
+
+std::any CompileTimeInterpreter::visitReturnStmt(ReturnStmtNode *node) {
+  if (node->hasReturnValue) {
+    const SymbolTableEntry *resultEntry = frames.back().resultEntry;
+    const InterpreterValue value = evaluate(node->assignExpr);
+    const QualType &valueType = node->assignExpr->getEvaluatedSymbolType(manIdx);
+    frames.back().variables[resultEntry] = convert(value, valueType, resultEntry->getQualType());
+  }
+  returned = true;
+  return nullptr;
+}
+
+std::any CompileTimeInterpreter::visitBreakStmt(BreakStmtNode *node) {
+  pendingBreaks = static_cast<size_t>(node->breakTimes);
+  return nullptr;
+}
+
+std::any CompileTimeInterpreter::visitContinueStmt(ContinueStmtNode *node) {
+  pendingContinues = static_cast<size_t>(node->continueTimes);
+  return nullptr;
+}
+
+std::any CompileTimeInterpreter::visitFallthroughStmt(FallthroughStmtNode *node) {
+  abortEvaluation(node, "Fallthrough statements are not supported at compile time");
+}
+
+std::any CompileTimeInterpreter::visitAssignExpr(AssignExprNode *node) {
+  // Check if ternary
+  if (node->op == AssignExprNode::AssignOp::OP_NONE)
+    return visit(node->ternaryExpr);
+
+  ensureNoOpOverloading(node, node->opFct.at(manIdx));
+  const QualType lhsType = node->lhs->getEvaluatedSymbolType(manIdx);
+  const QualType rhsType = node->rhs->getEvaluatedSymbolType(manIdx);
+  const InterpreterValue rhs = evaluate(node->rhs);
+  InterpreterValue &lhs = resolveLValue(node->lhs);
+
+  ArithmeticOp op;
+  switch (node->op) {
+  case AssignExprNode::AssignOp::OP_ASSIGN:
+    lhs = convert(rhs, rhsType, lhsType);
+    return lhs;
+  case AssignExprNode::AssignOp::OP_PLUS_EQUAL:
+    op = ArithmeticOp::OP_ADD;
+    break;
+  case AssignExprNode::AssignOp::OP_MINUS_EQUAL:
+    op = ArithmeticOp::OP_SUB;
+    break;
+  case AssignExprNode::AssignOp::OP_MUL_EQUAL:
+    op = ArithmeticOp::OP_MUL;
+    break;
+  case AssignExprNode::AssignOp::OP_DIV_EQUAL:
+    op = ArithmeticOp::OP_DIV;
+    break;
+  case AssignExprNode::AssignOp::OP_REM_EQUAL:
+    op = ArithmeticOp::OP_REM;
+    break;
+  case AssignExprNode::AssignOp::OP_SHL_EQUAL:
+    op = ArithmeticOp::OP_SHL;
+    break;
+  case AssignExprNode::AssignOp::OP_SHR_EQUAL:
+    op = ArithmeticOp::OP_SHR;
+    break;
+  case AssignExprNode::AssignOp::OP_AND_EQUAL:
+    op = ArithmeticOp::OP_AND;
+    break;
+  case AssignExprNode::AssignOp::OP_OR_EQUAL:
+    op = ArithmeticOp::OP_OR;
+    break;
+  case AssignExprNode::AssignOp::OP_XOR_EQUAL:
+    op = ArithmeticOp::OP_XOR;
+    break;
+  default:                                                              // GCOV_EXCL_LINE
+    throw CompilerError(UNHANDLED_BRANCH, "AssignExpr fall-through"); // GCOV_EXCL_LINE
+  }
+  lhs.value = applyArithmeticOp(node, op, lhs.value, lhsType, rhs.value, rhsType, lhsType);
+  return lhs;
+}
+
+std::any CompileTimeInterpreter::visitTernaryExpr(TernaryExprNode *node) {
+  // Check if there is a ternary operator applied
+  if (!node->falseExpr)
+    return visit(node->condition);
+
+  // Shortened ternary: the condition is also the value for the true case
+  if (node->isShortened) {
+    InterpreterValue condition = evaluate(node->condition);
+    return condition.value.boolValue ? condition : evaluate(node->falseExpr);
+  }
+
+  return evaluateCondition(node->condition) ? visit(node->trueExpr) : visit(node->falseExpr);
+}
+
+std::any CompileTimeInterpreter::visitLogicalOrExpr(LogicalOrExprNode *node) {
+  // Check if a logical or operator is applied
+  if (node->operands.size() == 1)
+    return visit(node->operands.front());
+
+  // Short-circuit evaluation
+  for (ExprNode *operand : node->operands)
+    if (evaluateCondition(operand))
+      return InterpreterValue{.value = {.boolValue = true}};
+  return InterpreterValue{.value = {.boolValue = false}};
+}
+
+std::any CompileTimeInterpreter::visitLogicalAndExpr(LogicalAndExprNode *node) {
+  // Check if a logical and operator is applied
+  if (node->operands.size() == 1)
+    return visit(node->operands.front());
+
+  // Short-circuit evaluation
+  for (ExprNode *operand : node->operands)
+    if (!evaluateCondition(operand))
+      return InterpreterValue{.value = {.boolValue = false}};
+  return InterpreterValue{.value = {.boolValue = true}};
+}
+
+std::any CompileTimeInterpreter::visitBitwiseOrExpr(BitwiseOrExprNode *node) {
+  // Check if a bitwise or operator is applied
+  if (node->operands.size() == 1)
+    return visit(node->operands.front());
+
+  ensureNoOpOverloading(node, node->opFct.at(manIdx));
+  const QualType resultType = node->getEvaluatedSymbolType(manIdx);
+  QualType lhsType = node->operands.front()->getEvaluatedSymbolType(manIdx);
+  InterpreterValue result = evaluate(node->operands.front());
+  for (size_t i = 1; i < node->operands.size(); i++) {
+    const QualType rhsType = node->operands.at(i)->getEvaluatedSymbolType(manIdx);
+    const InterpreterValue rhs = evaluate(node->operands.at(i));
+    result.value = applyArithmeticOp(node, ArithmeticOp::OP_OR, result.value, lhsType, rhs.value, rhsType, resultType);
+    lhsType = resultType;
+  }
+  return result;
+}
+
+std::any CompileTimeInterpreter::visitBitwiseXorExpr(BitwiseXorExprNode *node) {
+  // Check if a bitwise xor operator is applied
+  if (node->operands.size() == 1)
+    return visit(node->operands.front());
+
+  ensureNoOpOverloading(node, node->opFct.at(manIdx));
+  const QualType resultType = node->getEvaluatedSymbolType(manIdx);
+  QualType lhsType = node->operands.front()->getEvaluatedSymbolType(manIdx);
+  InterpreterValue result = evaluate(node->operands.front());
+  for (size_t i = 1; i < node->operands.size(); i++) {
+    const QualType rhsType = node->operands.at(i)->getEvaluatedSymbolType(manIdx);
+    const InterpreterValue rhs = evaluate(node->operands.at(i));
+    result.value = applyArithmeticOp(node, ArithmeticOp::OP_XOR, result.value, lhsType, rhs.value, rhsType, resultType);
+    lhsType = resultType;
+  }
+  return result;
+}
+
+std::any CompileTimeInterpreter::visitBitwiseAndExpr(BitwiseAndExprNode *node) {
+  // Check if a bitwise and operator is applied
+  if (node->operands.size() == 1)
+    return visit(node->operands.front());
+
+  ensureNoOpOverloading(node, node->opFct.at(manIdx));
+  const QualType resultType = node->getEvaluatedSymbolType(manIdx);
+  QualType lhsType = node->operands.front()->getEvaluatedSymbolType(manIdx);
+  InterpreterValue result = evaluate(node->operands.front());
+  for (size_t i = 1; i < node->operands.size(); i++) {
+    const QualType rhsType = node->operands.at(i)->getEvaluatedSymbolType(manIdx);
+    const InterpreterValue rhs = evaluate(node->operands.at(i));
+    result.value = applyArithmeticOp(node, ArithmeticOp::OP_AND, result.value, lhsType, rhs.value, rhsType, resultType);
+    lhsType = resultType;
+  }
+  return result;
+}
+
+std::any CompileTimeInterpreter::visitEqualityExpr(EqualityExprNode *node) {
+  // Check if at least one equality operator is applied
+  if (node->operands.size() == 1)
+    return visit(node->operands.front());
+
+  ensureNoOpOverloading(node, node->opFct.at(manIdx));
+  ExprNode *lhsNode = node->operands.at(0);
+  ExprNode *rhsNode = node->operands.at(1);
+  const InterpreterValue lhs = evaluate(lhsNode);
+  const InterpreterValue rhs = evaluate(rhsNode);
+  const QualType lhsType = lhsNode->getEvaluatedSymbolType(manIdx);
+  const QualType rhsType = rhsNode->getEvaluatedSymbolType(manIdx);
+  const bool isEqual = compare(node, lhs.value, lhsType, rhs.value, rhsType) == 0;
+  const bool result = node->op == EqualityExprNode::EqualityOp::OP_EQUAL ? isEqual : !isEqual;
+  return InterpreterValue{.value = {.boolValue = result}};
+}
+
+std::any CompileTimeInterpreter::visitRelationalExpr(RelationalExprNode *node) {
+  // Check if a relational operator is applied
+  if (node->operands.size() == 1)
+    return visit(node->operands.front());
+
+  ExprNode *lhsNode = node->operands.at(0);
+  ExprNode *rhsNode = node->operands.at(1);
+  const InterpreterValue lhs = evaluate(lhsNode);
+  const InterpreterValue rhs = evaluate(rhsNode);
+  const QualType lhsType = lhsNode->getEvaluatedSymbolType(manIdx);
+  const QualType rhsType = rhsNode->getEvaluatedSymbolType(manIdx);
+  const int comparison = compare(node, lhs.value, lhsType, rhs.value, rhsType);
+
+  bool result;
+  switch (node->op) {
+  case RelationalExprNode::RelationalOp::OP_LESS:
+    result = comparison < 0;
+    break;
+  case RelationalExprNode::RelationalOp::OP_GREATER:
+    result = comparison > 0;
+    break;
+  case RelationalExprNode::RelationalOp::OP_LESS_EQUAL:
+    result = comparison <= 0;
+    break;
+  case RelationalExprNode::RelationalOp::OP_GREATER_EQUAL:
+    result = comparison >= 0;
+    break;
+  default:                                                                  // GCOV_EXCL_LINE
+    throw CompilerError(UNHANDLED_BRANCH, "RelationalExpr fall-through"); // GCOV_EXCL_LINE
+  }
+  return InterpreterValue{.value = {.boolValue = result}};
+}
+
+std::any CompileTimeInterpreter::visitShiftExpr(ShiftExprNode *node) {
+  // Check if at least one shift operator is applied
+  if (node->operands.size() == 1)
+    return visit(node->operands.front());
+
+  ensureNoOpOverloading(node, node->opFct.at(manIdx));
+  QualType lhsType = node->operands.front()->getEvaluatedSymbolType(manIdx);
+  InterpreterValue lhs = evaluate(node->operands.front());
+
+  auto opQueue = node->opQueue;
+  size_t operandIndex = 1;
+  while (!opQueue.empty()) {
+    ExprNode *rhsNode = node->operands.at(operandIndex++);
+    const QualType rhsType = rhsNode->getEvaluatedSymbolType(manIdx);
+    const InterpreterValue rhs = evaluate(rhsNode);
+    const auto &[op, resultType] = opQueue.front();
+    const ArithmeticOp arithmeticOp =
+        op == ShiftExprNode::ShiftOp::OP_SHIFT_LEFT ? ArithmeticOp::OP_SHL : ArithmeticOp::OP_SHR;
+    lhs.value = applyArithmeticOp(node, arithmeticOp, lhs.value, lhsType, rhs.value, rhsType, resultType);
+    lhsType = resultType;
+    opQueue.pop();
+  }
+  return lhs;
+}
+
+std::any CompileTimeInterpreter::visitAdditiveExpr(AdditiveExprNode *node) {
+  // Check if at least one additive operator is applied
+  if (node->operands.size() == 1)
+    return visit(node->operands.front());
+
+  ensureNoOpOverloading(node, node->opFct.at(manIdx));
+  QualType lhsType = node->operands.front()->getEvaluatedSymbolType(manIdx);
+  InterpreterValue lhs = evaluate(node->operands.front());
+
+  auto opQueue = node->opQueue;
+  size_t operandIndex = 1;
+  while (!opQueue.empty()) {
+    ExprNode *rhsNode = node->operands.at(operandIndex++);
+    const QualType rhsType = rhsNode->getEvaluatedSymbolType(manIdx);
+    const InterpreterValue rhs = evaluate(rhsNode);
+    const auto &[op, resultType] = opQueue.front();
+    const ArithmeticOp arithmeticOp = op == AdditiveExprNode::AdditiveOp::OP_PLUS ? ArithmeticOp::OP_ADD : ArithmeticOp::OP_SUB;
+    lhs.value = applyArithmeticOp(node, arithmeticOp, lhs.value, lhsType, rhs.value, rhsType, resultType);
+    lhsType = resultType;
+    opQueue.pop();
+  }
+  return lhs;
+}
+
+std::any CompileTimeInterpreter::visitMultiplicativeExpr(MultiplicativeExprNode *node) {
+  // Check if at least one multiplicative operator is applied
+  if (node->operands.size() == 1)
+    return visit(node->operands.front());
+
+  ensureNoOpOverloading(node, node->opFct.at(manIdx));
+  QualType lhsType = node->operands.front()->getEvaluatedSymbolType(manIdx);
+  InterpreterValue lhs = evaluate(node->operands.front());
+
+  auto opQueue = node->opQueue;
+  size_t operandIndex = 1;
+  while (!opQueue.empty()) {
+    ExprNode *rhsNode = node->operands.at(operandIndex++);
+    const QualType rhsType = rhsNode->getEvaluatedSymbolType(manIdx);
+    const InterpreterValue rhs = evaluate(rhsNode);
+    const auto &[op, resultType] = opQueue.front();
+    ArithmeticOp arithmeticOp;
+    switch (op) {
+    case MultiplicativeExprNode::MultiplicativeOp::OP_MUL:
+      arithmeticOp = ArithmeticOp::OP_MUL;
+      break;
+    case MultiplicativeExprNode::MultiplicativeOp::OP_DIV:
+      arithmeticOp = ArithmeticOp::OP_DIV;
+      break;
+    case MultiplicativeExprNode::MultiplicativeOp::OP_REM:
+      arithmeticOp = ArithmeticOp::OP_REM;
+      break;
+    default:                                                                      // GCOV_EXCL_LINE
+      throw CompilerError(UNHANDLED_BRANCH, "MultiplicativeExpr fall-through"); // GCOV_EXCL_LINE
+    }
+    lhs.value = applyArithmeticOp(node, arithmeticOp, lhs.value, lhsType, rhs.value, rhsType, resultType);
+    lhsType = resultType;
+    opQueue.pop();
+  }
+  return lhs;
+}
+
+std::any CompileTimeInterpreter::visitCastExpr(CastExprNode *node) {
+  // Check if a cast is applied
+  if (!node->isCast)
+    return visit(node->prefixUnaryExpr);
+
+  const QualType srcType = node->assignExpr->getEvaluatedSymbolType(manIdx);
+  const QualType dstType = node->getEvaluatedSymbolType(manIdx);
+  if (!srcType.isPrimitive() || !dstType.isPrimitive() || srcType.is(TY_STRING) != dstType.is(TY_STRING))
+    abortEvaluation(node, "Casting from '" + srcType.getName(false) + "' to '" + dstType.getName(false) +
+                              "' is not supported at compile time");
+  return convert(evaluate(node->assignExpr), srcType, dstType);
+}
+
+std::any CompileTimeInterpreter::visitPrefixUnaryExpr(PrefixUnaryExprNode *node) {
+  // If no operator is applied, simply visit the postfix unary expression
+  if (node->op == PrefixUnaryExprNode::PrefixUnaryOp::OP_NONE)
+    return visit(node->postfixUnaryExpr);
+
+  ensureNoOpOverloading(node, node->opFct.at(manIdx));
+  ExprNode *operandNode = node->prefixUnaryExpr;
+  const QualType operandType = operandNode->getEvaluatedSymbolType(manIdx);
+  const CompileTimeValue zero = fromLong(0, operandType);
+  const CompileTimeValue one = fromLong(1, operandType);
+
+  switch (node->op) {
+  case PrefixUnaryExprNode::PrefixUnaryOp::OP_MINUS: {
+    InterpreterValue operand = evaluate(operandNode);
+    operand.value = applyArithmeticOp(node, ArithmeticOp::OP_SUB, zero, operandType, operand.value, operandType, operandType);
+    return operand;
+  }
+  case PrefixUnaryExprNode::PrefixUnaryOp::OP_PLUS_PLUS: {
+    InterpreterValue &operand = resolveLValue(operandNode);
+    operand.value = applyArithmeticOp(node, ArithmeticOp::OP_ADD, operand.value, operandType, one, operandType, operandType);
+    return operand;
+  }
+  case PrefixUnaryExprNode::PrefixUnaryOp::OP_MINUS_MINUS: {
+    InterpreterValue &operand = resolveLValue(operandNode);
+    operand.value = applyArithmeticOp(node, ArithmeticOp::OP_SUB, operand.value, operandType, one, operandType, operandType);
+    return operand;
+  }
+  case PrefixUnaryExprNode::PrefixUnaryOp::OP_NOT:
+    return InterpreterValue{.value = {.boolValue = !evaluateCondition(operandNode)}};
+  case PrefixUnaryExprNode::PrefixUnaryOp::OP_BITWISE_NOT: {
+    InterpreterValue operand = evaluate(operandNode);
+    operand.value = fromLong(~toLong(operand.value, operandType), operandType);
+    return operand;
+  }
+  case PrefixUnaryExprNode::PrefixUnaryOp::OP_AWAIT:
+    abortEvaluation(node, "Await is not supported at compile time");
+  default:
+    abortEvaluation(node, "Pointers are not supported at compile time");
+  }
+}
+
+std::any CompileTimeInterpreter::visitPostfixUnaryExpr(PostfixUnaryExprNode *node) {
+  // If no operator is applied, simply visit the atomic expression
+  if (node->op == PostfixUnaryExprNode::PostfixUnaryOp::OP_NONE)
+    return visit(node->atomicExpr);
+
+  ensureNoOpOverloading(node, node->opFct.at(manIdx));
+  ExprNode *operandNode = node->postfixUnaryExpr;
+  const QualType operandType = operandNode->getEvaluatedSymbolType(manIdx);
+
+  switch (node->op) {
+  case PostfixUnaryExprNode::PostfixUnaryOp::OP_SUBSCRIPT: {
+    const InterpreterValue operand = evaluate(operandNode);
+    ExprNode *indexNode = node->subscriptIndexExpr;
+    const int64_t index = toLong(evaluate(indexNode).value, indexNode->getEvaluatedSymbolType(manIdx));
+    // Indexing a string yields a char
+    if (operandType.is(TY_STRING)) {
+      const std::string &stringValue = resourceManager.compileTimeStringValues.at(operand.value.stringValueOffset);
+      if (index < 0 || std::cmp_greater(index, stringValue.size()))
+        abortEvaluation(node, "String index " + std::to_string(index) + " is out of bounds");
+      const char item = std::cmp_equal(index, stringValue.size()) ? '\0' : stringValue.at(index);
+      return InterpreterValue{.value = {.longValue = item}};
+    }
+    if (!operandType.isArray())
+      abortEvaluation(node, "Subscripting pointers is not supported at compile time");
+    if (index < 0 || std::cmp_greater_equal(index, operand.items.size()))
+      abortEvaluation(node, "Array index " + std::to_string(index) + " is out of bounds");
+    return operand.items.at(index);
+  }
+  case PostfixUnaryExprNode::PostfixUnaryOp::OP_MEMBER_ACCESS:
+    abortEvaluation(node, "Member access is not supported at compile time");
+  case PostfixUnaryExprNode::PostfixUnaryOp::OP_PLUS_PLUS: {
+    InterpreterValue &operand = resolveLValue(operandNode);
+    const InterpreterValue oldValue = operand;
+    const CompileTimeValue one = fromLong(1, operandType);
+    operand.value = applyArithmeticOp(node, ArithmeticOp::OP_ADD, operand.value, operandType, one, operandType, operandType);
+    return oldValue;
+  }
+  case PostfixUnaryExprNode::PostfixUnaryOp::OP_MINUS_MINUS: {
+    InterpreterValue &operand = resolveLValue(operandNode);
+    const InterpreterValue oldValue = operand;
+    const CompileTimeValue one = fromLong(1, operandType);
+    operand.value = applyArithmeticOp(node, ArithmeticOp::OP_SUB, operand.value, operandType, one, operandType, operandType);
+    return oldValue;
+  }
+  default:                                                                    // GCOV_EXCL_LINE
+    throw CompilerError(UNHANDLED_BRANCH, "PostfixUnaryExpr fall-through"); // GCOV_EXCL_LINE
+  }
+}
+
+std::any CompileTimeInterpreter::visitAtomicExpr(AtomicExprNode *node) {
+  if (node->constant)
+    return visit(node->constant);
+  if (node->value)
+    return visit(node->value);
+  if (node->assignExpr)
+    return visit(node->assignExpr);
+  return readVariable(node);
+}
+
+std::any CompileTimeInterpreter::visitValue(ValueNode *node) {
+  if (node->isNil)
+    abortEvaluation(node, "Nil values are not supported at compile time");
+  if (node->fctCall)
+    return visit(node->fctCall);
+  if (node->arrayInitialization)
+    return visit(node->arrayInitialization);
+  if (node->structInstantiation)
+    return visit(node->structInstantiation);
+  if (node->lambdaFunc)
+    return visit(node->lambdaFunc);
+  if (node->lambdaProc)
+    return visit(node->lambdaProc);
+  assert(node->lambdaExpr != nullptr);
+  return visit(node->lambdaExpr);
+}
+
+std::any CompileTimeInterpreter::visitConstant(ConstantNode *node) { return InterpreterValue{.value = node->compileTimeValue}; }
+
+std::any CompileTimeInterpreter::visitFctCall(FctCallNode *node) {
+  // Builtin calls like sizeof or len, that already got a value from the type checker
+  if (node->hasCompileTimeValue(manIdx))
+    return InterpreterValue{.value = node->getCompileTimeValue(manIdx)};
+
+  const FctCallNode::FctCallData &data = node->data.at(manIdx);
+  if (!data.isOrdinaryCall() || data.callee == nullptr || !data.callee->isCompileTime)
+    abortEvaluation(node, "Only functions, that are marked with #[compileTime], can be called at compile time");
+
+  const std::vector<InterpreterValue> args = evaluateArgs(node, data.callee);
+  return callFunction(node, data.callee, args);
+}
+
+std::any CompileTimeInterpreter::visitArrayInitialization(ArrayInitializationNode *node) {
+  InterpreterValue array;
+  if (node->actualSize == 0)
+    return array;
+
+  const QualType itemType = node->getEvaluatedSymbolType(manIdx).getContained();
+  array.items.reserve(node->actualSize);
+  for (ExprNode *itemNode : node->itemLst->args)
+    array.items.push_back(convert(evaluate(itemNode), itemNode->getEvaluatedSymbolType(manIdx), itemType));
+  return array;
+}
+
+std::any CompileTimeInterpreter::visitStructInstantiation(StructInstantiationNode *node) {
+  abortEvaluation(node, "Structs are not supported at compile time");
+}
+
+std::any CompileTimeInterpreter::visitLambdaFunc(LambdaFuncNode *node) {
+  abortEvaluation(node, "Lambdas are not supported at compile time");
+}
+
+std::any CompileTimeInterpreter::visitLambdaProc(LambdaProcNode *node) {
+  abortEvaluation(node, "Lambdas are not supported at compile time");
+}
+
+std::any CompileTimeInterpreter::visitLambdaExpr(LambdaExprNode *node) {
+  abortEvaluation(node, "Lambdas are not supported at compile time");
+}
+
+InterpreterValue CompileTimeInterpreter::evaluate(ExprNode *node) { return std::any_cast<InterpreterValue>(visit(node)); }
+
+/**
+ * Evaluate the arguments of a call and convert them to the parameter types of the callee
+ *
+ * @param node Call node
+ * @param callee Called function
+ * @return Argument values
+ */
+std::vector<InterpreterValue> CompileTimeInterpreter::evaluateArgs(const FctCallNode *node, const Function *callee) {
+  std::vector<InterpreterValue> args;
+  if (!node->hasArgs)
+    return args;
+
+  const QualTypeList paramTypes = callee->getParamTypes();
+  args.reserve(node->argLst->args.size());
+  for (size_t i = 0; i < node->argLst->args.size(); i++) {
+    ExprNode *argNode = node->argLst->args.at(i);
+    const InterpreterValue arg = evaluate(argNode);
+    args.push_back(convert(arg, argNode->getEvaluatedSymbolType(manIdx), paramTypes.at(i)));
+  }
+  return args;
+}
+
+/**
+ * Execute the body of a compile-time function with the given arguments
+ *
+ * @param node Call node
+ * @param callee Called function
+ * @param args Argument values
+ * @return Return value of the function
+ */
+InterpreterValue CompileTimeInterpreter::callFunction(const FctCallNode *node, const Function *callee,
+                                                      const std::vector<InterpreterValue> &args) {
+  if (frames.size() > MAX_COMPILE_TIME_CALL_DEPTH)
+    throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED,
+                        "Exceeded the maximum call depth of " + std::to_string(MAX_COMPILE_TIME_CALL_DEPTH) +
+                            " at compile time");
+
+  // Find the manifestation index of the callee
+  const auto fctDef = spice_pointer_cast<FctDefNode *>(callee->declNode);
+  const auto it = std::ranges::find(fctDef->manifestations, callee);
+  assert(it != fctDef->manifestations.end());
+  const size_t callerManIdx = manIdx;
+  manIdx = std::distance(fctDef->manifestations.begin(), it);
+
+  // Bind the arguments to the parameters. Missing optional arguments get their default values
+  frames.emplace_back();
+  if (fctDef->hasParams) {
+    for (size_t i = 0; i < fctDef->paramLst->params.size(); i++) {
+      DeclStmtNode *param = fctDef->paramLst->params.at(i);
+      const SymbolTableEntry *paramEntry = callee->bodyScope->lookupStrict(param->varName);
+      assert(paramEntry != nullptr);
+      if (i < args.size()) {
+        frames.back().variables[paramEntry] = args.at(i);
+      } else {
+        const InterpreterValue defaultValue = evaluate(param->assignExpr);
+        const QualType &defaultValueType = param->assignExpr->getEvaluatedSymbolType(manIdx);
+        frames.back().variables[paramEntry] = convert(defaultValue, defaultValueType, paramEntry->getQualType());
+      }
+    }
+  }
+
+  // Initialize the result variable
+  const SymbolTableEntry *resultEntry = callee->bodyScope->lookupStrict(RETURN_VARIABLE_NAME);
+  assert(resultEntry != nullptr);
+  frames.back().resultEntry = resultEntry;
+  frames.back().variables[resultEntry] = getDefaultValue(node, callee->returnType);
+
+  // Execute the function body
+  visit(fctDef->body);
+  InterpreterValue result = std::move(frames.back().variables.at(resultEntry));
+
+  // Restore the state of the caller
+  returned = false;
+  pendingBreaks = 0;
+  pendingContinues = 0;
+  frames.pop_back();
+  manIdx = callerManIdx;
+  return result;
+}
+
+/**
+ * Resolve the storage location of an assignment target
+ *
+ * @param node Assignment target
+ * @return Reference to the value of the target
+ */
+InterpreterValue &CompileTimeInterpreter::resolveLValue(ExprNode *node) { // NOLINT(misc-no-recursion)
+  if (const auto prefixUnaryExpr = dynamic_cast<PrefixUnaryExprNode *>(node)) {
+    if (prefixUnaryExpr->op == PrefixUnaryExprNode::PrefixUnaryOp::OP_NONE)
+      return resolveLValue(prefixUnaryExpr->postfixUnaryExpr);
+  } else if (const auto postfixUnaryExpr = dynamic_cast<PostfixUnaryExprNode *>(node)) {
+    if (postfixUnaryExpr->op == PostfixUnaryExprNode::PostfixUnaryOp::OP_NONE)
+      return resolveLValue(postfixUnaryExpr->atomicExpr);
+    if (postfixUnaryExpr->op == PostfixUnaryExprNode::PostfixUnaryOp::OP_SUBSCRIPT &&
+        postfixUnaryExpr->postfixUnaryExpr->getEvaluatedSymbolType(manIdx).isArray()) {
+      ExprNode *indexNode = postfixUnaryExpr->subscriptIndexExpr;
+      const int64_t index = toLong(evaluate(indexNode).value, indexNode->getEvaluatedSymbolType(manIdx));
+      InterpreterValue &array = resolveLValue(postfixUnaryExpr->postfixUnaryExpr);
+      if (index < 0 || std::cmp_greater_equal(index, array.items.size()))
+        abortEvaluation(node, "Array index " + std::to_string(index) + " is out of bounds");
+      return array.items.at(index);
+    }
+  } else if (const auto atomicExpr = dynamic_cast<AtomicExprNode *>(node)) {
+    if (atomicExpr->assignExpr)
+      return resolveLValue(atomicExpr->assignExpr);
+    if (!atomicExpr->fqIdentifier.empty()) {
+      const SymbolTableEntry *entry = atomicExpr->data.at(manIdx).entry;
+      // Array params are passed by pointer at runtime, so the caller would see the modification
+      const auto declStmt = dynamic_cast<const DeclStmtNode *>(entry->declNode);
+      if (declStmt && declStmt->isFctParam && entry->getQualType().isArray())
+        abortEvaluation(node, "Modifying array parameters is not supported at compile time");
+      const auto it = frames.back().variables.find(entry);
+      if (it == frames.back().variables.end())
+        abortEvaluation(node, "Only local variables can be modified at compile time");
+      return it->second;
+    }
+  } else if (node->getChildren().size() == 1) {
+    // Pass through expressions without operator, e.g. of parenthesized assignment targets
+    return resolveLValue(spice_pointer_cast<ExprNode *>(node->getChildren().front()));
+  }
+  abortEvaluation(node, "This assignment target is not supported at compile time");
+}
+
+/**
+ * Read the value of a variable or global constant
+ *
+ * @param node Atomic expression, referencing the variable
+ * @return Value of the variable
+ */
+InterpreterValue CompileTimeInterpreter::readVariable(const AtomicExprNode *node) const {
+  const SymbolTableEntry *entry = node->data.at(manIdx).entry;
+  assert(entry != nullptr);
+
+  // Local variables and parameters
+  if (const auto it = frames.back().variables.find(entry); it != frames.back().variables.end())
+    return it->second;
+
+  // Global constants and enum items
+  if (const auto globalVar = dynamic_cast<const GlobalVarDefNode *>(entry->declNode);
+      globalVar && globalVar->hasValue && entry->getQualType().isConst())
+    return InterpreterValue{.value = globalVar->getCompileTimeValue(0)};
+  if (const auto enumItem = dynamic_cast<const EnumItemNode *>(entry->declNode))
+    return InterpreterValue{.value = {.longValue = enumItem->itemValue}};
+
+  abortEvaluation(node, "The value of '" + node->fqIdentifier + "' is not known at compile time");
+}
+
+/**
+ * Get the zero value of the given type. Arrays get one zero value per item.
+ *
+ * @param node AST node for error messages
+ * @param type Type to get the default value for
+ * @return Default value
+ */
+InterpreterValue CompileTimeInterpreter::getDefaultValue(const ASTNode *node, const QualType &type) { // NOLINT(misc-no-recursion)
+  if (type.isArray()) {
+    const unsigned int arraySize = type.getArraySize();
+    if (arraySize == 0)
+      abortEvaluation(node, "Arrays of unknown size are not supported at compile time");
+    const InterpreterValue itemValue = getDefaultValue(node, type.getContained());
+    return InterpreterValue{.items = std::vector(arraySize, itemValue)};
+  }
+
+  if (type.is(TY_STRING)) {
+    if (emptyStringOffset == SIZE_MAX) {
+      emptyStringOffset = resourceManager.compileTimeStringValues.size();
+      resourceManager.compileTimeStringValues.emplace_back();
+    }
+    return InterpreterValue{.value = {.stringValueOffset = emptyStringOffset}};
+  }
+
+  return InterpreterValue{.value = fromLong(0, type)};
+}
+
+bool CompileTimeInterpreter::evaluateCondition(ExprNode *node) { return evaluate(node).value.boolValue; }
+
+/**
+ * Check if a loop has to be left after executing its body. Consumes one level of pending breaks or continues.
+ *
+ * @return Leave the loop or not
+ */
+bool CompileTimeInterpreter::consumeLoopControl() {
+  if (returned)
+    return true;
+  if (pendingBreaks > 0) {
+    pendingBreaks--;
+    return true;
+  }
+  if (pendingContinues > 0) {
+    pendingContinues--;
+    return pendingContinues > 0; // Continue an outer loop
+  }
+  return false;
+}
+
+void CompileTimeInterpreter::countStep(const ASTNode *node) {
+  if (++steps > MAX_COMPILE_TIME_EVAL_STEPS)
+    throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED,
+                        "Exceeded the limit of " + std::to_string(MAX_COMPILE_TIME_EVAL_STEPS) + " steps at compile time");
+}
+
+void CompileTimeInterpreter::ensureNoOpOverloading(const ASTNode *node, const std::vector<const Function *> &opFcts) const {
+  if (std::ranges::any_of(opFcts, [](const Function *opFct) { return opFct != nullptr; }))
+    abortEvaluation(node, "Overloaded operators are not supported at compile time");
+}
+
+/**
+ * Apply a binary arithmetic or bitwise operator with the wrap-around semantics of the result type
+ *
+ * @param node AST node for error messages
+ * @param op Operator to apply
+ * @param lhs Left operand
+ * @param lhsType Type of the left operand
+ * @param rhs Right operand
+ * @param rhsType Type of the right operand
+ * @param resultType Type of the result
+ * @return Result value
+ */
+CompileTimeValue CompileTimeInterpreter::applyArithmeticOp(const ASTNode *node, ArithmeticOp op, const CompileTimeValue &lhs,
+                                                           const QualType &lhsType, const CompileTimeValue &rhs,
+                                                           const QualType &rhsType, const QualType &resultType) const {
+  // Bool operands only support the bitwise operators
+  if (resultType.is(TY_BOOL) && lhsType.is(TY_BOOL) && rhsType.is(TY_BOOL)) {
+    switch (op) {
+    case ArithmeticOp::OP_AND:
+      return fromLong(lhs.boolValue && rhs.boolValue, resultType);
+    case ArithmeticOp::OP_OR:
+      return fromLong(lhs.boolValue || rhs.boolValue, resultType);
+    case ArithmeticOp::OP_XOR:
+      return fromLong(lhs.boolValue != rhs.boolValue, resultType);
+    default:
+      abortEvaluation(node, "This operator is not supported for bool operands at compile time");
+    }
+  }
+
+  const std::initializer_list numericTypes = {TY_DOUBLE, TY_INT, TY_SHORT, TY_LONG, TY_BYTE, TY_CHAR};
+  if (!lhsType.isOneOf(numericTypes) || !rhsType.isOneOf(numericTypes) || !resultType.isOneOf(numericTypes))
+    abortEvaluation(node, "Only numeric operands are supported at compile time");
+
+  // Floating point arithmetic
+  if (resultType.is(TY_DOUBLE)) {
+    const double lhsValue = toDouble(lhs, lhsType);
+    const double rhsValue = toDouble(rhs, rhsType);
+    switch (op) {
+    case ArithmeticOp::OP_ADD:
+      return {.doubleValue = lhsValue + rhsValue};
+    case ArithmeticOp::OP_SUB:
+      return {.doubleValue = lhsValue - rhsValue};
+    case ArithmeticOp::OP_MUL:
+      return {.doubleValue = lhsValue * rhsValue};
+    case ArithmeticOp::OP_DIV:
+      return {.doubleValue = lhsValue / rhsValue};
+    case ArithmeticOp::OP_REM:
+      return {.doubleValue = std::fmod(lhsValue, rhsValue)};
+    default:
+      abortEvaluation(node, "This operator is not supported for double operands at compile time");
+    }
+  }
+
+  // Integer arithmetic. Calculate unsigned to get the same wrap-around behavior as at runtime
+  const int64_t lhsValue = toLong(lhs, lhsType);
+  const int64_t rhsValue = toLong(rhs, rhsType);
+  const auto lhsBits = static_cast<uint64_t>(lhsValue);
+  const auto rhsBits = static_cast<uint64_t>(rhsValue);
+  const bool isUnsigned = resultType.isUnsigned();
+  const uint64_t shiftAmount = rhsBits & 63;
+  int64_t result;
+  switch (op) {
+  case ArithmeticOp::OP_ADD:
+    result = static_cast<int64_t>(lhsBits + rhsBits);
+    break;
+  case ArithmeticOp::OP_SUB:
+    result = static_cast<int64_t>(lhsBits - rhsBits);
+    break;
+  case ArithmeticOp::OP_MUL:
+    result = static_cast<int64_t>(lhsBits * rhsBits);
+    break;
+  case ArithmeticOp::OP_DIV:
+  case ArithmeticOp::OP_REM: {
+    if (rhsValue == 0)
+      throw SemanticError(node, DIVISION_BY_ZERO, "Dividing by zero is not allowed.");
+    const bool isDiv = op == ArithmeticOp::OP_DIV;
+    if (isUnsigned)
+      result = static_cast<int64_t>(isDiv ? lhsBits / rhsBits : lhsBits % rhsBits);
+    else if (lhsValue == INT64_MIN && rhsValue == -1) // Overflows like at runtime
+      result = isDiv ? lhsValue : 0;
+    else
+      result = isDiv ? lhsValue / rhsValue : lhsValue % rhsValue;
+    break;
+  }
+  case ArithmeticOp::OP_SHL:
+    result = static_cast<int64_t>(lhsBits << shiftAmount);
+    break;
+  case ArithmeticOp::OP_SHR:
+    result = isUnsigned ? static_cast<int64_t>(lhsBits >> shiftAmount) : lhsValue >> shiftAmount;
+    break;
+  case ArithmeticOp::OP_AND:
+    result = lhsValue & rhsValue;
+    break;
+  case ArithmeticOp::OP_OR:
+    result = lhsValue | rhsValue;
+    break;
+  case ArithmeticOp::OP_XOR:
+    result = lhsValue ^ rhsValue;
+    break;
+  default:                                                          // GCOV_EXCL_LINE
+    throw CompilerError(UNHANDLED_BRANCH, "Operator fall-through"); // GCOV_EXCL_LINE
+  }
+  return fromLong(result, resultType);
+}
+
+/**
+ * Compare two values three-way
+ *
+ * @param node AST node for error messages
+ * @param lhs Left operand
+ * @param lhsType Type of the left operand
+ * @param rhs Right operand
+ * @param rhsType Type of the right operand
+ * @return Negative, if lhs is smaller, zero if equal, positive if lhs is greater
+ */
+int CompileTimeInterpreter::compare(const ASTNode *node, const CompileTimeValue &lhs, const QualType &lhsType,
+                                    const CompileTimeValue &rhs, const QualType &rhsType) const {
+  if (lhsType.is(TY_STRING) && rhsType.is(TY_STRING)) {
+    const std::string &lhsValue = resourceManager.compileTimeStringValues.at(lhs.stringValueOffset);
+    const std::string &rhsValue = resourceManager.compileTimeStringValues.at(rhs.stringValueOffset);
+    return lhsValue.compare(rhsValue);
+  }
+  if (lhsType.is(TY_BOOL) && rhsType.is(TY_BOOL))
+    return static_cast<int>(lhs.boolValue) - static_cast<int>(rhs.boolValue);
+
+  const std::initializer_list numericTypes = {TY_DOUBLE, TY_INT, TY_SHORT, TY_LONG, TY_BYTE, TY_CHAR, TY_ENUM};
+  if (!lhsType.isOneOf(numericTypes) || !rhsType.isOneOf(numericTypes))
+    abortEvaluation(node, "Comparing values of type '" + lhsType.getName(false) + "' and '" + rhsType.getName(false) +
+                              "' is not supported at compile time");
+
+  if (lhsType.is(TY_DOUBLE) || rhsType.is(TY_DOUBLE)) {
+    const double lhsValue = toDouble(lhs, lhsType);
+    const double rhsValue = toDouble(rhs, rhsType);
+    return lhsValue < rhsValue ? -1 : lhsValue > rhsValue ? 1 : 0;
+  }
+  if (lhsType.isUnsigned() && rhsType.isUnsigned()) {
+    const auto lhsValue = static_cast<uint64_t>(toLong(lhs, lhsType));
+    const auto rhsValue = static_cast<uint64_t>(toLong(rhs, rhsType));
+    return lhsValue < rhsValue ? -1 : lhsValue > rhsValue ? 1 : 0;
+  }
+  const int64_t lhsValue = toLong(lhs, lhsType);
+  const int64_t rhsValue = toLong(rhs, rhsType);
+  return lhsValue < rhsValue ? -1 : lhsValue > rhsValue ? 1 : 0;
+}
+
+CompileTimeValue CompileTimeInterpreter::convert(const CompileTimeValue &value, const QualType &srcType,
+                                                 const QualType &dstType) {
+  if (srcType.is(TY_STRING) || dstType.is(TY_STRING))
+    return value;
+  if (dstType.is(TY_DOUBLE))
+    return {.doubleValue = toDouble(value, srcType)};
+  if (srcType.is(TY_DOUBLE))
+    return fromLong(static_cast<int64_t>(value.doubleValue), dstType);
+  return fromLong(toLong(value, srcType), dstType);
+}
+
+InterpreterValue CompileTimeInterpreter::convert(const InterpreterValue &value, // NOLINT(misc-no-recursion)
+                                                 const QualType &srcType, const QualType &dstType) {
+  if (!dstType.isArray())
+    return InterpreterValue{.value = convert(value.value, srcType, dstType)};
+
+  InterpreterValue result;
+  result.items.reserve(value.items.size());
+  for (const InterpreterValue &item : value.items)
+    result.items.push_back(convert(item, srcType.getContained(), dstType.getContained()));
+  return result;
+}
+
+int64_t CompileTimeInterpreter::toLong(const CompileTimeValue &value, const QualType &type) {
+  const bool isUnsigned = type.isUnsigned();
+  switch (type.getSuperType()) {
+  case TY_DOUBLE:
+    return static_cast<int64_t>(value.doubleValue);
+  case TY_INT:
+    return isUnsigned ? static_cast<int64_t>(static_cast<uint32_t>(value.intValue)) : value.intValue;
+  case TY_SHORT:
+    return isUnsigned ? static_cast<int64_t>(static_cast<uint16_t>(value.shortValue)) : value.shortValue;
+  case TY_BYTE: // fall-through
+  case TY_CHAR:
+    return isUnsigned ? static_cast<int64_t>(static_cast<uint8_t>(value.charValue)) : value.charValue;
+  case TY_BOOL:
+    return value.boolValue;
+  default:
+    return value.longValue;
+  }
+}
+
+double CompileTimeInterpreter::toDouble(const CompileTimeValue &value, const QualType &type) {
+  if (type.is(TY_DOUBLE))
+    return value.doubleValue;
+  if (type.is(TY_LONG) && type.isUnsigned())
+    return static_cast<double>(static_cast<uint64_t>(value.longValue));
+  return static_cast<double>(toLong(value, type));
+}
+
+/**
+ * Create a compile-time value of the given type. Integers get truncated to the width of the type and are stored
+ * sign- or zero-extended, so that all union members read the same number.
+ *
+ * @param value Value to store
+ * @param type Type of the value
+ * @return Compile-time value
+ */
+CompileTimeValue CompileTimeInterpreter::fromLong(int64_t value, const QualType &type) {
+  const bool isUnsigned = type.isUnsigned();
+  switch (type.getSuperType()) {
+  case TY_DOUBLE:
+    return {.doubleValue = static_cast<double>(value)};
+  case TY_INT: {
+    const auto truncated = static_cast<int32_t>(value);
+    return {.longValue = isUnsigned ? static_cast<int64_t>(static_cast<uint32_t>(truncated)) : truncated};
+  }
+  case TY_SHORT: {
+    const auto truncated = static_cast<int16_t>(value);
+    return {.longValue = isUnsigned ? static_cast<int64_t>(static_cast<uint16_t>(truncated)) : truncated};
+  }
+  case TY_BYTE: // fall-through
+  case TY_CHAR: {
+    const auto truncated = static_cast<int8_t>(value);
+    return {.longValue = isUnsigned ? static_cast<int64_t>(static_cast<uint8_t>(truncated)) : truncated};
+  }
+  case TY_BOOL:
+    return {.longValue = value != 0};
+  default:
+    return {.longValue = value};
+  }
+}
+
+void CompileTimeInterpreter::abortEvaluation(const ASTNode *node, const std::string &message) const {
+  // Arguments of the outermost call, that cannot be evaluated, keep the call from being evaluated at compile time
+  if (frames.size() <= 1)
+    throw NotCompileTimeKnown();
+  throw SemanticError(node, COMPILE_TIME_EVALUATION_FAILED, message);
+}
+
+} // namespace spice::compiler
@@ -0,0 +1,146 @@
+// Copyright (c) 2021-2026 ChilliBits. All rights reserved.
+
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include <CompilerPass.h>
+#include <ast/ASTNodes.h>
+#include <ast/ASTVisitor.h>
+
+namespace spice::compiler {
+
+// Forward declarations
+class SymbolTableEntry;
+
+// Constants
+static constexpr size_t MAX_COMPILE_TIME_EVAL_STEPS = 1'000'000;
+static constexpr size_t MAX_COMPILE_TIME_CALL_DEPTH = 128;
+
+/**
+ * Value of a variable or temporary during compile-time evaluation. Scalars live in the value field, arrays hold one
+ * value per item.
+ */
+struct InterpreterValue {
+  CompileTimeValue value;
+  std::vector<InterpreterValue> items;
+};
+
+/**
+ * Interpreter over the typed AST to evaluate calls to functions, annotated with #[compileTime], at compile time.
+ *
+ * Supports primitive values, strings and arrays of those, local variables, control structures, and calls to other
+ * compile-time functions. The evaluation is limited to a fixed number of steps and a maximum call depth.
+ */
+class CompileTimeInterpreter final : CompilerPass, public ASTVisitor {
+public:
+  // Constructors
+  CompileTimeInterpreter(GlobalResourceManager &resourceManager, SourceFile *sourceFile);
+
+  // Public methods
+  bool tryEvaluate(const FctCallNode *node, size_t callerManIdx, InterpreterValue &result);
+  [[nodiscard]] static bool isSupportedType(const QualType &type);
+
+private:
+  // Enums
+  enum class ArithmeticOp : uint8_t {
+    OP_ADD,
+    OP_SUB,
+    OP_MUL,
+    OP_DIV,
+    OP_REM,
+    OP_SHL,
+    OP_SHR,
+    OP_AND,
+    OP_OR,
+    OP_XOR,
+  };
+
+  // Structs
+  struct Frame {
+    std::unordered_map<const SymbolTableEntry *, InterpreterValue> variables;
+    const SymbolTableEntry *resultEntry = nullptr;
+  };
+  struct NotCompileTimeKnown {}; // Thrown, if an argument of the outermost call depends on runtime values
+
+  // Private members
+  std::vector<Frame> frames;
+  size_t steps = 0;
+  size_t emptyStringOffset = SIZE_MAX;
+  size_t pendingBreaks = 0;
+  size_t pendingContinues = 0;
+  bool returned = false;
+
+  // Visitor methods
+  // Control structures
+  std::any visitUnsafeBlock(UnsafeBlockNode *node) override;
+  std::any visitForLoop(ForLoopNode *node) override;
+  std::any visitForeachLoop(ForeachLoopNode *node) override;
+  std::any visitWhileLoop(WhileLoopNode *node) override;
+  std::any visitDoWhileLoop(DoWhileLoopNode *node) override;
+  std::any visitIfStmt(IfStmtNode *node) override;
+  std::any visitElseStmt(ElseStmtNode *node) override;
+  std::any visitSwitchStmt(SwitchStmtNode *node) override;
+  std::any visitAssertStmt(AssertStmtNode *node) override;
+  std::any visitAnonymousBlockStmt(AnonymousBlockStmtNode *node) override;
+  // Statements
+  std::any visitStmtLst(StmtLstNode *node) override;
+  std::any visitDeclStmt(DeclStmtNode *node) override;
+  std::any visitExprStmt(ExprStmtNode *node) override;
+  std::any visitReturnStmt(ReturnStmtNode *node) override;
+  std::any visitBreakStmt(BreakStmtNode *node) override;
+  std::any visitContinueStmt(ContinueStmtNode *node) override;
+  std::any visitFallthroughStmt(FallthroughStmtNode *node) override;
+  // Expressions
+  std::any visitAssignExpr(AssignExprNode *node) override;
+  std::any visitTernaryExpr(TernaryExprNode *node) override;
+  std::any visitLogicalOrExpr(LogicalOrExprNode *node) override;
+  std::any visitLogicalAndExpr(LogicalAndExprNode *node) override;
+  std::any visitBitwiseOrExpr(BitwiseOrExprNode *node) override;
+  std::any visitBitwiseXorExpr(BitwiseXorExprNode *node) override;
+  std::any visitBitwiseAndExpr(BitwiseAndExprNode *node) override;
+  std::any visitEqualityExpr(EqualityExprNode *node) override;
+  std::any visitRelationalExpr(RelationalExprNode *node) override;
+  std::any visitShiftExpr(ShiftExprNode *node) override;
+  std::any visitAdditiveExpr(AdditiveExprNode *node) override;
+  std::any visitMultiplicativeExpr(MultiplicativeExprNode *node) override;
+  std::any visitCastExpr(CastExprNode *node) override;
+  std::any visitPrefixUnaryExpr(PrefixUnaryExprNode *node) override;
+  std::any visitPostfixUnaryExpr(PostfixUnaryExprNode *node) override;
+  std::any visitAtomicExpr(AtomicExprNode *node) override;
+  // Values
+  std::any visitValue(ValueNode *node) override;
+  std::any visitConstant(ConstantNode *node) override;
+  std::any visitFctCall(FctCallNode *node) override;
+  std::any visitArrayInitialization(ArrayInitializationNode *node) override;
+  std::any visitStructInstantiation(StructInstantiationNode *node) override;
+  std::any visitLambdaFunc(LambdaFuncNode *node) override;
+  std::any visitLambdaProc(LambdaProcNode *node) override;
+  std::any visitLambdaExpr(LambdaExprNode *node) override;
+
+  // Private methods
+  InterpreterValue evaluate(ExprNode *node);
+  std::vector<InterpreterValue> evaluateArgs(const FctCallNode *node, const Function *callee);
+  InterpreterValue callFunction(const FctCallNode *node, const Function *callee, const std::vector<InterpreterValue> &args);
+  InterpreterValue &resolveLValue(ExprNode *node);
+  [[nodiscard]] InterpreterValue readVariable(const AtomicExprNode *node) const;
+  [[nodiscard]] InterpreterValue getDefaultValue(const ASTNode *node, const QualType &type);
+  [[nodiscard]] bool evaluateCondition(ExprNode *node);
+  [[nodiscard]] bool consumeLoopControl();
+  void countStep(const ASTNode *node);
+  void ensureNoOpOverloading(const ASTNode *node, const std::vector<const Function *> &opFcts) const;
+  [[nodiscard]] CompileTimeValue applyArithmeticOp(const ASTNode *node, ArithmeticOp op, const CompileTimeValue &lhs,
+                                                   const QualType &lhsType, const CompileTimeValue &rhs,
+                                                   const QualType &rhsType, const QualType &resultType) const;
+  [[nodiscard]] int compare(const ASTNode *node, const CompileTimeValue &lhs, const QualType &lhsType,
+                            const CompileTimeValue &rhs, const QualType &rhsType) const;
+  [[nodiscard]] static CompileTimeValue convert(const CompileTimeValue &value, const QualType &srcType, const QualType &dstType);
+  [[nodiscard]] static InterpreterValue convert(const InterpreterValue &value, const QualType &srcType, const QualType &dstType);
+  [[nodiscard]] static int64_t toLong(const CompileTimeValue &value, const QualType &type);
+  [[nodiscard]] static double toDouble(const CompileTimeValue &value, const QualType &type);
+  [[nodiscard]] static CompileTimeValue fromLong(int64_t value, const QualType &type);
+  [[noreturn]] void abortEvaluation(const ASTNode *node, const std::string &message) const;
+};
+
+} // namespace spice::compiler
@@ -49,8 +49,9 @@ std::pair<QualType, Function *> OpRuleManager::getAssignResultType(ASTNode *node
       return {lhsType, nullptr};
     }
   }
-  // Allow arrays, structs, interfaces, functions, procedures of the same type straight away
-  if (lhsType.isOneOf({TY_ARRAY, TY_INTERFACE, TY_FUNCTION, TY_PROCEDURE}) && lhsType.matches(rhsType, false, true, true))
+  // Allow arrays, vectors, interfaces, functions, procedures of the same type straight away
+  const bool isSameTypeAssignable = lhsType.isOneOf({TY_ARRAY, TY_VECTOR, TY_INTERFACE, TY_FUNCTION, TY_PROCEDURE});
+  if (isSameTypeAssignable && lhsType.matches(rhsType, false, true, true))
     return {rhsType, nullptr};
   // Allow struct of the same type straight away
   if (lhsType.is(TY_STRUCT) && lhsType.matches(rhsType, false, true, true))
@@ -84,8 +85,8 @@ QualType OpRuleManager::getFieldAssignResultType(ASTNode *node, const ExprResult
   // Check if we try to assign a constant value
   ensureNoConstAssign(node, lhsType, isDecl);
 
-  // Allow pointers, arrays and structs of the same type straight away
-  if (lhsType.isOneOf({TY_PTR, TY_ARRAY}) && lhsType == rhsType) {
+  // Allow pointers, arrays, vectors and structs of the same type straight away
+  if (lhsType.isOneOf({TY_PTR, TY_ARRAY, TY_VECTOR}) && lhsType == rhsType) {
     // If we perform a heap x* = heap x* assignment, we need set the right hand side to MOVED
     if (rhs.entry && lhsType.isPtr() && lhsType.isHeap() && rhsType.removeReferenceWrapper().isPtr() && rhsType.isHeap())
       rhs.entry->updateState(MOVED, node);
@@ -220,6 +221,10 @@ ExprResult OpRuleManager::getPlusEqualResultType(ASTNode *node, const ExprResult
     return lhs;
   }
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return {validateVectorOperation(node, PLUS_EQUAL_OP_RULES, std::size(PLUS_EQUAL_OP_RULES), "+=", lhsType, rhsType, true)};
+
   return {validateBinaryOperation(node, PLUS_EQUAL_OP_RULES, std::size(PLUS_EQUAL_OP_RULES), "+=", lhsType, rhsType)};
 }
 
@@ -242,6 +247,10 @@ ExprResult OpRuleManager::getMinusEqualResultType(ASTNode *node, const ExprResul
     return lhs;
   }
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return {validateVectorOperation(node, MINUS_EQUAL_OP_RULES, std::size(MINUS_EQUAL_OP_RULES), "-=", lhsType, rhsType, true)};
+
   return {validateBinaryOperation(node, MINUS_EQUAL_OP_RULES, std::size(MINUS_EQUAL_OP_RULES), "-=", lhsType, rhsType)};
 }
 
@@ -258,6 +267,10 @@ ExprResult OpRuleManager::getMulEqualResultType(ASTNode *node, const ExprResult
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return {validateVectorOperation(node, MUL_EQUAL_OP_RULES, std::size(MUL_EQUAL_OP_RULES), "*=", lhsType, rhsType, true)};
+
   return {validateBinaryOperation(node, MUL_EQUAL_OP_RULES, std::size(MUL_EQUAL_OP_RULES), "*=", lhsType, rhsType)};
 }
 
@@ -274,6 +287,10 @@ ExprResult OpRuleManager::getDivEqualResultType(ASTNode *node, const ExprResult
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return {validateVectorOperation(node, DIV_EQUAL_OP_RULES, std::size(DIV_EQUAL_OP_RULES), "/=", lhsType, rhsType, true)};
+
   return {validateBinaryOperation(node, DIV_EQUAL_OP_RULES, std::size(DIV_EQUAL_OP_RULES), "/=", lhsType, rhsType)};
 }
 
@@ -285,6 +302,10 @@ QualType OpRuleManager::getRemEqualResultType(const ASTNode *node, const ExprRes
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return validateVectorOperation(node, REM_EQUAL_OP_RULES, std::size(REM_EQUAL_OP_RULES), "%=", lhsType, rhsType, true);
+
   return validateBinaryOperation(node, REM_EQUAL_OP_RULES, std::size(REM_EQUAL_OP_RULES), "%=", lhsType, rhsType);
 }
 
@@ -296,6 +317,10 @@ QualType OpRuleManager::getSHLEqualResultType(const ASTNode *node, const ExprRes
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return validateVectorOperation(node, SHL_EQUAL_OP_RULES, std::size(SHL_EQUAL_OP_RULES), "<<=", lhsType, rhsType, true);
+
   return validateBinaryOperation(node, SHL_EQUAL_OP_RULES, std::size(SHL_EQUAL_OP_RULES), "<<=", lhsType, rhsType);
 }
 
@@ -307,6 +332,10 @@ QualType OpRuleManager::getSHREqualResultType(const ASTNode *node, const ExprRes
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return validateVectorOperation(node, SHR_EQUAL_OP_RULES, std::size(SHR_EQUAL_OP_RULES), ">>=", lhsType, rhsType, true);
+
   return validateBinaryOperation(node, SHR_EQUAL_OP_RULES, std::size(SHR_EQUAL_OP_RULES), ">>=", lhsType, rhsType);
 }
 
@@ -318,6 +347,10 @@ QualType OpRuleManager::getAndEqualResultType(const ASTNode *node, const ExprRes
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return validateVectorOperation(node, AND_EQUAL_OP_RULES, std::size(AND_EQUAL_OP_RULES), "&=", lhsType, rhsType, true);
+
   return validateBinaryOperation(node, AND_EQUAL_OP_RULES, std::size(AND_EQUAL_OP_RULES), "&=", lhsType, rhsType);
 }
 
@@ -329,6 +362,10 @@ QualType OpRuleManager::getOrEqualResultType(const ASTNode *node, const ExprResu
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return validateVectorOperation(node, OR_EQUAL_OP_RULES, std::size(OR_EQUAL_OP_RULES), "|=", lhsType, rhsType, true);
+
   return validateBinaryOperation(node, OR_EQUAL_OP_RULES, std::size(OR_EQUAL_OP_RULES), "|=", lhsType, rhsType);
 }
 
@@ -340,6 +377,10 @@ QualType OpRuleManager::getXorEqualResultType(const ASTNode *node, const ExprRes
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return validateVectorOperation(node, XOR_EQUAL_OP_RULES, std::size(XOR_EQUAL_OP_RULES), "^=", lhsType, rhsType, true);
+
   return validateBinaryOperation(node, XOR_EQUAL_OP_RULES, std::size(XOR_EQUAL_OP_RULES), "^=", lhsType, rhsType);
 }
 
@@ -370,6 +411,10 @@ ExprResult OpRuleManager::getBitwiseOrResultType(ASTNode *node, const ExprResult
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return {validateVectorOperation(node, BITWISE_OR_OP_RULES, std::size(BITWISE_OR_OP_RULES), "|", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, BITWISE_OR_OP_RULES, std::size(BITWISE_OR_OP_RULES), "|", lhsType, rhsType)};
 }
 
@@ -384,6 +429,10 @@ ExprResult OpRuleManager::getBitwiseXorResultType(ASTNode *node, const ExprResul
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return {validateVectorOperation(node, BITWISE_XOR_OP_RULES, std::size(BITWISE_XOR_OP_RULES), "^", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, BITWISE_XOR_OP_RULES, std::size(BITWISE_XOR_OP_RULES), "^", lhsType, rhsType)};
 }
 
@@ -398,6 +447,10 @@ ExprResult OpRuleManager::getBitwiseAndResultType(ASTNode *node, const ExprResul
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return {validateVectorOperation(node, BITWISE_AND_OP_RULES, std::size(BITWISE_AND_OP_RULES), "&", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, BITWISE_AND_OP_RULES, std::size(BITWISE_AND_OP_RULES), "&", lhsType, rhsType)};
 }
 
@@ -420,6 +473,10 @@ ExprResult OpRuleManager::getEqualResultType(ASTNode *node, const ExprResult &lh
     return ExprResult(QualType(TY_BOOL));
 
   // Check primitive type combinations
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return ExprResult(validateVectorOperation(node, EQUAL_OP_RULES, std::size(EQUAL_OP_RULES), "==", lhsType, rhsType));
+
   return ExprResult(validateBinaryOperation(node, EQUAL_OP_RULES, std::size(EQUAL_OP_RULES), "==", lhsType, rhsType));
 }
 
@@ -442,6 +499,10 @@ ExprResult OpRuleManager::getNotEqualResultType(ASTNode *node, const ExprResult
     return ExprResult(QualType(TY_BOOL));
 
   // Check primitive type combinations
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return ExprResult(validateVectorOperation(node, NOT_EQUAL_OP_RULES, std::size(NOT_EQUAL_OP_RULES), "!=", lhsType, rhsType));
+
   return ExprResult(validateBinaryOperation(node, NOT_EQUAL_OP_RULES, std::size(NOT_EQUAL_OP_RULES), "!=", lhsType, rhsType));
 }
 
@@ -450,6 +511,10 @@ QualType OpRuleManager::getLessResultType(const ASTNode *node, const ExprResult
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return validateVectorOperation(node, LESS_OP_RULES, std::size(LESS_OP_RULES), "<", lhsType, rhsType);
+
   return validateBinaryOperation(node, LESS_OP_RULES, std::size(LESS_OP_RULES), "<", lhsType, rhsType);
 }
 
@@ -458,6 +523,10 @@ QualType OpRuleManager::getGreaterResultType(const ASTNode *node, const ExprResu
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return validateVectorOperation(node, GREATER_OP_RULES, std::size(GREATER_OP_RULES), ">", lhsType, rhsType);
+
   return validateBinaryOperation(node, GREATER_OP_RULES, std::size(GREATER_OP_RULES), ">", lhsType, rhsType);
 }
 
@@ -466,6 +535,10 @@ QualType OpRuleManager::getLessEqualResultType(const ASTNode *node, const ExprRe
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return validateVectorOperation(node, LESS_EQUAL_OP_RULES, std::size(LESS_EQUAL_OP_RULES), "<=", lhsType, rhsType);
+
   return validateBinaryOperation(node, LESS_EQUAL_OP_RULES, std::size(LESS_EQUAL_OP_RULES), "<=", lhsType, rhsType);
 }
 
@@ -478,6 +551,10 @@ QualType OpRuleManager::getGreaterEqualResultType(const ASTNode *node, const Exp
   if (lhsType.isPtr() && rhsType.isPtr())
     return QualType(TY_BOOL);
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return validateVectorOperation(node, GREATER_EQUAL_OP_RULES, std::size(GREATER_EQUAL_OP_RULES), ">=", lhsType, rhsType);
+
   return validateBinaryOperation(node, GREATER_EQUAL_OP_RULES, std::size(GREATER_EQUAL_OP_RULES), ">=", lhsType, rhsType);
 }
 
@@ -492,6 +569,10 @@ ExprResult OpRuleManager::getShiftLeftResultType(ASTNode *node, const ExprResult
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return {validateVectorOperation(node, SHIFT_LEFT_OP_RULES, std::size(SHIFT_LEFT_OP_RULES), "<<", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, SHIFT_LEFT_OP_RULES, std::size(SHIFT_LEFT_OP_RULES), "<<", lhsType, rhsType)};
 }
 
@@ -506,6 +587,10 @@ ExprResult OpRuleManager::getShiftRightResultType(ASTNode *node, const ExprResul
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return {validateVectorOperation(node, SHIFT_RIGHT_OP_RULES, std::size(SHIFT_RIGHT_OP_RULES), ">>", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, SHIFT_RIGHT_OP_RULES, std::size(SHIFT_RIGHT_OP_RULES), ">>", lhsType, rhsType)};
 }
 
@@ -530,6 +615,10 @@ ExprResult OpRuleManager::getPlusResultType(ASTNode *node, const ExprResult &lhs
     return {rhsType};
   }
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return {validateVectorOperation(node, PLUS_OP_RULES, std::size(PLUS_OP_RULES), "+", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, PLUS_OP_RULES, std::size(PLUS_OP_RULES), "+", lhsType, rhsType)};
 }
 
@@ -549,6 +638,10 @@ ExprResult OpRuleManager::getMinusResultType(ASTNode *node, const ExprResult &lh
     return lhs;
   }
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return {validateVectorOperation(node, MINUS_OP_RULES, std::size(MINUS_OP_RULES), "-", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, MINUS_OP_RULES, std::size(MINUS_OP_RULES), "-", lhsType, rhsType)};
 }
 
@@ -562,6 +655,10 @@ ExprResult OpRuleManager::getMulResultType(ASTNode *node, const ExprResult &lhs,
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return {validateVectorOperation(node, MUL_OP_RULES, std::size(MUL_OP_RULES), "*", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, MUL_OP_RULES, std::size(MUL_OP_RULES), "*", lhsType, rhsType)};
 }
 
@@ -575,6 +672,10 @@ ExprResult OpRuleManager::getDivResultType(ASTNode *node, const ExprResult &lhs,
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return {validateVectorOperation(node, DIV_OP_RULES, std::size(DIV_OP_RULES), "/", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, DIV_OP_RULES, std::size(DIV_OP_RULES), "/", lhsType, rhsType)};
 }
 
@@ -583,6 +684,10 @@ ExprResult OpRuleManager::getRemResultType(const ASTNode *node, const ExprResult
   const QualType lhsType = lhs.type.removeReferenceWrapper();
   const QualType rhsType = rhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector() || rhsType.isVector())
+    return {validateVectorOperation(node, REM_OP_RULES, std::size(REM_OP_RULES), "%", lhsType, rhsType)};
+
   return {validateBinaryOperation(node, REM_OP_RULES, std::size(REM_OP_RULES), "%", lhsType, rhsType)};
 }
 
@@ -590,6 +695,12 @@ QualType OpRuleManager::getPrefixMinusResultType(const ASTNode *node, const Expr
   // Remove reference wrappers
   const QualType lhsType = lhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector()) {
+    validateUnaryOperation(node, PREFIX_MINUS_OP_RULES, std::size(PREFIX_MINUS_OP_RULES), "-", lhsType.getContained());
+    return lhsType.toNonConst();
+  }
+
   return validateUnaryOperation(node, PREFIX_MINUS_OP_RULES, std::size(PREFIX_MINUS_OP_RULES), "-", lhsType);
 }
 
@@ -641,6 +752,13 @@ ExprResult OpRuleManager::getPrefixBitwiseNotResultType(ASTNode *node, const Exp
   // Remove reference wrappers
   const QualType lhsType = lhs.type.removeReferenceWrapper();
 
+  // Apply the operator lane-wise on SIMD vectors
+  if (lhsType.isVector()) {
+    const QualType laneType = lhsType.getContained();
+    validateUnaryOperation(node, PREFIX_BITWISE_NOT_OP_RULES, std::size(PREFIX_BITWISE_NOT_OP_RULES), "~", laneType);
+    return {lhsType.toNonConst()};
+  }
+
   return {validateUnaryOperation(node, PREFIX_BITWISE_NOT_OP_RULES, std::size(PREFIX_BITWISE_NOT_OP_RULES), "~", lhsType)};
 }
 
@@ -826,6 +944,33 @@ QualType OpRuleManager::validateBinaryOperation(const ASTNode *node, const Binar
   throw getExceptionBinary(node, name, lhs, rhs, customMessagePrefix);
 }
 
+QualType OpRuleManager::validateVectorOperation(const ASTNode *node, const BinaryOpRule opRules[], size_t opRulesSize,
+                                                const char *name, const QualType &lhs, const QualType &rhs,
+                                                bool isCompoundAssign) {
+  // The vector operand determines lane type and lane count. A scalar operand of the lane type gets broadcast to all lanes
+  const QualType &vectorType = lhs.isVector() ? lhs : rhs;
+  const SuperType laneSuperType = vectorType.getContained().getSuperType();
+  const bool lhsFits = lhs.isVector() ? lhs.matches(vectorType, false, true, true) : lhs.getSuperType() == laneSuperType;
+  const bool rhsFits = rhs.isVector() ? rhs.matches(vectorType, false, true, true) : rhs.getSuperType() == laneSuperType;
+  // Compound assignments can only store the result to a vector
+  if (!lhsFits || !rhsFits || (isCompoundAssign && !lhs.isVector()))
+    throw getExceptionBinary(node, name, lhs, rhs, "");
+
+  // Check if the operator is applicable to the lane type
+  for (size_t i = 0; i < opRulesSize; i++) {
+    const BinaryOpRule &rule = opRules[i];
+    if (std::get<0>(rule) == laneSuperType && std::get<1>(rule) == laneSuperType) {
+      if (isCompoundAssign)
+        return lhs;
+      // Comparisons produce a mask with one bool per lane
+      if (std::get<2>(rule) == TY_BOOL)
+        return QualType(TY_BOOL).toVec(node, vectorType.getVectorLaneCount());
+      return vectorType.toNonConst();
+    }
+  }
+  throw getExceptionBinary(node, name, lhs, rhs, "");
+}
+
 SemanticError OpRuleManager::getExceptionUnary(const ASTNode *node, const char *name, const QualType &lhs) {
   return {node, OPERATOR_WRONG_DATA_TYPE, "Cannot apply '" + std::string(name) + "' operator on type " + lhs.getName(true)};
 }
@@ -176,6 +176,10 @@ std::any TypeChecker::visitDataType(DataTypeNode *node) {
       type = type.toArr(node, hardcodedSize);
       break;
     }
+    case DataTypeNode::TypeModifierType::TYPE_VECTOR: {
+      type = type.toVec(node, hardcodedSize);
+      break;
+    }
     default:                                                               // GCOV_EXCL_LINE
       throw CompilerError(UNHANDLED_BRANCH, "Modifier type fall-through"); // GCOV_EXCL_LINE
     }
@@ -195,6 +195,37 @@ QualType TypeChecker::mapImportedScopeTypeToLocalType(const Scope *sourceScope,
   return symbolType;
 }
 
+/**
+ * Get the future type, that an async function with the given result type hands out to its callers
+ *
+ * @param resultType Result type of the async function
+ * @param node Accessing AST node
+ * @return Future<resultType>
+ */
+QualType TypeChecker::getFutureType(const QualType &resultType, const ASTNode *node) const {
+  const SourceFile *asyncRT = sourceFile->requestRuntimeModule(ASYNC_RT);
+  const SymbolTableEntry *futureEntry = asyncRT->globalScope->lookupStrict(FUTUREOBJ_NAME);
+  assert(futureEntry != nullptr);
+  QualType futureType = futureEntry->getQualType();
+  futureType.getStructAndAdjustType(node, {resultType});
+  futureType.getQualifiers().isPublic = false;
+  return futureType;
+}
+
+/**
+ * Check if the given node is located in the body of an async function. Lambdas within async functions do not count.
+ *
+ * @param node AST node
+ * @return In async function body or not
+ */
+bool TypeChecker::isInAsyncFctBody(const ASTNode *node) {
+  const ASTNode *enclosingNode = node->parent;
+  while (enclosingNode != nullptr && !enclosingNode->isFctOrProcDef() && !dynamic_cast<const LambdaBaseNode *>(enclosingNode))
+    enclosingNode = enclosingNode->parent;
+  const auto enclosingFctDef = dynamic_cast<const FctDefNode *>(enclosingNode);
+  return enclosingFctDef != nullptr && enclosingFctDef->isAsync;
+}
+
 /**
  * Returns the operator function list for the current manifestation and the given node
  *
@@ -13,6 +13,7 @@ class LambdaBaseNode;
 class CompilerWarning;
 struct Param;
 struct NamedParam;
+enum class BuiltinMemoryOrder : uint8_t;
 using ParamList = std::vector<Param>;
 using NamedParamList = std::vector<NamedParam>;
 using Arg = std::pair</*type=*/QualType, /*isTemporary=*/bool>;
@@ -141,8 +142,23 @@ public:
   std::any visitBuiltinIsTriviallyConstructible(FctCallNode *node) const;
   std::any visitBuiltinIsTriviallyCopyable(FctCallNode *node) const;
   std::any visitBuiltinIsTriviallyDestructible(FctCallNode *node) const;
+  std::any visitBuiltinIsTriviallyRelocatable(FctCallNode *node) const;
   std::any visitBuiltinNewCall(FctCallNode *node) const;
   std::any visitBuiltinPlacementNewCall(FctCallNode *node) const;
+  std::any visitBuiltinPtrToIntCall(FctCallNode *node) const;
+  std::any visitBuiltinAtomicLoadCall(FctCallNode *node) const;
+  std::any visitBuiltinAtomicStoreCall(FctCallNode *node) const;
+  std::any visitBuiltinAtomicRMWCall(FctCallNode *node) const;
+  std::any visitBuiltinAtomicCompareExchangeCall(FctCallNode *node) const;
+  std::any visitBuiltinAtomicFenceCall(FctCallNode *node) const;
+  std::any visitBuiltinSimdSplatCall(FctCallNode *node) const;
+  std::any visitBuiltinSimdLoadCall(FctCallNode *node) const;
+  std::any visitBuiltinSimdStoreCall(FctCallNode *node) const;
+  std::any visitBuiltinSimdSelectCall(FctCallNode *node) const;
+  std::any visitBuiltinSimdShuffleCall(FctCallNode *node) const;
+  std::any visitBuiltinSimdReduceCall(FctCallNode *node) const;
+  std::any visitBuiltinCoroSuspendCall(FctCallNode *node) const;
+  std::any visitBuiltinCoroHandleCall(FctCallNode *node) const;
 
 private:
   // Private members
@@ -156,11 +172,14 @@ private:
   bool visitOrdinaryFctCall(FctCallNode *node, std::string fqFunctionName) const;
   bool visitFctPtrCall(const FctCallNode *node, const QualType &functionType) const;
   bool visitMethodCall(FctCallNode *node, Scope *structScope) const;
+  [[nodiscard]] static const LambdaBaseNode *getInitLambda(const SymbolTableEntry *fctPtrEntry);
   bool checkAsyncLambdaCaptureRules(const LambdaBaseNode *node, const LambdaAttrNode *attrs) const;
   [[nodiscard]] Function *matchCopyCtor(const QualType &thisType, const ASTNode *node) const;
   [[nodiscard]] Function *matchMoveCtor(const QualType &thisType, const ASTNode *node) const;
   [[nodiscard]] QualType mapLocalTypeToImportedScopeType(const Scope *targetScope, const QualType &symbolType) const;
   [[nodiscard]] QualType mapImportedScopeTypeToLocalType(const Scope *sourceScope, const QualType &symbolType) const;
+  [[nodiscard]] QualType getFutureType(const QualType &resultType, const ASTNode *node) const;
+  [[nodiscard]] static bool isInAsyncFctBody(const ASTNode *node);
   std::vector<const Function *> &getOpFctPointers(ASTNode *node) const;
   static void requestRevisitIfRequired(const Function *fct);
   void ensureLoadedRuntimeForTypeName(const std::string &typeName) const;
@@ -190,6 +209,10 @@ private:
   void implicitlyCallDeallocate(const ASTNode *node) const;
   void doScopeCleanup(StmtLstNode *node) const;
   bool isCopyCtorCall(const FctCallNode *node, const QualType &thisType) const;
+  QualType checkAtomicBuiltinPtrArg(const FctCallNode *node, bool allowNonIntegralPointee) const;
+  bool checkAtomicBuiltinValueArg(const ExprNode *valueNode, const QualType &pointeeType) const;
+  QualType checkSimdBuiltinVectorArg(const ExprNode *vectorNode) const;
+  bool checkAtomicBuiltinOrderArg(const ExprNode *orderNode, std::initializer_list<BuiltinMemoryOrder> disallowedOrders) const;
 };
 
 } // namespace spice::compiler
\ No newline at end of file
@@ -324,11 +324,13 @@ std::any TypeChecker::visitBuiltinLenCall(FctCallNode *node) const {
   argType = argType.removeReferenceWrapper();
 
   // Check if arg is of type array
-  if (!argType.isArray() && !argType.is(TY_STRING))
-    SOFT_ERROR_ER(node->argLst->args.front(), EXPECTED_ARRAY_TYPE, "The len builtin can only work on arrays or strings")
+  if (!argType.isArray() && !argType.isVector() && !argType.is(TY_STRING))
+    SOFT_ERROR_ER(node->argLst->args.front(), EXPECTED_ARRAY_TYPE, "The len builtin can only work on arrays, vectors or strings")
 
   if (argType.is(TY_ARRAY)) {
     node->data.at(manIdx).setCompileTimeValue({.longValue = static_cast<int64_t>(argType.getArraySize())});
+  } else if (argType.isVector()) {
+    node->data.at(manIdx).setCompileTimeValue({.longValue = static_cast<int64_t>(argType.getVectorLaneCount())});
   } else {
     // If we want to use the len builtin on a string, we need to import the string runtime module
     if (!sourceFile->isStringRT())
@@ -490,6 +492,16 @@ std::any TypeChecker::visitBuiltinIsTriviallyDestructible(FctCallNode *node) con
   return ExprResult{node->setEvaluatedSymbolType(QualType(TY_BOOL), manIdx)};
 }
 
+std::any TypeChecker::visitBuiltinIsTriviallyRelocatable(FctCallNode *node) const {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_IS_TRIVIALLY_RELOCATABLE);
+
+  const QualType type = node->templateTypeLst->dataTypes.front()->getEvaluatedSymbolType(manIdx);
+  const bool value = type.isTriviallyRelocatable(node);
+  node->setCompileTimeValue({.boolValue = value}, manIdx);
+
+  return ExprResult{node->setEvaluatedSymbolType(QualType(TY_BOOL), manIdx)};
+}
+
 std::any TypeChecker::visitBuiltinNewCall(FctCallNode *node) const {
   assert(node->fqFunctionName == BUILTIN_FCT_NAME_NEW);
 
@@ -567,4 +579,335 @@ std::any TypeChecker::visitBuiltinPlacementNewCall(FctCallNode *node) const {
   return ExprResult{node->setEvaluatedSymbolType(templateType.toPtr(node), manIdx)};
 }
 
+std::any TypeChecker::visitBuiltinPtrToIntCall(FctCallNode *node) const {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_PTR_TO_INT);
+
+  const ExprNode *ptrNode = node->argLst->args.front();
+  const QualType ptrType = ptrNode->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  if (!ptrType.isPtr())
+    SOFT_ERROR_ER(ptrNode, BUILTIN_ARG_TYPE_MISMATCH, "__ptr_to_int expects a pointer")
+
+  QualType unsignedLongType(TY_LONG);
+  unsignedLongType.makeUnsigned(true);
+  return ExprResult{node->setEvaluatedSymbolType(unsignedLongType, manIdx)};
+}
+
+std::any TypeChecker::visitBuiltinAtomicLoadCall(FctCallNode *node) const {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_LOAD);
+
+  const QualType pointeeType = checkAtomicBuiltinPtrArg(node, true);
+  HANDLE_UNRESOLVED_TYPE_ER(pointeeType)
+  // Loads have no release semantics
+  if (!checkAtomicBuiltinOrderArg(node->argLst->args.at(1), {BuiltinMemoryOrder::RELEASE, BuiltinMemoryOrder::ACQ_REL}))
+    return ExprResult{QualType(TY_UNRESOLVED)};
+
+  return ExprResult{node->setEvaluatedSymbolType(pointeeType.toNonConst(), manIdx)};
+}
+
+std::any TypeChecker::visitBuiltinAtomicStoreCall(FctCallNode *node) const {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_STORE);
+
+  const QualType pointeeType = checkAtomicBuiltinPtrArg(node, true);
+  HANDLE_UNRESOLVED_TYPE_ER(pointeeType)
+  if (!checkAtomicBuiltinValueArg(node->argLst->args.at(1), pointeeType))
+    return ExprResult{QualType(TY_UNRESOLVED)};
+  // Stores have no acquire semantics
+  if (!checkAtomicBuiltinOrderArg(node->argLst->args.at(2), {BuiltinMemoryOrder::ACQUIRE, BuiltinMemoryOrder::ACQ_REL}))
+    return ExprResult{QualType(TY_UNRESOLVED)};
+
+  return ExprResult{node->setEvaluatedSymbolType(QualType(TY_DYN), manIdx)};
+}
+
+std::any TypeChecker::visitBuiltinAtomicRMWCall(FctCallNode *node) const {
+  const bool isExchange = node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_EXCHANGE;
+  assert(isExchange || node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_FETCH_ADD ||
+         node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_FETCH_SUB || node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_FETCH_AND ||
+         node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_FETCH_OR || node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_FETCH_XOR);
+
+  // Arithmetic and bitwise read-modify-write operations only work on integers, exchange also works on bools and pointers
+  const QualType pointeeType = checkAtomicBuiltinPtrArg(node, isExchange);
+  HANDLE_UNRESOLVED_TYPE_ER(pointeeType)
+  if (!checkAtomicBuiltinValueArg(node->argLst->args.at(1), pointeeType))
+    return ExprResult{QualType(TY_UNRESOLVED)};
+  if (!checkAtomicBuiltinOrderArg(node->argLst->args.at(2), {}))
+    return ExprResult{QualType(TY_UNRESOLVED)};
+
+  return ExprResult{node->setEvaluatedSymbolType(pointeeType.toNonConst(), manIdx)};
+}
+
+std::any TypeChecker::visitBuiltinAtomicCompareExchangeCall(FctCallNode *node) const {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_COMPARE_EXCHANGE);
+
+  const QualType pointeeType = checkAtomicBuiltinPtrArg(node, true);
+  HANDLE_UNRESOLVED_TYPE_ER(pointeeType)
+
+  // The expected value is passed by pointer, so that it can be updated with the actual value on failure
+  const ExprNode *expectedNode = node->argLst->args.at(1);
+  const QualType expectedType = expectedNode->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  if (!expectedType.isPtr() || !expectedType.getContained().matches(pointeeType.toNonConst(), false, true, true))
+    SOFT_ERROR_ER(expectedNode, BUILTIN_ARG_TYPE_MISMATCH,
+                  "__atomic_compare_exchange expects a '" + pointeeType.toNonConst().getName(false) + "*' as second argument")
+  if (!checkAtomicBuiltinValueArg(node->argLst->args.at(2), pointeeType))
+    return ExprResult{QualType(TY_UNRESOLVED)};
+
+  // The weak flag selects the instruction variant, so it has to be known at compile time
+  const ExprNode *weakNode = node->argLst->args.at(3);
+  if (!weakNode->getEvaluatedSymbolType(manIdx).is(TY_BOOL))
+    SOFT_ERROR_ER(weakNode, BUILTIN_ARG_TYPE_MISMATCH, "The weak flag of __atomic_compare_exchange must be a bool")
+  if (!weakNode->hasCompileTimeValue(manIdx))
+    SOFT_ERROR_ER(weakNode, EXPECTED_COMPILE_TIME_VALUE, "The weak flag of __atomic_compare_exchange must be known at compile time")
+
+  if (!checkAtomicBuiltinOrderArg(node->argLst->args.at(4), {}))
+    return ExprResult{QualType(TY_UNRESOLVED)};
+
+  return ExprResult{node->setEvaluatedSymbolType(QualType(TY_BOOL), manIdx)};
+}
+
+std::any TypeChecker::visitBuiltinAtomicFenceCall(FctCallNode *node) const {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_ATOMIC_FENCE);
+
+  // A relaxed fence would have no effect and is rejected by LLVM
+  if (!checkAtomicBuiltinOrderArg(node->argLst->args.front(), {BuiltinMemoryOrder::RELAXED}))
+    return ExprResult{QualType(TY_UNRESOLVED)};
+
+  return ExprResult{node->setEvaluatedSymbolType(QualType(TY_DYN), manIdx)};
+}
+
+std::any TypeChecker::visitBuiltinSimdSplatCall(FctCallNode *node) const {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_SPLAT);
+
+  const QualType vectorType = node->templateTypeLst->dataTypes.front()->getEvaluatedSymbolType(manIdx);
+  if (!vectorType.isVector())
+    SOFT_ERROR_ER(node, BUILTIN_ARG_TYPE_MISMATCH, "__simd_splat expects a vector type as template type")
+
+  const QualType laneType = vectorType.getContained();
+  const ExprNode *scalarNode = node->argLst->args.front();
+  const QualType scalarType = scalarNode->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  if (!scalarType.is(laneType.getSuperType())) {
+    const auto msg = "Argument type '" + scalarType.getName() + "' does not match lane type '" + laneType.getName() + "'";
+    SOFT_ERROR_ER(scalarNode, BUILTIN_ARG_TYPE_MISMATCH, msg)
+  }
+
+  return ExprResult{node->setEvaluatedSymbolType(vectorType.toNonConst(), manIdx)};
+}
+
+std::any TypeChecker::visitBuiltinSimdLoadCall(FctCallNode *node) const {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_LOAD);
+
+  const QualType vectorType = node->templateTypeLst->dataTypes.front()->getEvaluatedSymbolType(manIdx);
+  if (!vectorType.isVector())
+    SOFT_ERROR_ER(node, BUILTIN_ARG_TYPE_MISMATCH, "__simd_load expects a vector type as template type")
+
+  // The load is unaligned, so any pointer to the lane type works, e.g. one into the middle of an array
+  const QualType laneType = vectorType.getContained();
+  const ExprNode *ptrNode = node->argLst->args.front();
+  const QualType ptrType = ptrNode->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  if (!ptrType.isPtr() || !ptrType.getContained().is(laneType.getSuperType()))
+    SOFT_ERROR_ER(ptrNode, BUILTIN_ARG_TYPE_MISMATCH,
+                  "__simd_load expects a pointer to the lane type '" + laneType.getName() + "'")
+
+  return ExprResult{node->setEvaluatedSymbolType(vectorType.toNonConst(), manIdx)};
+}
+
+std::any TypeChecker::visitBuiltinSimdStoreCall(FctCallNode *node) const {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_STORE);
+
+  const QualType vectorType = checkSimdBuiltinVectorArg(node->argLst->args.at(1));
+  HANDLE_UNRESOLVED_TYPE_ER(vectorType)
+
+  const QualType laneType = vectorType.getContained();
+  const ExprNode *ptrNode = node->argLst->args.front();
+  const QualType ptrType = ptrNode->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  if (!ptrType.isPtr() || !ptrType.getContained().is(laneType.getSuperType()) || ptrType.getContained().isConst())
+    SOFT_ERROR_ER(ptrNode, BUILTIN_ARG_TYPE_MISMATCH,
+                  "__simd_store expects a pointer to the lane type '" + laneType.getName() + "'")
+
+  return ExprResult{node->setEvaluatedSymbolType(QualType(TY_DYN), manIdx)};
+}
+
+std::any TypeChecker::visitBuiltinSimdSelectCall(FctCallNode *node) const {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_SELECT);
+
+  const std::vector<ExprNode *> &args = node->argLst->args;
+  const QualType maskType = checkSimdBuiltinVectorArg(args.at(0));
+  HANDLE_UNRESOLVED_TYPE_ER(maskType)
+  const QualType trueType = checkSimdBuiltinVectorArg(args.at(1));
+  HANDLE_UNRESOLVED_TYPE_ER(trueType)
+  const QualType falseType = checkSimdBuiltinVectorArg(args.at(2));
+  HANDLE_UNRESOLVED_TYPE_ER(falseType)
+
+  // The mask picks the lane from the first vector, where it is true and from the second one otherwise
+  if (!maskType.getContained().is(TY_BOOL))
+    SOFT_ERROR_ER(args.at(0), BUILTIN_ARG_TYPE_MISMATCH, "__simd_select expects a bool vector as mask")
+  if (!trueType.matches(falseType, false, true, true))
+    SOFT_ERROR_ER(node, BUILTIN_ARG_TYPE_MISMATCH, "The vectors, passed to __simd_select, must be of the same type")
+  if (maskType.getVectorLaneCount() != trueType.getVectorLaneCount())
+    SOFT_ERROR_ER(args.at(0), BUILTIN_ARG_TYPE_MISMATCH,
+                  "The mask of __simd_select must have the same lane count as the vectors")
+
+  return ExprResult{node->setEvaluatedSymbolType(trueType, manIdx)};
+}
+
+std::any TypeChecker::visitBuiltinSimdShuffleCall(FctCallNode *node) const {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_SHUFFLE);
+
+  const std::vector<ExprNode *> &args = node->argLst->args;
+  const QualType lhsType = checkSimdBuiltinVectorArg(args.at(0));
+  HANDLE_UNRESOLVED_TYPE_ER(lhsType)
+  const QualType rhsType = checkSimdBuiltinVectorArg(args.at(1));
+  HANDLE_UNRESOLVED_TYPE_ER(rhsType)
+  if (!lhsType.matches(rhsType, false, true, true))
+    SOFT_ERROR_ER(node, BUILTIN_ARG_TYPE_MISMATCH, "The vectors, passed to __simd_shuffle, must be of the same type")
+
+  // The indices select lanes from the concatenation of both vectors and end up as constant shuffle mask in the IR
+  const unsigned int inputLaneCount = lhsType.getVectorLaneCount() * 2;
+  for (size_t i = 2; i < args.size(); i++) {
+    const ExprNode *indexNode = args.at(i);
+    if (!indexNode->getEvaluatedSymbolType(manIdx).is(TY_INT) || !indexNode->hasCompileTimeValue(manIdx))
+      SOFT_ERROR_ER(indexNode, EXPECTED_COMPILE_TIME_VALUE,
+                    "The lane indices of __simd_shuffle must be ints, known at compile time")
+    const int32_t index = indexNode->getCompileTimeValue(manIdx).intValue;
+    if (index < 0 || static_cast<unsigned int>(index) >= inputLaneCount)
+      SOFT_ERROR_ER(indexNode, BUILTIN_ARG_TYPE_MISMATCH,
+                    "Lane index " + std::to_string(index) + " is out of bounds for " + std::to_string(inputLaneCount) + " lanes")
+  }
+
+  const QualType resultType = lhsType.getContained().toVec(node, args.size() - 2);
+  return ExprResult{node->setEvaluatedSymbolType(resultType, manIdx)};
+}
+
+std::any TypeChecker::visitBuiltinSimdReduceCall(FctCallNode *node) const {
+  const bool isBitwise = node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_REDUCE_AND ||
+                         node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_REDUCE_OR;
+  assert(isBitwise || node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_REDUCE_ADD ||
+         node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_REDUCE_MIN || node->fqFunctionName == BUILTIN_FCT_NAME_SIMD_REDUCE_MAX);
+
+  const QualType vectorType = checkSimdBuiltinVectorArg(node->argLst->args.front());
+  HANDLE_UNRESOLVED_TYPE_ER(vectorType)
+
+  // Arithmetic reductions work on numbers, bitwise reductions on integers and masks
+  const QualType laneType = vectorType.getContained();
+  if (isBitwise ? laneType.is(TY_DOUBLE) : laneType.is(TY_BOOL))
+    SOFT_ERROR_ER(node, BUILTIN_ARG_TYPE_MISMATCH,
+                  std::string(node->fqFunctionName) + " does not work on vectors with lane type " + laneType.getName(false))
+
+  return ExprResult{node->setEvaluatedSymbolType(laneType, manIdx)};
+}
+
+std::any TypeChecker::visitBuiltinCoroSuspendCall(FctCallNode *node) const {
+  assert(node->fqFunctionName == BUILTIN_FCT_NAME_CORO_SUSPEND);
+
+  // Only coroutines can be suspended
+  if (!isInAsyncFctBody(node))
+    SOFT_ERROR_ER(node, AWAIT_OUTSIDE_ASYNC_FCT, "__coro_suspend can only be used in async functions")
+
+  // The handle of the suspended coroutine gets stored to the given slot, so that somebody can resume it later on
+  const ExprNode *slotNode = node->argLst->args.front();
+  const QualType slotType = slotNode->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  if (!slotType.isPtr() || !slotType.getContained().isPtrTo(TY_BYTE) || slotType.getContained().isConst())
+    SOFT_ERROR_ER(slotNode, BUILTIN_ARG_TYPE_MISMATCH, "__coro_suspend expects a byte** as handle slot")
+
+  return ExprResult{node->setEvaluatedSymbolType(QualType(TY_DYN), manIdx)};
+}
+
+std::any TypeChecker::visitBuiltinCoroHandleCall(FctCallNode *node) const {
+  const std::string_view &name = node->fqFunctionName;
+  assert(name == BUILTIN_FCT_NAME_CORO_RESUME || name == BUILTIN_FCT_NAME_CORO_DESTROY || name == BUILTIN_FCT_NAME_CORO_DONE ||
+         name == BUILTIN_FCT_NAME_CORO_DETACH || name == BUILTIN_FCT_NAME_CORO_RESULT);
+
+  // All of these builtins operate on a coroutine handle
+  const ExprNode *handleNode = node->argLst->args.front();
+  const QualType handleType = handleNode->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  if (!handleType.isPtrTo(TY_BYTE))
+    SOFT_ERROR_ER(handleNode, BUILTIN_ARG_TYPE_MISMATCH, std::string(name) + " expects a byte* as coroutine handle")
+
+  QualType resultType(TY_DYN);
+  if (name == BUILTIN_FCT_NAME_CORO_DONE) {
+    resultType = QualType(TY_BOOL);
+  } else if (name == BUILTIN_FCT_NAME_CORO_RESULT) {
+    // The template type is the result type of the coroutine. The builtin yields a pointer to the result slot
+    const QualType coroResultType = node->templateTypeLst->dataTypes.front()->getEvaluatedSymbolType(manIdx);
+    resultType = coroResultType.toNonConst().toPtr(node);
+  }
+
+  return ExprResult{node->setEvaluatedSymbolType(resultType, manIdx)};
+}
+
+/**
+ * Check the pointer argument of an atomic builtin and retrieve the type it points to
+ *
+ * @param node Atomic builtin call node
+ * @param allowNonIntegralPointee Allow atomic operations on bools and pointers, not only on integers
+ * @return Pointee type or unresolved type on error
+ */
+QualType TypeChecker::checkAtomicBuiltinPtrArg(const FctCallNode *node, bool allowNonIntegralPointee) const {
+  const ExprNode *ptrNode = node->argLst->args.front();
+  const QualType ptrType = ptrNode->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  if (!ptrType.isPtr())
+    SOFT_ERROR_QT(ptrNode, BUILTIN_ARG_TYPE_MISMATCH, "Atomic builtins expect a pointer as first argument")
+
+  const QualType pointeeType = ptrType.getContained();
+  const bool isIntegral = pointeeType.isOneOf({TY_INT, TY_SHORT, TY_LONG, TY_BYTE, TY_CHAR});
+  const bool isBoolOrPtr = pointeeType.is(TY_BOOL) || pointeeType.isPtr();
+  if (!isIntegral && !(allowNonIntegralPointee && isBoolOrPtr)) {
+    const char *expected = allowNonIntegralPointee ? "integer, bool or pointer" : "integer";
+    SOFT_ERROR_QT(ptrNode, BUILTIN_ARG_TYPE_MISMATCH,
+                  std::string(node->fqFunctionName) + " only works on " + expected + " values, but got " +
+                      pointeeType.getName(false))
+  }
+  return pointeeType;
+}
+
+/**
+ * Check that the value argument of an atomic builtin matches the type the pointer argument points to
+ *
+ * @param valueNode Value argument
+ * @param pointeeType Type, the pointer argument points to
+ * @return Valid or not
+ */
+bool TypeChecker::checkAtomicBuiltinValueArg(const ExprNode *valueNode, const QualType &pointeeType) const {
+  const QualType valueType = valueNode->getEvaluatedSymbolType(manIdx).removeReferenceWrapper().toNonConst();
+  if (!valueType.matches(pointeeType.toNonConst(), false, true, true)) {
+    const auto msg = "Argument type '" + valueType.getName() + "' does not match pointee type '" + pointeeType.getName() + "'";
+    SOFT_ERROR_BOOL(valueNode, BUILTIN_ARG_TYPE_MISMATCH, msg)
+  }
+  return true;
+}
+
+/**
+ * Check that an argument of a SIMD builtin is a vector and retrieve its type
+ *
+ * @param vectorNode Vector argument
+ * @return Vector type or unresolved type on error
+ */
+QualType TypeChecker::checkSimdBuiltinVectorArg(const ExprNode *vectorNode) const {
+  const QualType vectorType = vectorNode->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  if (!vectorType.isVector())
+    SOFT_ERROR_QT(vectorNode, BUILTIN_ARG_TYPE_MISMATCH, "Expected a vector, but got " + vectorType.getName(false))
+  return vectorType.toNonConst();
+}
+
+/**
+ * Check the memory order argument of an atomic builtin. Orders that are only known at runtime are accepted as well.
+ *
+ * @param orderNode Memory order argument
+ * @param disallowedOrders Memory orders, that are not valid for the respective operation
+ * @return Valid or not
+ */
+bool TypeChecker::checkAtomicBuiltinOrderArg(const ExprNode *orderNode,
+                                             std::initializer_list<BuiltinMemoryOrder> disallowedOrders) const {
+  const QualType orderType = orderNode->getEvaluatedSymbolType(manIdx).removeReferenceWrapper();
+  if (!orderType.isOneOf({TY_INT, TY_ENUM}))
+    SOFT_ERROR_BOOL(orderNode, BUILTIN_ARG_TYPE_MISMATCH, "The memory order must be a MemoryOrder or int")
+
+  if (orderNode->hasCompileTimeValue(manIdx)) {
+    const int32_t order = orderNode->getCompileTimeValue(manIdx).intValue;
+    if (order < 0 || order > static_cast<int32_t>(BuiltinMemoryOrder::SEQ_CST))
+      SOFT_ERROR_BOOL(orderNode, BUILTIN_ARG_TYPE_MISMATCH, "Unknown memory order " + std::to_string(order))
+    if (std::ranges::find(disallowedOrders, static_cast<BuiltinMemoryOrder>(order)) != disallowedOrders.end())
+      SOFT_ERROR_BOOL(orderNode, BUILTIN_ARG_TYPE_MISMATCH, "This memory order is not allowed for this atomic operation")
+  }
+  return true;
+}
+
 } // namespace spice::compiler
@@ -79,8 +79,8 @@ std::any TypeChecker::visitForeachLoop(ForeachLoopNode *node) {
       throw SemanticError(iteratorNode, INVALID_ITERATOR, "No getIterator() function found for the given iterable type");
 
     iteratorType = QualType(node->getIteratorFct->returnType);
-    // Add anonymous symbol to keep track of dtor call, if non-trivially destructible
-    if (!iteratorType.isTriviallyDestructible(iteratorNode))
+    // Add anonymous symbol to keep track of dtor call, if non-trivially destructible. Arrays do not need an iterator at runtime
+    if (!iterableType.isArray() && !iteratorType.isTriviallyDestructible(iteratorNode))
       currentScope->symbolTable.insertAnonymous(iteratorType, iteratorNode);
   }
 
@@ -155,6 +155,10 @@ std::any TypeChecker::visitForeachLoop(ForeachLoopNode *node) {
   // Visit body
   visit(node->body);
 
+  // If the idx is never read, retrieve .get() as well, so that no pair has to be constructed in each iteration
+  if (hasIdx && !iteratorOrIterableType.isArray() && !node->idxVarDecl->entries.at(manIdx)->used)
+    node->getFct = FunctionManager::match(matchScope, "get", iteratorType, {}, {}, false, node);
+
   return nullptr;
 }
 
@@ -500,6 +500,21 @@ std::any TypeChecker::visitPrefixUnaryExpr(PrefixUnaryExprNode *node) {
   case PrefixUnaryExprNode::PrefixUnaryOp::OP_ADDRESS_OF:
     operandType = OpRuleManager::getPrefixBitwiseAndResultType(node, operand);
     break;
+  case PrefixUnaryExprNode::PrefixUnaryOp::OP_AWAIT: {
+    // Await may only appear in the body of an async function, but not in lambdas within such
+    if (!isInAsyncFctBody(node))
+      SOFT_ERROR_ER(node, AWAIT_OUTSIDE_ASYNC_FCT, "Await can only be used in async functions")
+    // Only futures can be awaited
+    const QualType futureType = operandType.removeReferenceWrapper();
+    if (!futureType.isFutureObj())
+      SOFT_ERROR_ER(rhsNode, OPERATOR_WRONG_DATA_TYPE, "Cannot apply 'await' operator on type " + operandType.getName(true))
+    // The result is a temporary value of the result type of the future
+    operandType = futureType.getTemplateTypes().front();
+    operandEntry = nullptr;
+    if (operandType.is(TY_STRUCT) && !operandType.isTriviallyDestructible(node))
+      operandEntry = currentScope->symbolTable.insertAnonymous(operandType, node);
+    break;
+  }
   default:                                                                 // GCOV_EXCL_LINE
     throw CompilerError(UNHANDLED_BRANCH, "PrefixUnaryExpr fall-through"); // GCOV_EXCL_LINE
   }
@@ -539,10 +554,14 @@ std::any TypeChecker::visitPostfixUnaryExpr(PostfixUnaryExprNode *node) {
       SOFT_ERROR_ER(node, ARRAY_INDEX_NOT_INT_OR_LONG, "Array index must be of type int or long")
 
     // Check if we can apply the subscript operator on the lhs type
-    if (!operandType.isOneOf({TY_ARRAY, TY_PTR, TY_STRING}))
+    if (!operandType.isOneOf({TY_ARRAY, TY_VECTOR, TY_PTR, TY_STRING}))
       SOFT_ERROR_ER(node, OPERATOR_WRONG_DATA_TYPE,
                     "Can only apply subscript operator on array type, got " + operandType.getName(true))
 
+    // Bool vectors are bit-packed, so their lanes are not addressable
+    if (operandType.isVector() && operandType.getContained().is(TY_BOOL))
+      SOFT_ERROR_ER(node, OPERATOR_WRONG_DATA_TYPE, "Cannot apply subscript operator on bool vectors. Use a select instead")
+
     // Check if we have an unsafe operation
     if (operandType.isPtr() && !currentScope->doesAllowUnsafeOperations())
       SOFT_ERROR_ER(
@@ -550,10 +569,10 @@ std::any TypeChecker::visitPostfixUnaryExpr(PostfixUnaryExprNode *node) {
           "The subscript operator on pointers is an unsafe operation. Use unsafe blocks if you know what you are doing.")
 
     // In case of compile time index value and known array size, perform a compile time out-of-bounds check
-    if (operandType.isArray() && operandType.getArraySize() != ARRAY_SIZE_UNKNOWN &&
-        indexAssignExpr->hasCompileTimeValue(manIdx)) {
+    const bool isSizedArray = operandType.isArray() && operandType.getArraySize() != ARRAY_SIZE_UNKNOWN;
+    if ((isSizedArray || operandType.isVector()) && indexAssignExpr->hasCompileTimeValue(manIdx)) {
       const int32_t constIndex = indexAssignExpr->getCompileTimeValue(manIdx).intValue;
-      const unsigned int constSize = operandType.getArraySize();
+      const unsigned int constSize = operandType.isVector() ? operandType.getVectorLaneCount() : operandType.getArraySize();
       // Check if we are accessing out-of-bounds memory
       if (constIndex >= static_cast<int32_t>(constSize)) {
         const std::string idxStr = std::to_string(constIndex);
@@ -697,12 +716,18 @@ std::any TypeChecker::visitAtomicExpr(AtomicExprNode *node) {
       SOFT_ERROR_ER(node, REFERENCED_OVERLOADED_FCT, "Overloaded functions / functions with optional params cannot be referenced")
     if (!manifestations->front()->templateTypes.empty())
       SOFT_ERROR_ER(node, REFERENCED_OVERLOADED_FCT, "Generic functions cannot be referenced")
+    if (manifestations->front()->isAsync)
+      SOFT_ERROR_ER(node, ASYNC_FCT_INVALID, "Async functions cannot be referenced")
     // Set referenced function to used
     Function *referencedFunction = manifestations->front();
     referencedFunction->used = true;
     referencedFunction->entry->used = true;
   }
 
+  // Function pointers, that are used in other ways than being called, can not be called directly anymore
+  if (varType.isOneOf({TY_FUNCTION, TY_PROCEDURE}))
+    entry->escapes = true;
+
   // The base type should be an extended primitive
   const QualType baseType = varType.getBase();
   if (!baseType.isExtendedPrimitive() && !baseType.is(TY_DYN))
@@ -11,6 +11,8 @@
 #include <typechecker/FunctionManager.h>
 #include <typechecker/TypeMatcher.h>
 
+#include <llvm/Support/TimeProfiler.h>
+
 namespace spice::compiler {
 
 std::any TypeChecker::visitMainFctDefCheck(MainFctDefNode *node) {
@@ -44,6 +46,8 @@ std::any TypeChecker::visitFctDefCheck(FctDefNode *node) {
       continue;
     }
 
+    llvm::TimeTraceScope timeTraceScope("Type Checker Function", [&] { return manifestation->getSignature(); });
+
     // Change scope to concrete struct specialization scope
     if (node->isMethod) {
       const std::string &scopeName = Struct::getScopeName(node->name->structName, manifestation->thisType.getTemplateTypes());
@@ -63,6 +67,10 @@ std::any TypeChecker::visitFctDefCheck(FctDefNode *node) {
     resultVarEntry->updateType(manifestation->returnType, false);
     resultVarEntry->used = true;
 
+    // Async functions hand a future of their result out to the caller
+    if (manifestation->isAsync)
+      manifestation->futureType = getFutureType(manifestation->returnType, node);
+
     // Visit parameters
     // This happens once in the type checker prepare stage. This second time is only required if we have a generic function
     if (node->hasParams) {
@@ -112,6 +120,8 @@ std::any TypeChecker::visitProcDefCheck(ProcDefNode *node) {
       continue;
     }
 
+    llvm::TimeTraceScope timeTraceScope("Type Checker Function", [&] { return manifestation->getSignature(); });
+
     // Change scope to concrete struct specialization scope
     if (node->isMethod) {
       const std::string &scopeName = Struct::getScopeName(node->name->structName, manifestation->thisType.getTemplateTypes());
@@ -6,12 +6,14 @@
 
 #include <SourceFile.h>
 #include <ast/Attributes.h>
+#include <driver/Driver.h>
 #include <global/GlobalResourceManager.h>
 #include <global/TypeRegistry.h>
 #include <model/GenericType.h>
 #include <model/Interface.h>
 #include <symboltablebuilder/Scope.h>
 #include <symboltablebuilder/SymbolTableBuilder.h>
+#include <typechecker/CompileTimeInterpreter.h>
 #include <typechecker/FunctionManager.h>
 #include <typechecker/InterfaceManager.h>
 #include <typechecker/MacroDefs.h>
@@ -160,6 +162,38 @@ std::any TypeChecker::visitFctDefPrepare(FctDefNode *node) {
   // Build function object
   Function spiceFunc(node->name->name, functionEntry, thisType, returnType, paramList, usedGenericTypes, node);
   spiceFunc.bodyScope = node->scope;
+
+  // Check if the function can be evaluated at compile time. All manifestations inherit this flag
+  if (node->attrs) {
+    const CompileTimeValue *value = node->attrs->attrLst->getAttrValueByName(ATTR_COMPILE_TIME);
+    spiceFunc.isCompileTime = value && value->boolValue;
+  }
+  if (spiceFunc.isCompileTime) {
+    if (node->isMethod)
+      throw SemanticError(node, COMPILE_TIME_FCT_INVALID, "Methods cannot be evaluated at compile time");
+    for (const QualType &paramType : paramTypes)
+      if (!CompileTimeInterpreter::isSupportedType(paramType))
+        throw SemanticError(node->paramLst, COMPILE_TIME_FCT_INVALID,
+                            "Compile-time functions only accept primitive types and arrays of those as parameters");
+    if (!CompileTimeInterpreter::isSupportedType(returnType))
+      throw SemanticError(node->returnType, COMPILE_TIME_FCT_INVALID,
+                          "Compile-time functions can only return primitive types and arrays of those");
+  }
+
+  // Check if the function is async. All manifestations inherit this flag
+  spiceFunc.isAsync = node->isAsync;
+  if (spiceFunc.isAsync) {
+    if (spiceFunc.isCompileTime)
+      throw SemanticError(node, ASYNC_FCT_INVALID, "Async functions cannot be evaluated at compile time");
+    if (node->name->isOperatorOverload())
+      throw SemanticError(node, ASYNC_FCT_INVALID, "Operator overloads cannot be async");
+    if (returnType.isRef())
+      throw SemanticError(node->returnType, ASYNC_FCT_INVALID, "Async functions cannot return references");
+    // The caller receives a Future, which is defined in the async runtime
+    if (!sourceFile->isRT(ASYNC_RT))
+      sourceFile->requestRuntimeModule(ASYNC_RT);
+  }
+
   FunctionManager::insert(currentScope, spiceFunc, &node->manifestations);
 
   // Check function attributes
@@ -183,6 +217,8 @@ std::any TypeChecker::visitFctDefPrepare(FctDefNode *node) {
       firstManifestation->used = true;        // Always keep test functions, because they are called implicitly by the test main
       sourceFile->testFunctions.push_back(node->manifestations.front());
     }
+    if (const CompileTimeValue *value = attrLst->getAttrValueByName(ATTR_BENCH); value && value->boolValue)
+      throw SemanticError(node->returnType, BENCH_FUNCTION_INVALID, "Benchmarks must be procedures");
   }
 
   // Duplicate / rename the original child scope to reflect the substantiated versions of the function
@@ -295,12 +331,31 @@ std::any TypeChecker::visitProcDefPrepare(ProcDefNode *node) {
   // Check procedure attributes
   if (node->attrs) {
     const AttrLstNode *attrLst = node->attrs->attrLst;
+    if (const CompileTimeValue *value = attrLst->getAttrValueByName(ATTR_COMPILE_TIME); value && value->boolValue)
+      throw SemanticError(node, COMPILE_TIME_FCT_INVALID, "Only functions can be evaluated at compile time");
     if (const CompileTimeValue *value = attrLst->getAttrValueByName(ATTR_CORE_COMPILER_MANGLE))
       node->manifestations.front()->mangleFunctionName = value->boolValue;
     if (const CompileTimeValue *value = attrLst->getAttrValueByName(ATTR_CORE_COMPILER_MANGLED_NAME)) {
       const std::string &stringValue = resourceManager.compileTimeStringValues.at(value->stringValueOffset);
       node->manifestations.front()->predefinedMangledName = stringValue;
     }
+    if (const CompileTimeValue *value = attrLst->getAttrValueByName(ATTR_BENCH); value && value->boolValue) {
+      // Make sure that the procedure has the correct signature
+      if (node->hasParams)
+        throw SemanticError(node->paramLst, BENCH_FUNCTION_INVALID, "Benchmark procedure may not have parameters");
+      if (node->isMethod)
+        throw SemanticError(node, BENCH_FUNCTION_INVALID, "Benchmark procedure may not be a method");
+      // Benchmarks are only collected if the bench main gets generated
+      if (cliOptions.generateBenchMain) {
+        Function *firstManifestation = node->manifestations.front();
+        firstManifestation->entry->used = true; // Avoid printing unused warnings
+        firstManifestation->used = true;        // Always keep benchmarks, because they are called implicitly by the bench main
+        sourceFile->benchFunctions.push_back(firstManifestation);
+        // The bench main drives the benchmarks through the bench runtime
+        if (!sourceFile->isRT(BENCH_RT))
+          sourceFile->requestRuntimeModule(BENCH_RT);
+      }
+    }
   }
 
   // Duplicate / rename the original child scope to reflect the substantiated versions of the procedure
@@ -725,6 +780,8 @@ std::any TypeChecker::visitExtDeclPrepare(ExtDeclNode *node) {
   // Check procedure attributes
   if (node->attrs) {
     const AttrLstNode *attrLst = node->attrs->attrLst;
+    if (const CompileTimeValue *value = attrLst->getAttrValueByName(ATTR_COMPILE_TIME); value && value->boolValue)
+      throw SemanticError(node, COMPILE_TIME_FCT_INVALID, "Only functions can be evaluated at compile time");
     if (const CompileTimeValue *value = attrLst->getAttrValueByName(ATTR_CORE_COMPILER_MANGLE))
       node->extFunction->mangleFunctionName = value->boolValue;
     if (const CompileTimeValue *value = attrLst->getAttrValueByName(ATTR_CORE_COMPILER_MANGLED_NAME)) {
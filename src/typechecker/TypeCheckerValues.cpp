@@ -86,7 +86,8 @@ std::any TypeChecker::visitConstant(ConstantNode *node) {
 
 std::any TypeChecker::visitFctCall(FctCallNode *node) {
   FctCallNode::FctCallData &data = node->data.at(manIdx);
-  auto &[callType, isImported, templateTypes, thisType, args, callee, calleeParentScope, compTimeVal, hasCompTimeVal] = data;
+  auto &[callType, isImported, templateTypes, thisType, args, callee, calleeParentScope, compTimeVal, hasCompTimeVal,
+         compTimeArrayItems, hasCompTimeArrayItems, calleeLambda] = data;
 
   // Retrieve arg types
   args.clear();
@@ -177,6 +178,9 @@ std::any TypeChecker::visitFctCall(FctCallNode *node) {
     assert(functionType.isOneOf({TY_FUNCTION, TY_PROCEDURE}));
     if (!visitFctPtrCall(node, functionType)) // Check if soft errors occurred
       return ExprResult{node->setEvaluatedSymbolType(QualType(TY_UNRESOLVED), manIdx)};
+    // Remember the lambda, the function pointer was initialized with. As long as the function pointer does not escape,
+    // the lambda can be called directly
+    calleeLambda = getInitLambda(firstFragEntry);
   } else {
     // This is an ordinary function call
     assert(data.isOrdinaryCall() || data.isCtorCall());
@@ -258,6 +262,9 @@ std::any TypeChecker::visitFctCall(FctCallNode *node) {
     returnType = thisType;
   } else if (callee->isProcedure()) {
     returnType = QualType(TY_DYN);
+  } else if (callee->isAsync) {
+    // Calling an async function starts it and yields a future of its result
+    returnType = getFutureType(callee->returnType, node);
   } else {
     returnType = callee->returnType;
   }
@@ -295,7 +302,8 @@ std::any TypeChecker::visitFctCall(FctCallNode *node) {
 
 bool TypeChecker::visitOrdinaryFctCall(FctCallNode *node, std::string fqFunctionName) const {
   FctCallNode::FctCallData &data = node->data.at(manIdx);
-  auto &[callType, isImported, templateTypes, thisType, args, callee, calleeParentScope, compTimeVal, hasCompTimeVal] = data;
+  auto &[callType, isImported, templateTypes, thisType, args, callee, calleeParentScope, compTimeVal, hasCompTimeVal,
+         compTimeArrayItems, hasCompTimeArrayItems, calleeLambda] = data;
 
   // Check if this is a well-known ctor/fct call
   if (node->functionNameFragments.size() == 1) {
@@ -363,8 +371,8 @@ bool TypeChecker::visitOrdinaryFctCall(FctCallNode *node, std::string fqFunction
 
 bool TypeChecker::visitFctPtrCall(const FctCallNode *node, const QualType &functionType) const {
   const FctCallNode::FctCallData &data = node->data.at(manIdx);
-  const auto &[callType, isImported, templateTypes, thisType, args, callee, calleeParentScope, compTimeVal, hasCompTimeVal] =
-      data;
+  const auto &[callType, isImported, templateTypes, thisType, args, callee, calleeParentScope, compTimeVal, hasCompTimeVal,
+               compTimeArrayItems, hasCompTimeArrayItems, calleeLambda] = data;
 
   // Check if the given argument types match the type
   const QualTypeList expectedArgTypes = functionType.getFunctionParamTypes();
@@ -384,9 +392,28 @@ bool TypeChecker::visitFctPtrCall(const FctCallNode *node, const QualType &funct
   return true;
 }
 
+const LambdaBaseNode *TypeChecker::getInitLambda(const SymbolTableEntry *fctPtrEntry) {
+  // Params can be initialized with any function pointer by the caller
+  const auto declNode = dynamic_cast<const DeclStmtNode *>(fctPtrEntry->declNode);
+  if (declNode == nullptr || !declNode->hasAssignment || declNode->isFctParam)
+    return nullptr;
+
+  // Check if the initializer is a lambda literal
+  const auto atomicExpr = dynamic_cast<const AtomicExprNode *>(declNode->assignExpr);
+  if (atomicExpr == nullptr || atomicExpr->value == nullptr)
+    return nullptr;
+  const ValueNode *value = atomicExpr->value;
+  if (value->lambdaFunc)
+    return value->lambdaFunc;
+  if (value->lambdaProc)
+    return value->lambdaProc;
+  return value->lambdaExpr;
+}
+
 bool TypeChecker::visitMethodCall(FctCallNode *node, Scope *structScope) const {
   FctCallNode::FctCallData &data = node->data.at(manIdx);
-  auto &[callType, isImported, templateTypes, thisType, args, callee, calleeParentScope, compTimeVal, hasCompTimeVal] = data;
+  auto &[callType, isImported, templateTypes, thisType, args, callee, calleeParentScope, compTimeVal, hasCompTimeVal,
+         compTimeArrayItems, hasCompTimeArrayItems, calleeLambda] = data;
 
   // Traverse through structs - the first fragment is already looked up and the last one is the method name
   for (size_t i = 1; i < node->functionNameFragments.size() - 1; i++) {
@@ -626,7 +653,7 @@ std::any TypeChecker::visitLambdaFunc(LambdaFuncNode *node) {
   const std::string fctName = "lambda." + node->codeLoc.toPrettyLineAndColumn();
   node->manifestations.at(manIdx) = Function(fctName, nullptr, QualType(TY_DYN), returnType, paramList, {}, node);
   node->manifestations.at(manIdx).bodyScope = bodyScope;
-  node->manifestations.at(manIdx).mangleSuffix = "." + std::to_string(manIdx);
+  node->manifestations.at(manIdx).setMangleSuffix("." + std::to_string(manIdx));
 
   // Check special requirements if this is an async lambda
   (void)checkAsyncLambdaCaptureRules(node, node->lambdaAttr);
@@ -673,7 +700,7 @@ std::any TypeChecker::visitLambdaProc(LambdaProcNode *node) {
   const std::string fctName = "lambda." + node->codeLoc.toPrettyLineAndColumn();
   node->manifestations.at(manIdx) = Function(fctName, nullptr, QualType(TY_DYN), QualType(TY_DYN), paramList, {}, node);
   node->manifestations.at(manIdx).bodyScope = bodyScope;
-  node->manifestations.at(manIdx).mangleSuffix = "." + std::to_string(manIdx);
+  node->manifestations.at(manIdx).setMangleSuffix("." + std::to_string(manIdx));
 
   // Check special requirements if this is an async lambda
   (void)checkAsyncLambdaCaptureRules(node, node->lambdaAttr);
@@ -720,7 +747,7 @@ std::any TypeChecker::visitLambdaExpr(LambdaExprNode *node) {
   const std::string fctName = "lambda." + node->codeLoc.toPrettyLineAndColumn();
   node->manifestations.at(manIdx) = Function(fctName, nullptr, QualType(TY_DYN), returnType, paramList, {}, node);
   node->manifestations.at(manIdx).bodyScope = bodyScope;
-  node->manifestations.at(manIdx).mangleSuffix = "." + std::to_string(manIdx);
+  node->manifestations.at(manIdx).setMangleSuffix("." + std::to_string(manIdx));
 
   return ExprResult{node->setEvaluatedSymbolType(functionType, manIdx)};
 }
@@ -52,11 +52,15 @@ public:
 
     // Update offset to be ready to store the next object
     offsetInBlock += objSize;
+    usedSize += objSize;
     return ptr;
   }
 
   [[nodiscard]] size_t getTotalAllocatedSize() const { return memoryBlocks.size() * blockSize; }
+  [[nodiscard]] size_t getUsedSize() const { return usedSize; }
   [[nodiscard]] size_t getAllocationCount() const { return allocatedObjects.size(); }
+  [[nodiscard]] size_t getBlockCount() const { return memoryBlocks.size(); }
+  [[nodiscard]] size_t getBlockSize() const { return blockSize; }
 #ifndef NDEBUG
   void printAllocatedClassStatistic() const {
     std::vector<std::pair<const char *, size_t>> elements(allocatedClassStatistic.begin(), allocatedClassStatistic.end());
@@ -76,6 +80,7 @@ private:
 #endif
   size_t blockSize;
   size_t offsetInBlock = 0;
+  size_t usedSize = 0; // Bytes occupied by objects, excluding the unused tails of the blocks
 
   // Private methods
   void allocateNewBlock() {
@@ -87,6 +87,17 @@ std::string CommonUtil::formatBytes(const size_t bytes) {
   return {buffer};
 }
 
+/**
+ * Return the given duration in milliseconds with microsecond precision
+ *
+ * @return Human-readable duration string
+ */
+std::string CommonUtil::formatDuration(const uint64_t nanoseconds) {
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.3f ms", static_cast<double>(nanoseconds) / 1'000'000.0);
+  return {buffer};
+}
+
 /**
  * Demangle CXX type name
  *
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 #include <Token.h>
@@ -23,6 +24,7 @@ public:
   static std::string trim(const std::string &input);
   static std::vector<std::string> split(const std::string &input);
   static std::string formatBytes(size_t bytes);
+  static std::string formatDuration(uint64_t nanoseconds);
   static std::string demangleTypeName(const char *mangledName);
   static bool isValidMangledName(const std::string &mangledName);
   static int getCurrentYear();
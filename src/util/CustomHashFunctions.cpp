@@ -35,7 +35,8 @@ size_t hash<spice::compiler::TypeChainElement>::operator()(const spice::compiler
   hashCombine64(hash, tce.typeId);
 
   switch (tce.superType) {
-  case TY_ARRAY:
+  case TY_ARRAY: // fall-through
+  case TY_VECTOR:
     hashCombine64(hash, tce.data.arraySize);
     break;
   case TY_FUNCTION:
@@ -0,0 +1,39 @@
+// Copyright (c) 2021-2026 ChilliBits. All rights reserved.
+
+#pragma once
+
+#include <optional>
+
+namespace spice::compiler {
+
+/**
+ * Lazily computed value, that is owned by another object.
+ * Copies of the owning object start with an empty memo, because the inputs of the computation can be changed on the copy.
+ */
+template <typename T> class Memoized {
+public:
+  // Constructors
+  Memoized() = default;
+  Memoized(const Memoized & /*other*/) {}
+  Memoized(Memoized &&) noexcept = default;
+  Memoized &operator=(const Memoized &other) {
+    if (this != &other)
+      reset();
+    return *this;
+  }
+  Memoized &operator=(Memoized &&) noexcept = default;
+
+  // Public methods
+  template <typename Fct> const T &get(Fct &&compute) const {
+    if (!value.has_value())
+      value = compute();
+    return *value;
+  }
+  void reset() const { value.reset(); }
+
+private:
+  // Private members
+  mutable std::optional<T> value;
+};
+
+} // namespace spice::compiler
\ No newline at end of file
@@ -3,18 +3,22 @@
 #include "SystemUtil.h"
 
 #include <array>
+#include <fstream>
 #include <iostream> // IWYU pragma: keep (usage in Windows-only code)
 #include <vector>
 #if OS_UNIX
 #include <spawn.h>
+#include <sys/resource.h>
 #include <sys/wait.h>
 #include <unistd.h>
 #if OS_MACOS
+#include <mach/mach.h>
 extern char **environ;
 #endif
 #elif OS_WINDOWS
 #include <process.h>
 #include <windows.h>
+#include <psapi.h>
 #else
 #error "Unsupported platform"
 #endif
@@ -287,6 +291,88 @@ size_t SystemUtil::getSystemPageSize() {
 #endif
 }
 
+/**
+ * Get the current resident set size of the current process, which is the amount of physical memory, that the process
+ * occupies right now.
+ *
+ * @return Resident set size in bytes, 0 if not supported on this platform
+ */
+size_t SystemUtil::getResidentSetSize() {
+#if OS_LINUX
+  std::ifstream statusFile("/proc/self/status");
+  std::string line;
+  while (std::getline(statusFile, line))
+    if (line.starts_with("VmRSS:"))
+      return std::stoull(line.substr(6)) * 1024; // The value is given in KB
+  return 0; // GCOV_EXCL_LINE
+#elif OS_MACOS
+  mach_task_basic_info info{};
+  mach_msg_type_number_t infoCount = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &infoCount) != KERN_SUCCESS)
+    return 0;
+  return static_cast<size_t>(info.resident_size);
+#elif OS_WINDOWS
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    return 0; // GCOV_EXCL_LINE
+  return counters.WorkingSetSize;
+#else
+  return 0;
+#endif
+}
+
+/**
+ * Get the peak resident set size of the current process, which is the maximum amount of physical memory, that the
+ * process occupied so far. On Linux, the value can be reset with resetPeakResidentSetSize().
+ *
+ * @return Peak resident set size in bytes
+ */
+size_t SystemUtil::getPeakResidentSetSize() {
+#if OS_LINUX
+  // VmHWM honors resets via /proc/self/clear_refs, whereas ru_maxrss never decreases
+  std::ifstream statusFile("/proc/self/status");
+  std::string line;
+  while (std::getline(statusFile, line))
+    if (line.starts_with("VmHWM:"))
+      return std::stoull(line.substr(6)) * 1024; // The value is given in KB
+#endif
+#if OS_UNIX
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+#if OS_MACOS
+  return static_cast<size_t>(usage.ru_maxrss); // Bytes on macOS
+#else
+  return static_cast<size_t>(usage.ru_maxrss) * 1024; // KB on Linux
+#endif
+#elif OS_WINDOWS
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    return 0; // GCOV_EXCL_LINE
+  return counters.PeakWorkingSetSize;
+#else
+#error "Unsupported platform"
+#endif
+}
+
+/**
+ * Reset the peak resident set size of the current process to its current resident set size. This allows to measure the
+ * peak of a single phase, e.g. of a compile stage. Only supported on Linux.
+ *
+ * @return Reset successful or not
+ */
+bool SystemUtil::resetPeakResidentSetSize() {
+#if OS_LINUX
+  std::ofstream clearRefsFile("/proc/self/clear_refs");
+  if (!clearRefsFile)
+    return false; // GCOV_EXCL_LINE
+  clearRefsFile << "5"; // Reset the peak resident set size
+  clearRefsFile.flush();
+  return clearRefsFile.good();
+#else
+  return false;
+#endif
+}
+
 /**
  * Transform pclose status to process exit code.
  * The implementation is OS dependent.
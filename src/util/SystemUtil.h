@@ -35,6 +35,9 @@ public:
   static std::filesystem::path getBootstrapDir();
   static std::filesystem::path getSpiceBinDir();
   static size_t getSystemPageSize();
+  static size_t getResidentSetSize();
+  static size_t getPeakResidentSetSize();
+  static bool resetPeakResidentSetSize();
   static int transformStatusToExitCode(int status);
 };
 
@@ -3,11 +3,19 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 
 namespace spice::compiler {
 
+/**
+ * Monotonic stopwatch with nanosecond resolution.
+ * If a timer output is given, the measured durations are accumulated there in nanoseconds.
+ */
 class Timer {
 public:
+  // Type aliases
+  using Clock = std::chrono::steady_clock;
+
   // Constructors
   explicit Timer(uint64_t *const timerOutput = nullptr) : timerOutput(timerOutput) {}
 
@@ -20,12 +28,22 @@ public:
 
   void stop() { pause(); }
 
-  void resume() { timeStart = std::chrono::high_resolution_clock::now(); }
+  void resume() { timeStart = Clock::now(); }
 
   void pause() {
-    timeStop = std::chrono::high_resolution_clock::now();
+    timeStop = Clock::now();
     if (timerOutput)
-      *timerOutput += getDurationMilliseconds();
+      *timerOutput += getDurationNanoseconds();
+  }
+
+  [[nodiscard]] uint64_t getDurationNanoseconds() const {
+    const auto duration = timeStop - timeStart;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+  }
+
+  [[nodiscard]] uint64_t getDurationMicroseconds() const {
+    const auto duration = timeStop - timeStart;
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
   }
 
   [[nodiscard]] uint64_t getDurationMilliseconds() const {
@@ -35,8 +53,8 @@ public:
 
 private:
   uint64_t *const timerOutput;
-  std::chrono::time_point<std::chrono::high_resolution_clock> timeStart;
-  std::chrono::time_point<std::chrono::high_resolution_clock> timeStop;
+  Clock::time_point timeStart;
+  Clock::time_point timeStop;
 };
 
 } // namespace spice::compiler
\ No newline at end of file
@@ -102,12 +102,15 @@ static void execTestCase(const TestCase &testCase) {
       /* ignoreCache */ true,
       /* llvmArgs= */ "",
       /* printDebugOutput= */ false,
+      /* timeTrace= */ false,
+      /* timeTraceGranularity= */ 50,
       CliOptions::DumpSettings{
           /* dumpCST= */ false,
           /* dumpAST= */ false,
           /* dumpSymbolTables= */ false,
           /* dumpTypes= */ false,
           /* dumpCacheStats= */ false,
+          /* dumpMemoryStats= */ false,
           /* dumpDependencyGraph= */ false,
           /* dumpIR= */ false,
           /* dumpAssembly= */ false,
@@ -118,14 +121,21 @@ static void execTestCase(const TestCase &testCase) {
       /* namesForIRValues= */ true,
       /* useLifetimeMarkers= */ false,
       /* useTBAAMetadata */ false,
+      /* useRefParamAttrs= */ false,
+      /* devirtualize= */ false,
+      /* directLambdaCalls= */ false,
       /* optLevel= */ OptLevel::O0,
       /* useLTO= */ false,
       /* backend= */ Backend::LLVM,
-      /* noEntryFct= */ exists(testCase.testPath / CTL_RUN_BUILTIN_TESTS),
+      /* noEntryFct= */ exists(testCase.testPath / CTL_RUN_BUILTIN_TESTS) || exists(testCase.testPath / CTL_RUN_BENCHMARKS),
       /* generateTestMain= */ exists(testCase.testPath / CTL_RUN_BUILTIN_TESTS),
+      /* generateBenchMain= */ exists(testCase.testPath / CTL_RUN_BENCHMARKS),
       /* staticLinking= */ false,
       CliOptions::InstrumentationSettings{
           /* generateDebugInfo= */ false,
+          /* debugInfoLineTablesOnly= */ false,
+          /* splitDwarf= */ false,
+          /* debugTypeUnits= */ false,
           /* sanitizer= */ Sanitizer::NONE,
       },
       /* disableVerifier= */ false,
@@ -133,13 +143,13 @@ static void execTestCase(const TestCase &testCase) {
       /* comparableOutput= */ true,
       /* buildVars= */ {},
   };
-  static_assert(sizeof(CliOptions::DumpSettings) == 11, "CliOptions::DumpSettings struct size changed");
-  static_assert(sizeof(CliOptions::InstrumentationSettings) == 2, "CliOptions::InstrumentationSettings struct size changed");
+  static_assert(sizeof(CliOptions::DumpSettings) == 12, "CliOptions::DumpSettings struct size changed");
+  static_assert(sizeof(CliOptions::InstrumentationSettings) == 5, "CliOptions::InstrumentationSettings struct size changed");
 #if defined(__clang__) && defined(__apple_build_version__)
   // some std types for Apple Clang are smaller than for GCC and Clang
-  static_assert(sizeof(CliOptions) == 312, "CliOptions struct size changed");
+  static_assert(sizeof(CliOptions) == 320, "CliOptions struct size changed");
 #else
-  static_assert(sizeof(CliOptions) == 440, "CliOptions struct size changed");
+  static_assert(sizeof(CliOptions) == 448, "CliOptions struct size changed");
 #endif
 
   // Parse test args
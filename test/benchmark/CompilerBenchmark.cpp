@@ -0,0 +1,241 @@
+// Copyright (c) 2021-2026 ChilliBits. All rights reserved.
+
+#include "CompilerBenchmark.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <ranges>
+
+#include <driver/Driver.h>
+#include <global/GlobalResourceManager.h>
+#include <global/TypeRegistry.h>
+#include <util/CommonUtil.h>
+#include <util/SystemUtil.h>
+
+// GCOV_EXCL_START
+namespace spice::testing {
+
+using namespace spice::compiler;
+
+namespace {
+
+// Compile stages in pipeline order, as recorded in the timer output of each source file
+using StageTimer = uint64_t TimerOutput::*;
+constexpr std::array<std::pair<const char *, StageTimer>, 13> STAGES = {{
+    {"lexer", &TimerOutput::lexer},
+    {"parser", &TimerOutput::parser},
+    {"cstVisualizer", &TimerOutput::cstVisualizer},
+    {"astBuilder", &TimerOutput::astBuilder},
+    {"astVisualizer", &TimerOutput::astVisualizer},
+    {"importCollector", &TimerOutput::importCollector},
+    {"symbolTableBuilder", &TimerOutput::symbolTableBuilder},
+    {"typeCheckerPre", &TimerOutput::typeCheckerPre},
+    {"typeCheckerPost", &TimerOutput::typeCheckerPost},
+    {"depGraphVisualizer", &TimerOutput::depGraphVisualizer},
+    {"irGenerator", &TimerOutput::irGenerator},
+    {"irOptimizer", &TimerOutput::irOptimizer},
+    {"objectEmitter", &TimerOutput::objectEmitter},
+}};
+
+template <typename T> T getMedian(std::vector<T> values) {
+  assert(!values.empty());
+  std::ranges::sort(values);
+  return values.at(values.size() / 2);
+}
+
+} // namespace
+
+CompilerBenchmark::CompilerBenchmark(std::filesystem::path artifactDir, std::vector<std::string> compilerArgs,
+                                     unsigned int repetitions)
+    : artifactDir(std::move(artifactDir)), compilerArgs(std::move(compilerArgs)), repetitions(std::max(repetitions, 1u)) {}
+
+/**
+ * Compile all given projects and collect the results in a report
+ *
+ * @param projects Projects to compile
+ * @return Benchmark report
+ */
+nlohmann::json CompilerBenchmark::run(const std::vector<CorpusProject> &projects) const {
+  nlohmann::json report;
+  report["version"] = 1;
+  report["compilerArgs"] = compilerArgs;
+  report["repetitions"] = repetitions;
+  // Without a resettable peak, the peak RSS of a project includes the memory of all projects, that were compiled before
+  report["peakRssPerProject"] = SystemUtil::resetPeakResidentSetSize();
+  report["projects"] = nlohmann::json::array();
+
+  for (const CorpusProject &project : projects) {
+    std::cerr << "Compiling " << project.name << " " << repetitions << " time(s) ..." << std::endl;
+    std::vector<CompilationMeasurement> measurements;
+    measurements.reserve(repetitions);
+    for (unsigned int i = 0; i < repetitions; i++) {
+      measurements.push_back(compile(project));
+      if (!measurements.back().succeeded)
+        break;
+    }
+    report["projects"].push_back(summarize(project, measurements));
+  }
+  return report;
+}
+
+/**
+ * Compare the projects of a report with the equally named projects of a baseline report. Projects, that are not contained
+ * in the baseline, are skipped. The regressions are printed to stderr.
+ *
+ * @param report Current report
+ * @param baseline Baseline report
+ * @param maxRegressionPercent Tolerated increase of the median compile time and the peak RSS in percent
+ * @return True if no regression was found
+ */
+bool CompilerBenchmark::compareToBaseline(const nlohmann::json &report, const nlohmann::json &baseline,
+                                          double maxRegressionPercent) {
+  const double maxFactor = 1.0 + maxRegressionPercent / 100.0;
+  bool withinLimits = true;
+
+  const auto check = [&](const std::string &projectName, const char *metric, uint64_t baselineValue, uint64_t value) {
+    const double factor = baselineValue > 0 ? static_cast<double>(value) / static_cast<double>(baselineValue) : 1.0;
+    if (factor <= maxFactor)
+      return;
+    withinLimits = false;
+    std::cerr << "Regression in " << projectName << ": " << metric << " went up by " << (factor - 1.0) * 100.0;
+    std::cerr << "% (" << baselineValue << " -> " << value << ")" << std::endl;
+  };
+
+  const nlohmann::json &baselineProjects = baseline.at("projects");
+  for (const nlohmann::json &project : report.at("projects")) {
+    const std::string name = project.at("name").get<std::string>();
+    const auto baselineProject = std::find_if(baselineProjects.begin(), baselineProjects.end(),
+                                              [&](const nlohmann::json &candidate) { return candidate.at("name") == name; });
+    if (baselineProject == baselineProjects.end() || !baselineProject->at("succeeded").get<bool>())
+      continue;
+
+    // Failing to compile a project, that compiled before, is the worst regression
+    if (!project.at("succeeded").get<bool>()) {
+      withinLimits = false;
+      std::cerr << "Regression in " << name << ": the project does not compile anymore" << std::endl;
+      continue;
+    }
+
+    const auto getMedianNanos = [](const nlohmann::json &json) { return json.at("totalNanos").at("median").get<uint64_t>(); };
+    const auto getPeakRss = [](const nlohmann::json &json) { return json.at("peakRssBytes").get<uint64_t>(); };
+    check(name, "median compile time", getMedianNanos(*baselineProject), getMedianNanos(project));
+    check(name, "peak RSS", getPeakRss(*baselineProject), getPeakRss(project));
+  }
+  return withinLimits;
+}
+
+CompilationMeasurement CompilerBenchmark::compile(const CorpusProject &project) const {
+  CompilationMeasurement measurement;
+
+  // Let the driver prepare the cli options, like 'spice build' would do
+  std::vector<std::string> args = {"spice", "build", "--ignore-cache"};
+  args.insert(args.end(), compilerArgs.begin(), compilerArgs.end());
+  args.push_back(project.mainSourceFile.string());
+  std::vector<const char *> argv;
+  argv.reserve(args.size());
+  for (const std::string &arg : args)
+    argv.push_back(arg.c_str());
+  CliOptions cliOptions;
+  Driver driver(cliOptions, true);
+  if (driver.parse(static_cast<int>(argv.size()), argv.data()) != EXIT_SUCCESS) {
+    measurement.errorMessage = "Invalid compiler arguments";
+    return measurement;
+  }
+  driver.enrich();
+
+  // Keep the build artifacts of the projects apart
+  cliOptions.outputDir = artifactDir / project.name;
+  cliOptions.outputPath = cliOptions.outputDir / project.mainSourceFile.stem();
+  cliOptions.cacheDir = cliOptions.outputDir / "cache";
+  std::filesystem::create_directories(cliOptions.cacheDir);
+
+  SystemUtil::resetPeakResidentSetSize();
+  try {
+    GlobalResourceManager resourceManager(cliOptions);
+    SourceFile *mainSourceFile = resourceManager.createSourceFile(nullptr, MAIN_FILE_NAME, cliOptions.mainSourceFile, false);
+
+    // Run the compile pipeline. Linking is left out, because it is not done by the compiler itself
+    mainSourceFile->runFrontEnd();
+    if (!resourceManager.abortCompilation)
+      mainSourceFile->runMiddleEnd();
+    if (!resourceManager.abortCompilation)
+      mainSourceFile->runBackEnd();
+    measurement.peakRssBytes = SystemUtil::getPeakResidentSetSize();
+    if (resourceManager.abortCompilation) {
+      measurement.errorMessage = "Compilation was aborted";
+      return measurement;
+    }
+
+    // Collect the statistics, before the resource manager is destroyed
+    measurement.totalNanos = resourceManager.totalTimer.getDurationNanoseconds();
+    for (const std::unique_ptr<SourceFile> &sourceFile : resourceManager.sourceFiles | std::views::values)
+      for (const StageTimer stageTimer : STAGES | std::views::values)
+        measurement.stageNanos.*stageTimer += sourceFile->compilerOutput.times.*stageTimer;
+    measurement.sourceFileCount = resourceManager.sourceFiles.size();
+    measurement.lineCount = resourceManager.getTotalLineCount();
+    measurement.typeCount = TypeRegistry::getTypeCount();
+    const BlockAllocator<ASTNode> &astNodeAlloc = resourceManager.astNodeAlloc;
+    measurement.astNodeAlloc.blockCount = astNodeAlloc.getBlockCount();
+    measurement.astNodeAlloc.blockSize = astNodeAlloc.getBlockSize();
+    measurement.astNodeAlloc.reservedBytes = astNodeAlloc.getTotalAllocatedSize();
+    measurement.astNodeAlloc.usedBytes = astNodeAlloc.getUsedSize();
+    measurement.astNodeAlloc.allocationCount = astNodeAlloc.getAllocationCount();
+    measurement.succeeded = true;
+  } catch (std::exception &error) {
+    measurement.peakRssBytes = SystemUtil::getPeakResidentSetSize();
+    measurement.errorMessage = error.what();
+  }
+  return measurement;
+}
+
+nlohmann::json CompilerBenchmark::summarize(const CorpusProject &project,
+                                            const std::vector<CompilationMeasurement> &measurements) const {
+  nlohmann::json summary;
+  summary["name"] = project.name;
+
+  // Report the first failure, as no timings of the project are meaningful then
+  const CompilationMeasurement &last = measurements.back();
+  summary["succeeded"] = last.succeeded;
+  if (!last.succeeded) {
+    std::cerr << "Compiling " << project.name << " failed:\n" << last.errorMessage << std::endl;
+    summary["error"] = last.errorMessage;
+    return summary;
+  }
+
+  summary["sourceFiles"] = last.sourceFileCount;
+  summary["lines"] = last.lineCount;
+  summary["types"] = last.typeCount;
+
+  // The median is robust against single slow runs, e.g. caused by a cold file system cache
+  std::vector<uint64_t> totalNanos;
+  for (const CompilationMeasurement &measurement : measurements)
+    totalNanos.push_back(measurement.totalNanos);
+  summary["totalNanos"]["min"] = std::ranges::min(totalNanos);
+  summary["totalNanos"]["median"] = getMedian(totalNanos);
+  summary["totalNanos"]["max"] = std::ranges::max(totalNanos);
+  for (const auto &[stageName, stageTimer] : STAGES) {
+    std::vector<uint64_t> stageNanos;
+    for (const CompilationMeasurement &measurement : measurements)
+      stageNanos.push_back(measurement.stageNanos.*stageTimer);
+    summary["stageNanos"][stageName] = getMedian(stageNanos);
+  }
+
+  const size_t peakRss = std::ranges::max(measurements | std::views::transform(&CompilationMeasurement::peakRssBytes));
+  summary["peakRssBytes"] = peakRss;
+  summary["astNodeAllocator"] = {
+      {"blocks", last.astNodeAlloc.blockCount},
+      {"blockSize", last.astNodeAlloc.blockSize},
+      {"reservedBytes", last.astNodeAlloc.reservedBytes},
+      {"usedBytes", last.astNodeAlloc.usedBytes},
+      {"allocations", last.astNodeAlloc.allocationCount},
+  };
+
+  std::cerr << "  median " << CommonUtil::formatDuration(getMedian(totalNanos)) << ", peak RSS ";
+  std::cerr << CommonUtil::formatBytes(peakRss) << std::endl;
+  return summary;
+}
+
+} // namespace spice::testing
+// GCOV_EXCL_STOP
\ No newline at end of file
@@ -0,0 +1,68 @@
+// Copyright (c) 2021-2026 ChilliBits. All rights reserved.
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <SourceFile.h>
+
+#include <nlohmann/json.hpp>
+
+// GCOV_EXCL_START
+namespace spice::testing {
+
+struct CorpusProject {
+  std::string name;
+  std::filesystem::path mainSourceFile;
+};
+
+struct AllocatorStats {
+  size_t blockCount = 0;
+  size_t blockSize = 0;
+  size_t reservedBytes = 0;
+  size_t usedBytes = 0;
+  size_t allocationCount = 0;
+};
+
+struct CompilationMeasurement {
+  bool succeeded = false;
+  std::string errorMessage;
+  uint64_t totalNanos = 0;
+  compiler::TimerOutput stageNanos; // Summed up over all source files
+  size_t peakRssBytes = 0;
+  size_t sourceFileCount = 0;
+  size_t lineCount = 0;
+  size_t typeCount = 0;
+  AllocatorStats astNodeAlloc;
+};
+
+/**
+ * Compiles the projects of the benchmark corpus multiple times and reports the per-stage timings, the peak resident set
+ * size and the statistics of the AST node allocator as JSON. Reports can be compared against a baseline report to catch
+ * compile time and memory regressions.
+ */
+class CompilerBenchmark {
+public:
+  // Constructors
+  CompilerBenchmark(std::filesystem::path artifactDir, std::vector<std::string> compilerArgs, unsigned int repetitions);
+
+  // Public methods
+  [[nodiscard]] nlohmann::json run(const std::vector<CorpusProject> &projects) const;
+  static bool compareToBaseline(const nlohmann::json &report, const nlohmann::json &baseline, double maxRegressionPercent);
+
+private:
+  // Private members
+  std::filesystem::path artifactDir;
+  std::vector<std::string> compilerArgs;
+  unsigned int repetitions;
+
+  // Private methods
+  [[nodiscard]] CompilationMeasurement compile(const CorpusProject &project) const;
+  [[nodiscard]] nlohmann::json summarize(const CorpusProject &project,
+                                         const std::vector<CompilationMeasurement> &measurements) const;
+};
+
+} // namespace spice::testing
+// GCOV_EXCL_STOP
\ No newline at end of file
@@ -0,0 +1,243 @@
+// Copyright (c) 2021-2026 ChilliBits. All rights reserved.
+
+#include "CorpusGenerator.h"
+
+#include <array>
+#include <set>
+#include <sstream>
+
+#include <util/FileUtil.h>
+#include <util/SystemUtil.h>
+
+// GCOV_EXCL_START
+namespace spice::testing {
+
+using namespace spice::compiler;
+
+CorpusGenerator::CorpusGenerator(std::filesystem::path corpusDir, unsigned int scale)
+    : corpusDir(std::move(corpusDir)), scale(std::max(scale, 1u)) {}
+
+/**
+ * Generate a project, that imports every module of the standard library, which is available for the given target.
+ * Runtime modules and bindings to third-party libraries are left out.
+ *
+ * @param osName OS name, as used in the file names of OS-specific modules
+ * @param archName Arch name, as used in the file names of OS- and arch-specific modules
+ * @return Path to the main source file
+ */
+std::filesystem::path CorpusGenerator::generateStdProject(const std::string &osName, const std::string &archName) const {
+  const std::filesystem::path stdDir = SystemUtil::getStdDir();
+
+  // Collect the import paths of all modules. OS- and arch-specific files share the import path of the generic module
+  std::set<std::string> importPaths;
+  for (const std::filesystem::directory_entry &entry : std::filesystem::recursive_directory_iterator(stdDir)) {
+    if (!entry.is_regular_file() || entry.path().extension() != ".spice")
+      continue;
+    const std::filesystem::path relativePath = relative(entry.path(), stdDir);
+    const std::string topLevelDir = relativePath.begin()->string();
+    if (topLevelDir == "runtime" || topLevelDir == "bindings")
+      continue;
+    std::string moduleName = relativePath.stem().string();
+    moduleName = moduleName.substr(0, moduleName.find('_'));
+    const std::filesystem::path basePath = entry.path().parent_path() / moduleName;
+
+    // Skip modules, that only exist for other targets
+    const auto existsWithSuffix = [&](const std::string &suffix) {
+      return exists(std::filesystem::path(basePath.string() + suffix + ".spice"));
+    };
+    if (!existsWithSuffix("") && !existsWithSuffix("_" + osName) && !existsWithSuffix("_" + osName + "_" + archName))
+      continue;
+
+    importPaths.insert("std/" + (relativePath.parent_path() / moduleName).generic_string());
+  }
+
+  // Import every module under its own alias to rule out name collisions
+  std::stringstream mainFile;
+  unsigned int moduleIdx = 0;
+  for (const std::string &importPath : importPaths)
+    mainFile << "import \"" << importPath << "\" as m" << moduleIdx++ << ";\n";
+  mainFile << "\nf<int> main() {\n    printf(\"Imported " << importPaths.size() << " modules\\n\");\n}";
+
+  const std::filesystem::path mainFilePath = prepareProjectDir("std") / "main.spice";
+  FileUtil::writeToFile(mainFilePath, mainFile.str());
+  return mainFilePath;
+}
+
+/**
+ * Generate a project with lots of small modules. The modules form a binary tree of imports and the main file imports
+ * all of them.
+ *
+ * @return Path to the main source file
+ */
+std::filesystem::path CorpusGenerator::generateManyFilesProject() const {
+  const std::filesystem::path projectDir = prepareProjectDir("many-files");
+  const unsigned int moduleCount = MANY_FILES_MODULE_COUNT * scale;
+
+  for (unsigned int i = 0; i < moduleCount; i++) {
+    const unsigned int parentIdx = i > 0 ? (i - 1) / 2 : 0;
+    std::stringstream module;
+    if (i > 0)
+      module << "import \"module_" << parentIdx << "\";\n\n";
+    module << "public type Struct" << i << " struct {\n";
+    module << "    int value\n";
+    module << "    long total\n";
+    module << "}\n\n";
+    module << "public p Struct" << i << ".ctor(int value) {\n";
+    module << "    this.value = value;\n";
+    module << "    this.total = 0l;\n";
+    module << "}\n\n";
+    module << "public f<long> Struct" << i << ".accumulate(int count) {\n";
+    module << "    for int j = 0; j < count; j++ {\n";
+    module << "        this.total += cast<long>(this.value * j);\n";
+    module << "    }\n";
+    module << "    return this.total;\n";
+    module << "}\n\n";
+    module << "public f<int> compute" << i << "(int input) {\n";
+    module << "    Struct" << i << " s = Struct" << i << "(input);\n";
+    module << "    const int local = cast<int>(s.accumulate(" << i % 16 + 1 << "));\n";
+    if (i > 0)
+      module << "    return local + compute" << parentIdx << "(input - 1);\n";
+    else
+      module << "    return local;\n";
+    module << "}";
+    FileUtil::writeToFile(projectDir / ("module_" + std::to_string(i) + ".spice"), module.str());
+  }
+
+  std::stringstream mainFile;
+  for (unsigned int i = 0; i < moduleCount; i++)
+    mainFile << "import \"module_" << i << "\";\n";
+  mainFile << "\nf<int> main() {\n";
+  mainFile << "    int result = 0;\n";
+  for (unsigned int i = 0; i < moduleCount; i++)
+    mainFile << "    result += compute" << i << "(" << i << ");\n";
+  mainFile << "    printf(\"Result: %d\\n\", result);\n";
+  mainFile << "}";
+
+  const std::filesystem::path mainFilePath = projectDir / "main.spice";
+  FileUtil::writeToFile(mainFilePath, mainFile.str());
+  return mainFilePath;
+}
+
+/**
+ * Generate a project, that substantiates generic structs and functions with lots of different types, including
+ * generic types from the standard library.
+ *
+ * @return Path to the main source file
+ */
+std::filesystem::path CorpusGenerator::generateManyGenericsProject() const {
+  const unsigned int typeCount = MANY_GENERICS_TYPE_COUNT * scale;
+
+  std::stringstream mainFile;
+  mainFile << "import \"std/data/vector\";\n";
+  mainFile << "import \"std/data/pair\";\n\n";
+  mainFile << "type T dyn;\n\n";
+  mainFile << "type Box<T> struct {\n";
+  mainFile << "    T value\n";
+  mainFile << "    unsigned long accessCount = 0l\n";
+  mainFile << "}\n\n";
+  mainFile << "p Box.ctor(const T& value) {\n";
+  mainFile << "    this.value = value;\n";
+  mainFile << "}\n\n";
+  mainFile << "f<T> Box.get() {\n";
+  mainFile << "    this.accessCount++;\n";
+  mainFile << "    return this.value;\n";
+  mainFile << "}\n\n";
+  mainFile << "f<T> roundTrip<T>(const T& value) {\n";
+  mainFile << "    Box<T> box = Box<T>(value);\n";
+  mainFile << "    Vector<Box<T>> boxes;\n";
+  mainFile << "    boxes.pushBack(box);\n";
+  mainFile << "    Pair<T, int> pair = Pair<T, int>(boxes.get(0l).get(), 1);\n";
+  mainFile << "    return pair.getFirst();\n";
+  mainFile << "}\n\n";
+  for (unsigned int i = 0; i < typeCount; i++) {
+    mainFile << "type Item" << i << " struct {\n";
+    mainFile << "    int id\n";
+    mainFile << "    long weight\n";
+    mainFile << "}\n\n";
+  }
+
+  mainFile << "f<int> main() {\n";
+  mainFile << "    int checksum = 0;\n";
+  // Substantiate with primitive types first
+  static constexpr std::array PRIMITIVE_TYPES = {"int", "long", "short", "double", "byte", "char", "bool", "string"};
+  static constexpr std::array PRIMITIVE_VALUES = {"1", "2l", "3s", "4.0", "cast<byte>(5)", "'6'", "true", "\"7\""};
+  for (size_t i = 0; i < PRIMITIVE_TYPES.size(); i++)
+    mainFile << "    " << PRIMITIVE_TYPES[i] << " _primitive" << i << " = roundTrip(" << PRIMITIVE_VALUES[i] << ");\n";
+  for (unsigned int i = 0; i < typeCount; i++) {
+    mainFile << "    Item" << i << " input" << i << " = Item" << i << "{" << i << ", " << i * 3 << "l};\n";
+    mainFile << "    Item" << i << " item" << i << " = roundTrip(input" << i << ");\n";
+    mainFile << "    checksum += item" << i << ".id;\n";
+  }
+  mainFile << "    printf(\"Checksum: %d\\n\", checksum);\n";
+  mainFile << "}";
+
+  const std::filesystem::path mainFilePath = prepareProjectDir("many-generics") / "main.spice";
+  FileUtil::writeToFile(mainFilePath, mainFile.str());
+  return mainFilePath;
+}
+
+/**
+ * Generate a project with deeply nested expressions and very long operator chains
+ *
+ * @return Path to the main source file
+ */
+std::filesystem::path CorpusGenerator::generateDeepExpressionsProject() const {
+  const unsigned int fctCount = DEEP_EXPRESSION_FCT_COUNT * scale;
+  const unsigned int termCount = LONG_CHAIN_TERM_COUNT * scale;
+
+  std::stringstream mainFile;
+  for (unsigned int i = 0; i < fctCount; i++) {
+    mainFile << "f<int> nested" << i << "(int a, int b) {\n";
+    mainFile << "    return " << generateNestedExpression(DEEP_EXPRESSION_DEPTH, i) << ";\n";
+    mainFile << "}\n\n";
+  }
+
+  // Long chains of operators with the same and with mixed precedence
+  mainFile << "f<int> additiveChain(int a, int b) {\n    return a";
+  for (unsigned int i = 1; i < termCount; i++)
+    mainFile << (i % 2 == 0 ? " + " : " - ") << (i % 3 == 0 ? "b" : "a");
+  mainFile << ";\n}\n\n";
+  mainFile << "f<int> mixedChain(int a, int b) {\n    return a * b";
+  for (unsigned int i = 1; i < termCount; i++)
+    mainFile << (i % 2 == 0 ? " + a * " : " - b * ") << i % 7 + 1;
+  mainFile << ";\n}\n\n";
+  mainFile << "f<bool> logicalChain(int a, int b) {\n    return a < b";
+  for (unsigned int i = 1; i < termCount; i++)
+    mainFile << (i % 2 == 0 ? " && a != " : " || b >= ") << i;
+  mainFile << ";\n}\n\n";
+
+  mainFile << "f<int> main() {\n";
+  mainFile << "    int result = additiveChain(1, 2) + mixedChain(3, 4);\n";
+  mainFile << "    if logicalChain(5, 6) { result++; }\n";
+  for (unsigned int i = 0; i < fctCount; i++)
+    mainFile << "    result += nested" << i << "(" << i << ", " << i + 1 << ");\n";
+  mainFile << "    printf(\"Result: %d\\n\", result);\n";
+  mainFile << "}";
+
+  const std::filesystem::path mainFilePath = prepareProjectDir("deep-expressions") / "main.spice";
+  FileUtil::writeToFile(mainFilePath, mainFile.str());
+  return mainFilePath;
+}
+
+std::filesystem::path CorpusGenerator::prepareProjectDir(const std::string &projectName) const {
+  const std::filesystem::path projectDir = corpusDir / projectName;
+  std::filesystem::remove_all(projectDir);
+  std::filesystem::create_directories(projectDir);
+  return projectDir;
+}
+
+std::string CorpusGenerator::generateNestedExpression(unsigned int depth, unsigned int seed) {
+  static constexpr std::array OPERATORS = {" + ", " - ", " * ", " & ", " | ", " ^ "};
+  static constexpr std::array OPERANDS = {"a", "b", "3", "(a - b)", "7"};
+
+  // Nest to the left, so that every level adds a pair of parentheses
+  std::string expression = OPERANDS[seed % OPERANDS.size()];
+  for (unsigned int level = 0; level < depth; level++) {
+    const unsigned int mixedLevel = level + seed;
+    expression = "(" + expression + OPERATORS[mixedLevel % OPERATORS.size()] + OPERANDS[mixedLevel % OPERANDS.size()] + ")";
+  }
+  return expression;
+}
+
+} // namespace spice::testing
+// GCOV_EXCL_STOP
\ No newline at end of file
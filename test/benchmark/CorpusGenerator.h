@@ -0,0 +1,47 @@
+// Copyright (c) 2021-2026 ChilliBits. All rights reserved.
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+
+// GCOV_EXCL_START
+namespace spice::testing {
+
+// Constants
+static constexpr unsigned int MANY_FILES_MODULE_COUNT = 200;
+static constexpr unsigned int MANY_GENERICS_TYPE_COUNT = 100;
+static constexpr unsigned int DEEP_EXPRESSION_FCT_COUNT = 50;
+static constexpr unsigned int DEEP_EXPRESSION_DEPTH = 100; // Parenthesis nesting depth, limited by the stack of the parser
+static constexpr unsigned int LONG_CHAIN_TERM_COUNT = 1000;
+
+/**
+ * Generates the synthetic projects of the compiler benchmark corpus. Each project stresses a different part of the compiler:
+ * - many-files: Lots of small modules, that import each other (import collector, name registries, object emitter)
+ * - many-generics: Generic structs and functions, that get substantiated with lots of types (type checker, type registry)
+ * - deep-expressions: Deeply nested and very long expressions (parser, AST builder, expression visitors)
+ * The generated code only depends on the scale factor, so the projects are identical across runs.
+ */
+class CorpusGenerator {
+public:
+  // Constructors
+  CorpusGenerator(std::filesystem::path corpusDir, unsigned int scale);
+
+  // Public methods
+  [[nodiscard]] std::filesystem::path generateStdProject(const std::string &osName, const std::string &archName) const;
+  [[nodiscard]] std::filesystem::path generateManyFilesProject() const;
+  [[nodiscard]] std::filesystem::path generateManyGenericsProject() const;
+  [[nodiscard]] std::filesystem::path generateDeepExpressionsProject() const;
+
+private:
+  // Private members
+  std::filesystem::path corpusDir;
+  unsigned int scale;
+
+  // Private methods
+  [[nodiscard]] std::filesystem::path prepareProjectDir(const std::string &projectName) const;
+  static std::string generateNestedExpression(unsigned int depth, unsigned int seed);
+};
+
+} // namespace spice::testing
+// GCOV_EXCL_STOP
\ No newline at end of file
@@ -0,0 +1,107 @@
+// Copyright (c) 2021-2026 ChilliBits. All rights reserved.
+
+#include <iostream>
+
+#include <util/CommonUtil.h>
+#include <util/FileUtil.h>
+#include <util/SystemUtil.h>
+
+#include "CompilerBenchmark.h"
+#include "CorpusGenerator.h"
+
+#include <CLI/CLI.hpp>
+#include <llvm/TargetParser/Host.h>
+#include <llvm/TargetParser/Triple.h>
+
+// Undef conflicting macros (only problematic on Windows)
+#undef TRUE
+#undef FALSE
+#undef CONST
+
+// GCOV_EXCL_START
+using namespace spice::compiler;
+using namespace spice::testing;
+
+struct BenchmarkCliOptions {
+  std::filesystem::path outputFile;
+  std::filesystem::path baselineFile;
+  std::filesystem::path workDir = std::filesystem::temp_directory_path() / "spice" / "bench";
+  std::vector<std::string> compilerArgs;
+  std::string filter;
+  unsigned int repetitions = 5;
+  unsigned int scale = 1;
+  double maxRegressionPercent = 10.0;
+};
+
+/**
+ * Entry point to the Spice compiler benchmark. It compiles a fixed corpus of projects and reports the per-stage compile
+ * times, the peak memory usage and the allocator statistics as JSON.
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
+ * @return Return code
+ */
+int main(int argc, char **argv) {
+  BenchmarkCliOptions options;
+  CLI::App app{"Spice Compiler Benchmark", "spicebench"};
+  app.allow_non_standard_option_names();
+  app.footer("(c) Marc Auberer 2021-2026");
+  app.set_version_flag("--version,-v", CommonUtil::buildVersionInfo());
+  app.add_option("--output,-o", options.outputFile, "Write the JSON report to this file instead of stdout");
+  app.add_option("--baseline", options.baselineFile, "Compare against this JSON report and fail on regressions");
+  app.add_option("--max-regression", options.maxRegressionPercent, "Tolerated regression against the baseline in percent");
+  app.add_option("--work-dir", options.workDir, "Directory for the generated projects and the build artifacts");
+  app.add_option("--compiler-args", options.compilerArgs, "Additional arguments for 'spice build', e.g. -O2")
+      ->delimiter(' ')
+      ->allow_extra_args(false);
+  app.add_option("--filter", options.filter, "Only compile projects, whose name contains this string");
+  app.add_option("--repetitions,-r", options.repetitions, "Number of compilations per project");
+  app.add_option("--scale", options.scale, "Size factor for the synthetic projects");
+  try {
+    app.parse(argc, argv);
+  } catch (const CLI::ParseError &parseError) {
+    return app.exit(parseError);
+  }
+
+  try {
+    // Assemble the corpus. The synthetic projects are generated from scratch in every run
+    const llvm::Triple triple(llvm::Triple::normalize(llvm::sys::getDefaultTargetTriple()));
+    const std::string osName = triple.getOSTypeName(triple.getOS()).str();
+    const std::string archName = triple.getArchTypeName(triple.getArch()).str();
+    const CorpusGenerator generator(options.workDir / "corpus", options.scale);
+    std::vector<CorpusProject> corpus = {
+        {"std", generator.generateStdProject(osName, archName)},
+        {"bootstrap-compiler", SystemUtil::getBootstrapDir() / "main.spice"},
+        {"many-files", generator.generateManyFilesProject()},
+        {"many-generics", generator.generateManyGenericsProject()},
+        {"deep-expressions", generator.generateDeepExpressionsProject()},
+    };
+    std::erase_if(corpus, [&](const CorpusProject &project) { return !project.name.contains(options.filter); });
+
+    // Run the benchmark
+    const CompilerBenchmark benchmark(options.workDir / "artifacts", options.compilerArgs, options.repetitions);
+    const nlohmann::json report = benchmark.run(corpus);
+    if (options.outputFile.empty())
+      std::cout << report.dump(/*indent=*/2) << std::endl;
+    else
+      FileUtil::writeToFile(options.outputFile, report.dump(/*indent=*/2) + "\n");
+
+    // Fail if a project did not compile
+    for (const nlohmann::json &project : report.at("projects"))
+      if (!project.at("succeeded").get<bool>())
+        return EXIT_FAILURE;
+
+    // Fail on regressions against the baseline
+    if (!options.baselineFile.empty()) {
+      const nlohmann::json baseline = nlohmann::json::parse(FileUtil::getFileContent(options.baselineFile));
+      if (!CompilerBenchmark::compareToBaseline(report, baseline, options.maxRegressionPercent))
+        return EXIT_FAILURE;
+      std::cerr << "No regressions compared to the baseline" << std::endl;
+    }
+    return EXIT_SUCCESS;
+  } catch (std::exception &error) {
+    std::cerr << error.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+}
+// GCOV_EXCL_STOP
\ No newline at end of file
@@ -2,7 +2,7 @@
 source_filename = "source.spice"
 
 %struct.Thread = type { %struct.Lambda, i64 }
-%struct.Lambda = type { { ptr, ptr, i64 }, ptr, i64 }
+%struct.Lambda = type { { ptr, ptr, i64 }, ptr, i64, [3 x i64] }
 
 @printf.str.0 = private unnamed_addr constant [33 x i8] c"Thread returned with result: %d\0A\00", align 4
 @printf.str.2 = private unnamed_addr constant [17 x i8] c"Program finished\00", align 4
@@ -37,48 +37,48 @@ define dso_local noundef i32 @main() local_unnamed_addr #1 {
 for.body.L11:
   %threads = alloca [8 x %struct.Thread], align 8
   %0 = alloca %struct.Thread, align 8
-  %.fca.1.0.0.0.gep = getelementptr inbounds nuw i8, ptr %threads, i64 48
-  %.fca.2.0.0.0.gep = getelementptr inbounds nuw i8, ptr %threads, i64 96
-  %.fca.3.0.0.0.gep = getelementptr inbounds nuw i8, ptr %threads, i64 144
-  %.fca.4.0.0.0.gep = getelementptr inbounds nuw i8, ptr %threads, i64 192
-  %.fca.5.0.0.0.gep = getelementptr inbounds nuw i8, ptr %threads, i64 240
-  %.fca.6.0.0.0.gep = getelementptr inbounds nuw i8, ptr %threads, i64 288
-  %.fca.7.0.0.0.gep = getelementptr inbounds nuw i8, ptr %threads, i64 336
-  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(48) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
-  %1 = getelementptr inbounds nuw i8, ptr %threads, i64 48
-  call void @llvm.memset.p0.i64(ptr noundef nonnull align 8 dereferenceable(336) %1, i8 0, i64 336, i1 false)
-  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(48) %threads, ptr noundef nonnull align 8 dereferenceable(48) %0, i64 48, i1 false)
-  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(48) %threads) #6
-  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(48) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
-  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(48) %.fca.1.0.0.0.gep, ptr noundef nonnull align 8 dereferenceable(48) %0, i64 48, i1 false)
-  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(48) %.fca.1.0.0.0.gep) #6
-  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(48) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
-  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(48) %.fca.2.0.0.0.gep, ptr noundef nonnull align 8 dereferenceable(48) %0, i64 48, i1 false)
-  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(48) %.fca.2.0.0.0.gep) #6
-  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(48) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
-  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(48) %.fca.3.0.0.0.gep, ptr noundef nonnull align 8 dereferenceable(48) %0, i64 48, i1 false)
-  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(48) %.fca.3.0.0.0.gep) #6
-  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(48) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
-  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(48) %.fca.4.0.0.0.gep, ptr noundef nonnull align 8 dereferenceable(48) %0, i64 48, i1 false)
-  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(48) %.fca.4.0.0.0.gep) #6
-  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(48) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
-  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(48) %.fca.5.0.0.0.gep, ptr noundef nonnull align 8 dereferenceable(48) %0, i64 48, i1 false)
-  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(48) %.fca.5.0.0.0.gep) #6
-  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(48) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
-  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(48) %.fca.6.0.0.0.gep, ptr noundef nonnull align 8 dereferenceable(48) %0, i64 48, i1 false)
-  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(48) %.fca.6.0.0.0.gep) #6
-  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(48) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
-  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(48) %.fca.7.0.0.0.gep, ptr noundef nonnull align 8 dereferenceable(48) %0, i64 48, i1 false)
-  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(48) %.fca.7.0.0.0.gep) #6
+  %.fca.1.0.0.0.gep = getelementptr inbounds nuw i8, ptr %threads, i64 72
+  %.fca.2.0.0.0.gep = getelementptr inbounds nuw i8, ptr %threads, i64 144
+  %.fca.3.0.0.0.gep = getelementptr inbounds nuw i8, ptr %threads, i64 216
+  %.fca.4.0.0.0.gep = getelementptr inbounds nuw i8, ptr %threads, i64 288
+  %.fca.5.0.0.0.gep = getelementptr inbounds nuw i8, ptr %threads, i64 360
+  %.fca.6.0.0.0.gep = getelementptr inbounds nuw i8, ptr %threads, i64 432
+  %.fca.7.0.0.0.gep = getelementptr inbounds nuw i8, ptr %threads, i64 504
+  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(72) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
+  %1 = getelementptr inbounds nuw i8, ptr %threads, i64 72
+  call void @llvm.memset.p0.i64(ptr noundef nonnull align 8 dereferenceable(504) %1, i8 0, i64 504, i1 false)
+  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(72) %threads, ptr noundef nonnull align 8 dereferenceable(72) %0, i64 72, i1 false)
+  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(72) %threads) #6
+  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(72) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
+  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(72) %.fca.1.0.0.0.gep, ptr noundef nonnull align 8 dereferenceable(72) %0, i64 72, i1 false)
+  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(72) %.fca.1.0.0.0.gep) #6
+  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(72) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
+  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(72) %.fca.2.0.0.0.gep, ptr noundef nonnull align 8 dereferenceable(72) %0, i64 72, i1 false)
+  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(72) %.fca.2.0.0.0.gep) #6
+  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(72) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
+  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(72) %.fca.3.0.0.0.gep, ptr noundef nonnull align 8 dereferenceable(72) %0, i64 72, i1 false)
+  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(72) %.fca.3.0.0.0.gep) #6
+  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(72) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
+  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(72) %.fca.4.0.0.0.gep, ptr noundef nonnull align 8 dereferenceable(72) %0, i64 72, i1 false)
+  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(72) %.fca.4.0.0.0.gep) #6
+  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(72) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
+  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(72) %.fca.5.0.0.0.gep, ptr noundef nonnull align 8 dereferenceable(72) %0, i64 72, i1 false)
+  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(72) %.fca.5.0.0.0.gep) #6
+  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(72) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
+  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(72) %.fca.6.0.0.0.gep, ptr noundef nonnull align 8 dereferenceable(72) %0, i64 72, i1 false)
+  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(72) %.fca.6.0.0.0.gep) #6
+  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(72) %0, { ptr, ptr, i64 } noundef { ptr @_Z15lambda.L12C29.0v, ptr null, i64 0 }) #6
+  call void @llvm.memcpy.p0.p0.i64(ptr noundef nonnull align 8 dereferenceable(72) %.fca.7.0.0.0.gep, ptr noundef nonnull align 8 dereferenceable(72) %0, i64 72, i1 false)
+  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(72) %.fca.7.0.0.0.gep) #6
   %puts = call i32 @puts(ptr nonnull dereferenceable(1) @str)
-  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(48) %threads) #6
-  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(48) %.fca.1.0.0.0.gep) #6
-  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(48) %.fca.2.0.0.0.gep) #6
-  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(48) %.fca.3.0.0.0.gep) #6
-  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(48) %.fca.4.0.0.0.gep) #6
-  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(48) %.fca.5.0.0.0.gep) #6
-  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(48) %.fca.6.0.0.0.gep) #6
-  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(48) %.fca.7.0.0.0.gep) #6
+  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(72) %threads) #6
+  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(72) %.fca.1.0.0.0.gep) #6
+  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(72) %.fca.2.0.0.0.gep) #6
+  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(72) %.fca.3.0.0.0.gep) #6
+  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(72) %.fca.4.0.0.0.gep) #6
+  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(72) %.fca.5.0.0.0.gep) #6
+  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(72) %.fca.6.0.0.0.gep) #6
+  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(72) %.fca.7.0.0.0.gep) #6
   %2 = call noundef i32 (ptr, ...) @printf(ptr noundef nonnull dereferenceable(1) @printf.str.2)
   ret i32 0
 }
@@ -24,9 +24,9 @@ define dso_local noundef i32 @main() #0 {
   store i32 0, ptr %result, align 4
   call void @_ZN6VectorI6StringE4ctorEv(ptr noundef nonnull align 8 dereferenceable(32) %stringVec)
   call void @_ZN6String4ctorEPKc(ptr noundef nonnull align 8 dereferenceable(24) %1, ptr noundef @anon.string.0)
-  call void @_ZN6VectorI6StringE8pushBackERK6String(ptr noundef nonnull align 8 dereferenceable(32) %stringVec, ptr noundef %1)
+  call void @_ZN6VectorI6StringE8pushBackERKS0_(ptr noundef nonnull align 8 dereferenceable(32) %stringVec, ptr noundef %1)
   call void @_ZN6String4ctorEPKc(ptr noundef nonnull align 8 dereferenceable(24) %2, ptr noundef @anon.string.1)
-  call void @_ZN6VectorI6StringE8pushBackERK6String(ptr noundef nonnull align 8 dereferenceable(32) %stringVec, ptr noundef %2)
+  call void @_ZN6VectorI6StringE8pushBackERKS0_(ptr noundef nonnull align 8 dereferenceable(32) %stringVec, ptr noundef %2)
   %5 = call %struct.VectorIterator @_ZN6VectorI6StringE11getIteratorEv(ptr %stringVec)
   store %struct.VectorIterator %5, ptr %3, align 8
   br label %foreach.head.L10
@@ -40,7 +40,7 @@ foreach.body.L10:                                 ; preds = %foreach.head.L10
   store ptr %7, ptr %4, align 8
   %8 = load ptr, ptr %4, align 8
   %9 = load %struct.String, ptr %8, align 8
-  call void @_Z5printI6StringEv6String(%struct.String noundef %9)
+  call void @_Z5printI6StringEvS0_(%struct.String noundef %9)
   br label %foreach.tail.L10
 
 foreach.tail.L10:                                 ; preds = %foreach.body.L10
@@ -59,7 +59,7 @@ declare void @_ZN6VectorI6StringE4ctorEv(ptr noundef nonnull align 8 dereference
 
 declare void @_ZN6String4ctorEPKc(ptr, ptr)
 
-declare void @_ZN6VectorI6StringE8pushBackERK6String(ptr, ptr)
+declare void @_ZN6VectorI6StringE8pushBackERKS0_(ptr, ptr)
 
 declare %struct.VectorIterator @_ZN6VectorI6StringE11getIteratorEv(ptr)
 
@@ -67,7 +67,7 @@ declare i1 @_ZN14VectorIteratorI6StringE7isValidEv(ptr)
 
 declare ptr @_ZN14VectorIteratorI6StringE3getEv(ptr)
 
-declare void @_Z5printI6StringEv6String(%struct.String)
+declare void @_Z5printI6StringEvS0_(%struct.String)
 
 declare void @_ZN14VectorIteratorI6StringE4nextEv(ptr)
 
@@ -0,0 +1,81 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+@printf.str.0 = private unnamed_addr constant [35 x i8] c"Value: %d, expected: %d, flag: %d\0A\00", align 4
+
+; Function Attrs: mustprogress noinline norecurse nounwind optnone uwtable
+define dso_local noundef i32 @main() #0 {
+  %result = alloca i32, align 4
+  %value = alloca i32, align 4
+  %order = alloca i32, align 4
+  %expected = alloca i32, align 4
+  %flag = alloca i1, align 1
+  store i32 0, ptr %result, align 4
+  store i32 1, ptr %value, align 4
+  store i32 2, ptr %order, align 4
+  %1 = load i32, ptr %order, align 4
+  switch i32 %1, label %atomic.seqcst.L5 [
+    i32 0, label %atomic.order.L5
+    i32 1, label %atomic.order.L51
+    i32 2, label %atomic.order.L52
+    i32 3, label %atomic.order.L53
+  ]
+
+atomic.order.L5:                                  ; preds = %0
+  store atomic i32 7, ptr %value monotonic, align 4
+  br label %atomic.exit.L5
+
+atomic.order.L51:                                 ; preds = %0
+  store atomic i32 7, ptr %value monotonic, align 4
+  br label %atomic.exit.L5
+
+atomic.order.L52:                                 ; preds = %0
+  store atomic i32 7, ptr %value release, align 4
+  br label %atomic.exit.L5
+
+atomic.order.L53:                                 ; preds = %0
+  store atomic i32 7, ptr %value release, align 4
+  br label %atomic.exit.L5
+
+atomic.seqcst.L5:                                 ; preds = %0
+  store atomic i32 7, ptr %value seq_cst, align 4
+  br label %atomic.exit.L5
+
+atomic.exit.L5:                                   ; preds = %atomic.seqcst.L5, %atomic.order.L53, %atomic.order.L52, %atomic.order.L51, %atomic.order.L5
+  store i32 1, ptr %expected, align 4
+  %2 = load i32, ptr %expected, align 4
+  %3 = cmpxchg weak ptr %value, i32 %2, i32 5 release monotonic, align 4
+  %4 = extractvalue { i32, i1 } %3, 0
+  %5 = extractvalue { i32, i1 } %3, 1
+  store i32 %4, ptr %expected, align 4
+  %6 = load i32, ptr %expected, align 4
+  %7 = cmpxchg ptr %value, i32 %6, i32 3 acq_rel acquire, align 4
+  %8 = extractvalue { i32, i1 } %7, 0
+  %9 = extractvalue { i32, i1 } %7, 1
+  store i32 %8, ptr %expected, align 4
+  store i1 false, ptr %flag, align 1
+  store atomic i8 1, ptr %flag monotonic, align 1
+  %10 = load i32, ptr %value, align 4
+  %11 = load i32, ptr %expected, align 4
+  %12 = load atomic i8, ptr %flag acquire, align 1
+  %13 = trunc i8 %12 to i1
+  %14 = zext i1 %13 to i32
+  %15 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 noundef %10, i32 noundef %11, i32 noundef %14)
+  %16 = load i32, ptr %result, align 4
+  ret i32 %16
+}
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr noundef readonly captures(none), ...) local_unnamed_addr #1
+
+attributes #0 = { mustprogress noinline norecurse nounwind optnone uwtable }
+attributes #1 = { nofree nounwind }
+
+!llvm.module.flags = !{!0, !1, !2, !3}
+!llvm.ident = !{!4}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{!"spice version dev (https://github.com/spicelang/spice)"}
@@ -0,0 +1,50 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+%struct.String = type { ptr, i64, i64 }
+
+@anon.string.0 = private unnamed_addr constant [6 x i8] c"Short\00", align 4
+@anon.string.1 = private unnamed_addr constant [49 x i8] c"This one is too long for the small string buffer\00", align 4
+@printf.str.0 = private unnamed_addr constant [30 x i8] c"Short: %s, long: %s, ref: %s\0A\00", align 4
+
+; Function Attrs: mustprogress noinline norecurse nounwind optnone uwtable
+define dso_local noundef i32 @main() #0 {
+  %result = alloca i32, align 4
+  %shortStr = alloca %struct.String, align 8
+  %longStr = alloca %struct.String, align 8
+  %shortRef = alloca ptr, align 8
+  store i32 0, ptr %result, align 4
+  call void @_ZN6String4ctorEPKc(ptr noundef nonnull align 8 dereferenceable(24) %shortStr, ptr noundef @anon.string.0)
+  call void @_ZN6String4ctorEPKc(ptr noundef nonnull align 8 dereferenceable(24) %longStr, ptr noundef @anon.string.1)
+  store ptr %shortStr, ptr %shortRef, align 8
+  %1 = call noundef ptr @_ZN6String6getRawEv(ptr noundef nonnull align 8 dereferenceable(24) %shortStr)
+  %2 = call noundef ptr @_ZN6String6getRawEv(ptr noundef nonnull align 8 dereferenceable(24) %longStr)
+  %3 = load ptr, ptr %shortRef, align 8
+  %4 = call noundef ptr @_ZN6String6getRawEv(ptr noundef nonnull align 8 dereferenceable(24) %3)
+  %5 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.0, ptr noundef %1, ptr noundef %2, ptr noundef %4)
+  call void @_ZN6String4dtorEv(ptr noundef nonnull align 8 dereferenceable(24) %longStr)
+  call void @_ZN6String4dtorEv(ptr noundef nonnull align 8 dereferenceable(24) %shortStr)
+  %6 = load i32, ptr %result, align 4
+  ret i32 %6
+}
+
+declare void @_ZN6String4ctorEPKc(ptr, ptr)
+
+declare ptr @_ZN6String6getRawEv(ptr)
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr noundef readonly captures(none), ...) local_unnamed_addr #1
+
+declare void @_ZN6String4dtorEv(ptr noundef nonnull align 8 dereferenceable(24))
+
+attributes #0 = { mustprogress noinline norecurse nounwind optnone uwtable }
+attributes #1 = { nofree nounwind }
+
+!llvm.module.flags = !{!0, !1, !2, !3}
+!llvm.ident = !{!4}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{!"spice version dev (https://github.com/spicelang/spice)"}
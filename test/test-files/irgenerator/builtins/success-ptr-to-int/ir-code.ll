@@ -0,0 +1,42 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+@anon.array.0 = private unnamed_addr constant [4 x i32] [i32 1, i32 2, i32 3, i32 4]
+@printf.str.0 = private unnamed_addr constant [14 x i8] c"Distance: %d\0A\00", align 4
+
+; Function Attrs: mustprogress noinline norecurse nounwind optnone uwtable
+define dso_local noundef i32 @main() #0 {
+  %result = alloca i32, align 4
+  %values = alloca [4 x i32], align 4
+  %first = alloca i64, align 8
+  %last = alloca i64, align 8
+  store i32 0, ptr %result, align 4
+  store [4 x i32] [i32 1, i32 2, i32 3, i32 4], ptr %values, align 4
+  %1 = getelementptr inbounds [4 x i32], ptr %values, i64 0, i32 1
+  %2 = ptrtoint ptr %1 to i64
+  store i64 %2, ptr %first, align 8
+  %3 = getelementptr inbounds [4 x i32], ptr %values, i64 0, i32 3
+  %4 = ptrtoint ptr %3 to i64
+  store i64 %4, ptr %last, align 8
+  %5 = load i64, ptr %first, align 8
+  %6 = load i64, ptr %last, align 8
+  %7 = sub i64 %6, %5
+  %8 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i64 noundef %7)
+  %9 = load i32, ptr %result, align 4
+  ret i32 %9
+}
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr noundef readonly captures(none), ...) local_unnamed_addr #1
+
+attributes #0 = { mustprogress noinline norecurse nounwind optnone uwtable }
+attributes #1 = { nofree nounwind }
+
+!llvm.module.flags = !{!0, !1, !2, !3}
+!llvm.ident = !{!4}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{!"spice version dev (https://github.com/spicelang/spice)"}
@@ -0,0 +1,70 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+@anon.array.0 = private unnamed_addr constant [8 x i32] [i32 1, i32 2, i32 3, i32 4, i32 5, i32 6, i32 7, i32 8]
+@printf.str.0 = private unnamed_addr constant [9 x i8] c"Sum: %d\0A\00", align 4
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private noundef i32 @_Z3sumA8_i(ptr noundef %values) #0 {
+  %result = alloca i32, align 4
+  %total = alloca i32, align 4
+  %i = alloca i32, align 4
+  store i32 0, ptr %total, align 4
+  store i32 0, ptr %i, align 4
+  br label %for.head.L6
+
+for.head.L6:                                      ; preds = %for.tail.L6, %0
+  %1 = load i32, ptr %i, align 4
+  %2 = icmp slt i32 %1, 8
+  br i1 %2, label %for.body.L6, label %for.exit.L6
+
+for.body.L6:                                      ; preds = %for.head.L6
+  %3 = load i32, ptr %i, align 4
+  %4 = getelementptr inbounds [8 x i32], ptr %values, i64 0, i32 %3
+  %5 = load i32, ptr %4, align 4
+  %6 = load i32, ptr %total, align 4
+  %7 = add nsw i32 %6, %5
+  store i32 %7, ptr %total, align 4
+  br label %for.tail.L6
+
+for.tail.L6:                                      ; preds = %for.body.L6
+  %8 = load i32, ptr %i, align 4
+  %9 = add nsw i32 %8, 1
+  store i32 %9, ptr %i, align 4
+  br label %for.head.L6, !llvm.loop !5
+
+for.exit.L6:                                      ; preds = %for.head.L6
+  %10 = load i32, ptr %total, align 4
+  ret i32 %10
+}
+
+; Function Attrs: mustprogress noinline norecurse nounwind optnone uwtable
+define dso_local noundef i32 @main() #1 {
+  %result = alloca i32, align 4
+  %numbers = alloca [8 x i32], align 4
+  store i32 0, ptr %result, align 4
+  store [8 x i32] [i32 1, i32 2, i32 3, i32 4, i32 5, i32 6, i32 7, i32 8], ptr %numbers, align 4
+  %1 = call noundef i32 @_Z3sumA8_i(ptr noundef %numbers)
+  %2 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 noundef %1)
+  %3 = load i32, ptr %result, align 4
+  ret i32 %3
+}
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr noundef readonly captures(none), ...) local_unnamed_addr #2
+
+attributes #0 = { noinline nounwind optnone uwtable }
+attributes #1 = { mustprogress noinline norecurse nounwind optnone uwtable }
+attributes #2 = { nofree nounwind }
+
+!llvm.module.flags = !{!0, !1, !2, !3}
+!llvm.ident = !{!4}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{!"spice version dev (https://github.com/spicelang/spice)"}
+!5 = distinct !{!5, !6, !7}
+!6 = !{!"llvm.loop.vectorize.enable", i1 true}
+!7 = !{!"llvm.loop.vectorize.width", i32 4}
@@ -0,0 +1,57 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+; Function Attrs: mustprogress nofree norecurse nosync nounwind willreturn memory(argmem: readwrite) uwtable
+define dso_local void @_Z7advanceR9Particlesd(ptr nofree noundef nonnull align 8 captures(none) dereferenceable(4096) %0, double noundef %1) local_unnamed_addr #0 {
+vector.ph:
+  %vel.addr = getelementptr inbounds nuw i8, ptr %0, i64 2048
+  %broadcast.splatinsert = insertelement <2 x double> poison, double %1, i64 0
+  %broadcast.splat = shufflevector <2 x double> %broadcast.splatinsert, <2 x double> poison, <2 x i32> zeroinitializer
+  br label %vector.body
+
+vector.body:                                      ; preds = %vector.body, %vector.ph
+  %index = phi i64 [ 0, %vector.ph ], [ %index.next, %vector.body ]
+  %2 = getelementptr inbounds nuw double, ptr %0, i64 %index
+  %3 = getelementptr inbounds nuw double, ptr %vel.addr, i64 %index
+  %4 = getelementptr inbounds nuw i8, ptr %3, i64 16
+  %wide.load = load <2 x double>, ptr %3, align 8, !tbaa !5
+  %wide.load7 = load <2 x double>, ptr %4, align 8, !tbaa !5
+  %5 = fmul <2 x double> %wide.load, %broadcast.splat
+  %6 = fmul <2 x double> %wide.load7, %broadcast.splat
+  %7 = getelementptr inbounds nuw i8, ptr %2, i64 16
+  %wide.load8 = load <2 x double>, ptr %2, align 8, !tbaa !5
+  %wide.load9 = load <2 x double>, ptr %7, align 8, !tbaa !5
+  %8 = fadd <2 x double> %wide.load8, %5
+  %9 = fadd <2 x double> %wide.load9, %6
+  store <2 x double> %8, ptr %2, align 8, !tbaa !5
+  store <2 x double> %9, ptr %7, align 8, !tbaa !5
+  %index.next = add nuw i64 %index, 4
+  %10 = icmp eq i64 %index.next, 256
+  br i1 %10, label %for.exit.L10, label %vector.body, !llvm.loop !9
+
+for.exit.L10:                                     ; preds = %vector.body
+  ret void
+}
+
+; Function Attrs: mustprogress nofree noinline norecurse nosync nounwind willreturn memory(none) uwtable
+define dso_local noundef i32 @main() local_unnamed_addr #1 {
+  ret i32 0
+}
+
+attributes #0 = { mustprogress nofree norecurse nosync nounwind willreturn memory(argmem: readwrite) uwtable }
+attributes #1 = { mustprogress nofree noinline norecurse nosync nounwind willreturn memory(none) uwtable }
+
+!llvm.module.flags = !{!0, !1, !2, !3}
+!llvm.ident = !{!4}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{!"spice version dev (https://github.com/spicelang/spice)"}
+!5 = !{!6, !6, i64 0}
+!6 = !{!"double", !7, i64 0}
+!7 = !{!"omnipotent byte", !8, i64 0}
+!8 = !{!"Simple Spice TBAA"}
+!9 = distinct !{!9, !10}
+!10 = !{!"llvm.loop.isvectorized", i32 1}
@@ -31,7 +31,7 @@ define private void @_ZN20ExampleContainedType4ctorEv(ptr noundef nonnull align
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private void @_ZN20ExampleContainedType4ctorERK20ExampleContainedType(ptr noundef nonnull align 1 dereferenceable(1) %0, ptr noundef %1) #0 {
+define private void @_ZN20ExampleContainedType4ctorERKS_(ptr noundef nonnull align 1 dereferenceable(1) %0, ptr noundef %1) #0 {
   %this = alloca ptr, align 8
   %_ = alloca ptr, align 8
   store ptr %0, ptr %this, align 8
@@ -84,12 +84,12 @@ define private noundef %struct.Pair @_ZN19ExampleTypeIteratorI20ExampleContained
   store ptr %0, ptr %this, align 8
   %3 = load ptr, ptr %this, align 8
   %item.addr = getelementptr inbounds %struct.ExampleTypeIterator, ptr %3, i64 0, i32 1
-  call void @_ZN4PairImR20ExampleContainedTypeE4ctorEmR20ExampleContainedType(ptr noundef nonnull align 8 dereferenceable(16) %2, i64 noundef 0, ptr noundef %item.addr)
+  call void @_ZN4PairImR20ExampleContainedTypeE4ctorEmS1_(ptr noundef nonnull align 8 dereferenceable(16) %2, i64 noundef 0, ptr noundef %item.addr)
   %4 = load %struct.Pair, ptr %2, align 8
   ret %struct.Pair %4
 }
 
-declare void @_ZN4PairImR20ExampleContainedTypeE4ctorEmR20ExampleContainedType(ptr, i64, ptr)
+declare void @_ZN4PairImR20ExampleContainedTypeE4ctorEmS1_(ptr, i64, ptr)
 
 ; Function Attrs: noinline nounwind optnone uwtable
 define private noundef zeroext i1 @_ZN19ExampleTypeIteratorI20ExampleContainedTypeE7isValidEv(ptr noundef nonnull align 8 dereferenceable(16) %0) #0 {
@@ -145,7 +145,7 @@ foreach.head.L46:                                 ; preds = %foreach.tail.L46, %
 
 foreach.body.L46:                                 ; preds = %foreach.head.L46
   %4 = call ptr @_ZN19ExampleTypeIteratorI20ExampleContainedTypeE3getEv(ptr %1)
-  call void @_ZN20ExampleContainedType4ctorERK20ExampleContainedType(ptr noundef nonnull align 1 dereferenceable(1) %ct, ptr %4)
+  call void @_ZN20ExampleContainedType4ctorERKS_(ptr noundef nonnull align 1 dereferenceable(1) %ct, ptr %4)
   %copied.addr = getelementptr inbounds %struct.ExampleContainedType, ptr %ct, i64 0, i32 0
   %5 = load i1, ptr %copied.addr, align 1
   br i1 %5, label %assert.exit.L47, label %assert.then.L47, !prof !5
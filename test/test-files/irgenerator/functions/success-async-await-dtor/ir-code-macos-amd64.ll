@@ -0,0 +1,249 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+%struct.Resource = type { i32 }
+%struct.Future = type { ptr }
+
+@printf.str.0 = private unnamed_addr constant [12 x i8] c"Release %d\0A\00", align 4
+@__spice_coro_next = weak_odr thread_local global ptr null
+@printf.str.1 = private unnamed_addr constant [12 x i8] c"Result: %d\0A\00", align 4
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private void @_ZN8Resource4dtorEv(ptr noundef nonnull align 4 dereferenceable(4) %0) #0 {
+  %this = alloca ptr, align 8
+  store ptr %0, ptr %this, align 8
+  %2 = load ptr, ptr %this, align 8
+  %id.addr = getelementptr inbounds %struct.Resource, ptr %2, i64 0, i32 0
+  %3 = load i32, ptr %id.addr, align 4
+  %4 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 noundef %3)
+  ret void
+}
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr noundef readonly captures(none), ...) local_unnamed_addr #1
+
+; Function Attrs: noinline nounwind optnone presplitcoroutine uwtable
+define private noundef %struct.Future @_Z6answerv() #2 {
+  %promise = alloca { ptr, i32 }, align 8
+  %1 = call token @llvm.coro.id(i32 0, ptr %promise, ptr null, ptr null)
+  %2 = call i1 @llvm.coro.alloc(token %1)
+  br i1 %2, label %coro.alloc, label %coro.begin, !prof !5
+
+coro.alloc:                                       ; preds = %0
+  %3 = call i64 @llvm.coro.size.i64()
+  %4 = call ptr @malloc(i64 %3)
+  br label %coro.begin
+
+coro.begin:                                       ; preds = %coro.alloc, %0
+  %coro.mem = phi ptr [ null, %0 ], [ %4, %coro.alloc ]
+  %5 = call ptr @llvm.coro.begin(token %1, ptr %coro.mem)
+  %state.addr = getelementptr inbounds { ptr, i32 }, ptr %promise, i32 0, i32 0
+  store ptr null, ptr %state.addr, align 8
+  %result = getelementptr inbounds { ptr, i32 }, ptr %promise, i32 0, i32 1
+  %6 = getelementptr inbounds { ptr, i32 }, ptr %promise, i32 0, i32 1
+  store i32 42, ptr %6, align 4
+  br label %coro.final
+
+coro.final:                                       ; preds = %coro.begin
+  %7 = call token @llvm.coro.save(ptr %5)
+  %state.addr1 = getelementptr inbounds { ptr, i32 }, ptr %promise, i32 0, i32 0
+  %8 = atomicrmw xchg ptr %state.addr1, ptr inttoptr (i64 2 to ptr) acq_rel, align 8
+  %9 = icmp eq ptr %8, inttoptr (i64 1 to ptr)
+  br i1 %9, label %coro.cleanup, label %coro.final.check
+
+coro.final.check:                                 ; preds = %coro.final
+  %10 = icmp ne ptr %8, null
+  br i1 %10, label %coro.final.schedule, label %coro.final.suspend
+
+coro.final.schedule:                              ; preds = %coro.final.check
+  %11 = call ptr @llvm.threadlocal.address.p0(ptr @__spice_coro_next)
+  store ptr %8, ptr %11, align 8
+  br label %coro.final.suspend
+
+coro.final.suspend:                               ; preds = %coro.final.schedule, %coro.final.check
+  %12 = call i8 @llvm.coro.suspend(token %7, i1 true)
+  switch i8 %12, label %coro.suspend [
+    i8 1, label %coro.cleanup
+  ]
+
+coro.cleanup:                                     ; preds = %coro.final.suspend, %coro.final
+  %13 = call ptr @llvm.coro.free(token %1, ptr %5)
+  %14 = icmp ne ptr %13, null
+  br i1 %14, label %coro.free, label %coro.suspend
+
+coro.free:                                        ; preds = %coro.cleanup
+  call void @free(ptr %13)
+  br label %coro.suspend
+
+coro.suspend:                                     ; preds = %coro.free, %coro.cleanup, %coro.final.suspend
+  call void @llvm.coro.end(ptr null, i1 false, token none)
+  %15 = insertvalue %struct.Future poison, ptr %5, 0
+  ret %struct.Future %15
+}
+
+; Function Attrs: nocallback nofree nosync nounwind willreturn memory(argmem: read)
+declare token @llvm.coro.id(i32, ptr readnone, ptr readonly captures(none), ptr) #3
+
+; Function Attrs: nounwind
+declare i1 @llvm.coro.alloc(token) #4
+
+; Function Attrs: nounwind memory(none)
+declare i64 @llvm.coro.size.i64() #5
+
+; Function Attrs: nounwind
+declare noalias ptr @malloc(i64 noundef) #4
+
+; Function Attrs: nounwind
+declare ptr @llvm.coro.begin(token, ptr writeonly) #4
+
+; Function Attrs: nomerge nounwind
+declare token @llvm.coro.save(ptr) #6
+
+; Function Attrs: nocallback nofree nosync nounwind speculatable willreturn memory(none)
+declare nonnull ptr @llvm.threadlocal.address.p0(ptr nonnull) #7
+
+; Function Attrs: nounwind
+declare i8 @llvm.coro.suspend(token, i1) #4
+
+; Function Attrs: nounwind memory(argmem: read)
+declare ptr @llvm.coro.free(token, ptr readonly captures(none)) #8
+
+; Function Attrs: nounwind
+declare void @free(ptr noundef readonly captures(none)) #4
+
+; Function Attrs: nounwind
+declare void @llvm.coro.end(ptr, i1, token) #4
+
+; Function Attrs: noinline nounwind optnone presplitcoroutine uwtable
+define private noundef %struct.Future @_Z7computev() #2 {
+  %promise = alloca { ptr, i32 }, align 8
+  %resource = alloca %struct.Resource, align 8
+  %future = alloca %struct.Future, align 8
+  %value = alloca i32, align 4
+  %1 = call token @llvm.coro.id(i32 0, ptr %promise, ptr null, ptr null)
+  %2 = call i1 @llvm.coro.alloc(token %1)
+  br i1 %2, label %coro.alloc, label %coro.begin, !prof !5
+
+coro.alloc:                                       ; preds = %0
+  %3 = call i64 @llvm.coro.size.i64()
+  %4 = call ptr @malloc(i64 %3)
+  br label %coro.begin
+
+coro.begin:                                       ; preds = %coro.alloc, %0
+  %coro.mem = phi ptr [ null, %0 ], [ %4, %coro.alloc ]
+  %5 = call ptr @llvm.coro.begin(token %1, ptr %coro.mem)
+  %state.addr = getelementptr inbounds { ptr, i32 }, ptr %promise, i32 0, i32 0
+  store ptr null, ptr %state.addr, align 8
+  %result = getelementptr inbounds { ptr, i32 }, ptr %promise, i32 0, i32 1
+  store %struct.Resource { i32 1 }, ptr %resource, align 4
+  %6 = call noundef %struct.Future @_Z6answerv()
+  store %struct.Future %6, ptr %future, align 8
+  %7 = getelementptr inbounds %struct.Future, ptr %future, i32 0, i32 0
+  %8 = load ptr, ptr %7, align 8
+  %9 = call ptr @llvm.coro.promise(ptr %8, i32 8, i1 false)
+  %state.addr1 = getelementptr inbounds { ptr, i32 }, ptr %9, i32 0, i32 0
+  %10 = call token @llvm.coro.save(ptr %5)
+  %11 = cmpxchg ptr %state.addr1, ptr null, ptr %5 acq_rel acquire, align 8
+  %12 = extractvalue { ptr, i1 } %11, 1
+  br i1 %12, label %await.suspend, label %await.ready
+
+await.suspend:                                    ; preds = %coro.begin
+  %13 = call i8 @llvm.coro.suspend(token %10, i1 false)
+  switch i8 %13, label %coro.suspend [
+    i8 0, label %await.ready
+    i8 1, label %coro.destroy
+  ]
+
+coro.destroy:                                     ; preds = %await.suspend
+  call void @_ZN8Resource4dtorEv(ptr noundef nonnull align 4 dereferenceable(4) %resource)
+  br label %coro.cleanup
+
+await.ready:                                      ; preds = %await.suspend, %coro.begin
+  %result.addr = getelementptr inbounds { ptr, i32 }, ptr %9, i32 0, i32 1
+  %14 = load i32, ptr %result.addr, align 4
+  call void @llvm.coro.destroy(ptr %8)
+  store ptr null, ptr %7, align 8
+  store i32 %14, ptr %value, align 4
+  %15 = load i32, ptr %value, align 4
+  call void @_ZN8Resource4dtorEv(ptr noundef nonnull align 4 dereferenceable(4) %resource)
+  %16 = getelementptr inbounds { ptr, i32 }, ptr %promise, i32 0, i32 1
+  store i32 %15, ptr %16, align 4
+  br label %coro.final
+
+coro.final:                                       ; preds = %await.ready
+  %17 = call token @llvm.coro.save(ptr %5)
+  %state.addr2 = getelementptr inbounds { ptr, i32 }, ptr %promise, i32 0, i32 0
+  %18 = atomicrmw xchg ptr %state.addr2, ptr inttoptr (i64 2 to ptr) acq_rel, align 8
+  %19 = icmp eq ptr %18, inttoptr (i64 1 to ptr)
+  br i1 %19, label %coro.cleanup, label %coro.final.check
+
+coro.final.check:                                 ; preds = %coro.final
+  %20 = icmp ne ptr %18, null
+  br i1 %20, label %coro.final.schedule, label %coro.final.suspend
+
+coro.final.schedule:                              ; preds = %coro.final.check
+  %21 = call ptr @llvm.threadlocal.address.p0(ptr @__spice_coro_next)
+  store ptr %18, ptr %21, align 8
+  br label %coro.final.suspend
+
+coro.final.suspend:                               ; preds = %coro.final.schedule, %coro.final.check
+  %22 = call i8 @llvm.coro.suspend(token %17, i1 true)
+  switch i8 %22, label %coro.suspend [
+    i8 1, label %coro.cleanup
+  ]
+
+coro.cleanup:                                     ; preds = %coro.final.suspend, %coro.final, %coro.destroy
+  %23 = call ptr @llvm.coro.free(token %1, ptr %5)
+  %24 = icmp ne ptr %23, null
+  br i1 %24, label %coro.free, label %coro.suspend
+
+coro.free:                                        ; preds = %coro.cleanup
+  call void @free(ptr %23)
+  br label %coro.suspend
+
+coro.suspend:                                     ; preds = %coro.free, %coro.cleanup, %coro.final.suspend, %await.suspend
+  call void @llvm.coro.end(ptr null, i1 false, token none)
+  %25 = insertvalue %struct.Future poison, ptr %5, 0
+  ret %struct.Future %25
+}
+
+; Function Attrs: nounwind memory(none)
+declare ptr @llvm.coro.promise(ptr captures(none), i32, i1) #5
+
+declare void @llvm.coro.destroy(ptr)
+
+; Function Attrs: mustprogress noinline norecurse nounwind optnone uwtable
+define dso_local noundef i32 @main() #9 {
+  %result = alloca i32, align 4
+  %future = alloca %struct.Future, align 8
+  store i32 0, ptr %result, align 4
+  %1 = call noundef %struct.Future @_Z7computev()
+  store %struct.Future %1, ptr %future, align 8
+  %2 = call noundef i32 @_ZN6FutureIiE4takeEv(ptr noundef nonnull align 8 dereferenceable(8) %future)
+  %3 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.1, i32 noundef %2)
+  %4 = load i32, ptr %result, align 4
+  ret i32 %4
+}
+
+declare i32 @_ZN6FutureIiE4takeEv(ptr)
+
+attributes #0 = { noinline nounwind optnone uwtable }
+attributes #1 = { nofree nounwind }
+attributes #2 = { noinline nounwind optnone presplitcoroutine uwtable }
+attributes #3 = { nocallback nofree nosync nounwind willreturn memory(argmem: read) }
+attributes #4 = { nounwind }
+attributes #5 = { nounwind memory(none) }
+attributes #6 = { nomerge nounwind }
+attributes #7 = { nocallback nofree nosync nounwind speculatable willreturn memory(none) }
+attributes #8 = { nounwind memory(argmem: read) }
+attributes #9 = { mustprogress noinline norecurse nounwind optnone uwtable }
+
+!llvm.module.flags = !{!0, !1, !2, !3}
+!llvm.ident = !{!4}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{!"spice version dev (https://github.com/spicelang/spice)"}
+!5 = !{!"branch_weights", i32 1048575, i32 1}
@@ -0,0 +1,262 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+@printf.str.0 = private unnamed_addr constant [14 x i8] c"fib(20) = %d\0A\00", align 4
+@printf.str.1 = private unnamed_addr constant [18 x i8] c"fib(fib(5)) = %d\0A\00", align 4
+@anon.array.0 = private unnamed_addr constant [256 x i32] [i32 0, i32 1996959894, i32 -301047508, i32 -1727442502, i32 124634137, i32 1886057615, i32 -379345611, i32 -1637575261, i32 249268274, i32 2044508324, i32 -522852066, i32 -1747789432, i32 162941995, i32 2125561021, i32 -407360249, i32 -1866523247, i32 498536548, i32 1789927666, i32 -205950648, i32 -2067906082, i32 450548861, i32 1843258603, i32 -187386543, i32 -2083289657, i32 325883990, i32 1684777152, i32 -43845254, i32 -1973040660, i32 335633487, i32 1661365465, i32 -99664541, i32 -1928851979, i32 997073096, i32 1281953886, i32 -715111964, i32 -1570279054, i32 1006888145, i32 1258607687, i32 -770865667, i32 -1526024853, i32 901097722, i32 1119000684, i32 -608450090, i32 -1396901568, i32 853044451, i32 1172266101, i32 -589951537, i32 -1412350631, i32 651767980, i32 1373503546, i32 -925412992, i32 -1076862698, i32 565507253, i32 1454621731, i32 -809855591, i32 -1195530993, i32 671266974, i32 1594198024, i32 -972236366, i32 -1324619484, i32 795835527, i32 1483230225, i32 -1050600021, i32 -1234817731, i32 1994146192, i32 31158534, i32 -1731059524, i32 -271249366, i32 1907459465, i32 112637215, i32 -1614814043, i32 -390540237, i32 2013776290, i32 251722036, i32 -1777751922, i32 -519137256, i32 2137656763, i32 141376813, i32 -1855689577, i32 -429695999, i32 1802195444, i32 476864866, i32 -2056965928, i32 -228458418, i32 1812370925, i32 453092731, i32 -2113342271, i32 -183516073, i32 1706088902, i32 314042704, i32 -1950435094, i32 -54949764, i32 1658658271, i32 366619977, i32 -1932296973, i32 -69972891, i32 1303535960, i32 984961486, i32 -1547960204, i32 -725929758, i32 1256170817, i32 1037604311, i32 -1529756563, i32 -740887301, i32 1131014506, i32 879679996, i32 -1385723834, i32 -631195440, i32 1141124467, i32 855842277, i32 -1442165665, i32 -586318647, i32 1342533948, i32 654459306, i32 -1106571248, i32 -921952122, i32 1466479909, i32 544179635, i32 -1184443383, i32 -832445281, i32 1591671054, i32 702138776, i32 -1328506846, i32 -942167884, i32 1504918807, i32 783551873, i32 -1212326853, i32 -1061524307, i32 -306674912, i32 -1698712650, i32 62317068, i32 1957810842, i32 -355121351, i32 -1647151185, i32 81470997, i32 1943803523, i32 -480048366, i32 -1805370492, i32 225274430, i32 2053790376, i32 -468791541, i32 -1828061283, i32 167816743, i32 2097651377, i32 -267414716, i32 -2029476910, i32 503444072, i32 1762050814, i32 -144550051, i32 -2140837941, i32 426522225, i32 1852507879, i32 -19653770, i32 -1982649376, i32 282753626, i32 1742555852, i32 -105259153, i32 -1900089351, i32 397917763, i32 1622183637, i32 -690576408, i32 -1580100738, i32 953729732, i32 1340076626, i32 -776247311, i32 -1497606297, i32 1068828381, i32 1219638859, i32 -670225446, i32 -1358292148, i32 906185462, i32 1090812512, i32 -547295293, i32 -1469587627, i32 829329135, i32 1181335161, i32 -882789492, i32 -1134132454, i32 628085408, i32 1382605366, i32 -871598187, i32 -1156888829, i32 570562233, i32 1426400815, i32 -977650754, i32 -1296233688, i32 733239954, i32 1555261956, i32 -1026031705, i32 -1244606671, i32 752459403, i32 1541320221, i32 -1687895376, i32 -328994266, i32 1969922972, i32 40735498, i32 -1677130071, i32 -351390145, i32 1913087877, i32 83908371, i32 -1782625662, i32 -491226604, i32 2075208622, i32 213261112, i32 -1831694693, i32 -438977011, i32 2094854071, i32 198958881, i32 -2032938284, i32 -237706686, i32 1759359992, i32 534414190, i32 -2118248755, i32 -155638181, i32 1873836001, i32 414664567, i32 -2012718362, i32 -15766928, i32 1711684554, i32 285281116, i32 -1889165569, i32 -127750551, i32 1634467795, i32 376229701, i32 -1609899400, i32 -686959890, i32 1308918612, i32 956543938, i32 -1486412191, i32 -799009033, i32 1231636301, i32 1047427035, i32 -1362007478, i32 -640263460, i32 1088359270, i32 936918000, i32 -1447252397, i32 -558129467, i32 1202900863, i32 817233897, i32 -1111625188, i32 -893730166, i32 1404277552, i32 615818150, i32 -1160759803, i32 -841546093, i32 1423857449, i32 601450431, i32 -1285129682, i32 -1000256840, i32 1567103746, i32 711928724, i32 -1274298825, i32 -1022587231, i32 1510334235, i32 755167117]
+@printf.str.2 = private unnamed_addr constant [28 x i8] c"crc[1] = %u, crc[255] = %u\0A\00", align 4
+@printf.str.3 = private unnamed_addr constant [39 x i8] c"Sum of squares: %ld, with offset: %ld\0A\00", align 4
+@printf.str.4 = private unnamed_addr constant [18 x i8] c"Is prime: %d, %d\0A\00", align 4
+@printf.str.5 = private unnamed_addr constant [14 x i8] c"fib(%d) = %d\0A\00", align 4
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private noundef i32 @_Z3fibi(i32 noundef %0) #0 {
+  %result = alloca i32, align 4
+  %n = alloca i32, align 4
+  store i32 %0, ptr %n, align 4
+  %2 = load i32, ptr %n, align 4
+  %3 = icmp slt i32 %2, 2
+  br i1 %3, label %if.then.L3, label %if.exit.L3
+
+if.then.L3:                                       ; preds = %1
+  %4 = load i32, ptr %n, align 4
+  ret i32 %4
+
+if.exit.L3:                                       ; preds = %1
+  %5 = load i32, ptr %n, align 4
+  %6 = sub nsw i32 %5, 1
+  %7 = call noundef i32 @_Z3fibi(i32 noundef %6)
+  %8 = load i32, ptr %n, align 4
+  %9 = sub nsw i32 %8, 2
+  %10 = call noundef i32 @_Z3fibi(i32 noundef %9)
+  %11 = add nsw i32 %7, %10
+  ret i32 %11
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private noundef [256 x i32] @_Z8crcTablev() #0 {
+  %result = alloca [256 x i32], align 4
+  %table = alloca [256 x i32], align 4
+  %i = alloca i32, align 4
+  %crc = alloca i32, align 4
+  %j = alloca i32, align 4
+  store [256 x i32] zeroinitializer, ptr %table, align 4
+  store i32 0, ptr %i, align 4
+  br label %for.head.L10
+
+for.head.L10:                                     ; preds = %for.tail.L10, %0
+  %1 = load i32, ptr %i, align 4
+  %2 = icmp ult i32 %1, 256
+  br i1 %2, label %for.body.L10, label %for.exit.L10
+
+for.body.L10:                                     ; preds = %for.head.L10
+  %3 = load i32, ptr %i, align 4
+  store i32 %3, ptr %crc, align 4
+  store i32 0, ptr %j, align 4
+  br label %for.head.L12
+
+for.head.L12:                                     ; preds = %for.tail.L12, %for.body.L10
+  %4 = load i32, ptr %j, align 4
+  %5 = icmp slt i32 %4, 8
+  br i1 %5, label %for.body.L12, label %for.exit.L12
+
+for.body.L12:                                     ; preds = %for.head.L12
+  %6 = load i32, ptr %crc, align 4
+  %7 = and i32 %6, 1
+  %8 = icmp ne i32 %7, 0
+  br i1 %8, label %cond.true.L13C19, label %cond.false.L13C19
+
+cond.true.L13C19:                                 ; preds = %for.body.L12
+  %9 = load i32, ptr %crc, align 4
+  %10 = lshr i32 %9, 1
+  %11 = xor i32 %10, -306674912
+  br label %cond.exit.L13C19
+
+cond.false.L13C19:                                ; preds = %for.body.L12
+  %12 = load i32, ptr %crc, align 4
+  %13 = lshr i32 %12, 1
+  br label %cond.exit.L13C19
+
+cond.exit.L13C19:                                 ; preds = %cond.false.L13C19, %cond.true.L13C19
+  %cond.result = phi i32 [ %11, %cond.true.L13C19 ], [ %13, %cond.false.L13C19 ]
+  store i32 %cond.result, ptr %crc, align 4
+  br label %for.tail.L12
+
+for.tail.L12:                                     ; preds = %cond.exit.L13C19
+  %14 = load i32, ptr %j, align 4
+  %15 = add nsw i32 %14, 1
+  store i32 %15, ptr %j, align 4
+  br label %for.head.L12
+
+for.exit.L12:                                     ; preds = %for.head.L12
+  %16 = load i32, ptr %i, align 4
+  %17 = getelementptr inbounds [256 x i32], ptr %table, i64 0, i32 %16
+  %18 = load i32, ptr %crc, align 4
+  store i32 %18, ptr %17, align 4
+  br label %for.tail.L10
+
+for.tail.L10:                                     ; preds = %for.exit.L12
+  %19 = load i32, ptr %i, align 4
+  %20 = add i32 %19, 1
+  store i32 %20, ptr %i, align 4
+  br label %for.head.L10
+
+for.exit.L10:                                     ; preds = %for.head.L10
+  %21 = load [256 x i32], ptr %table, align 4
+  ret [256 x i32] %21
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private noundef i64 @_Z12sumOfSquaresl(i64 noundef %0) #0 {
+  %result = alloca i64, align 8
+  %count = alloca i64, align 8
+  %offset = alloca i64, align 8
+  %sum = alloca i64, align 8
+  %i = alloca i64, align 8
+  store i64 %0, ptr %count, align 8
+  store i64 0, ptr %offset, align 8
+  %2 = load i64, ptr %offset, align 8
+  store i64 %2, ptr %sum, align 8
+  store i64 1, ptr %i, align 8
+  br label %while.head.L24
+
+while.head.L24:                                   ; preds = %while.body.L24, %1
+  %3 = load i64, ptr %i, align 8
+  %4 = load i64, ptr %count, align 8
+  %5 = icmp sle i64 %3, %4
+  br i1 %5, label %while.body.L24, label %while.exit.L24
+
+while.body.L24:                                   ; preds = %while.head.L24
+  %6 = load i64, ptr %i, align 8
+  %7 = load i64, ptr %i, align 8
+  %8 = mul nsw i64 %6, %7
+  %9 = load i64, ptr %sum, align 8
+  %10 = add nsw i64 %9, %8
+  store i64 %10, ptr %sum, align 8
+  %11 = load i64, ptr %i, align 8
+  %12 = add nsw i64 %11, 1
+  store i64 %12, ptr %i, align 8
+  br label %while.head.L24
+
+while.exit.L24:                                   ; preds = %while.head.L24
+  %13 = load i64, ptr %sum, align 8
+  ret i64 %13
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private noundef i64 @_Z12sumOfSquaresll(i64 noundef %0, i64 noundef %1) #0 {
+  %result = alloca i64, align 8
+  %count = alloca i64, align 8
+  %offset = alloca i64, align 8
+  %sum = alloca i64, align 8
+  %i = alloca i64, align 8
+  store i64 %0, ptr %count, align 8
+  store i64 %1, ptr %offset, align 8
+  %3 = load i64, ptr %offset, align 8
+  store i64 %3, ptr %sum, align 8
+  store i64 1, ptr %i, align 8
+  br label %while.head.L24
+
+while.head.L24:                                   ; preds = %while.body.L24, %2
+  %4 = load i64, ptr %i, align 8
+  %5 = load i64, ptr %count, align 8
+  %6 = icmp sle i64 %4, %5
+  br i1 %6, label %while.body.L24, label %while.exit.L24
+
+while.body.L24:                                   ; preds = %while.head.L24
+  %7 = load i64, ptr %i, align 8
+  %8 = load i64, ptr %i, align 8
+  %9 = mul nsw i64 %7, %8
+  %10 = load i64, ptr %sum, align 8
+  %11 = add nsw i64 %10, %9
+  store i64 %11, ptr %sum, align 8
+  %12 = load i64, ptr %i, align 8
+  %13 = add nsw i64 %12, 1
+  store i64 %13, ptr %i, align 8
+  br label %while.head.L24
+
+while.exit.L24:                                   ; preds = %while.head.L24
+  %14 = load i64, ptr %sum, align 8
+  ret i64 %14
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private noundef zeroext i1 @_Z7isPrimem(i64 noundef %0) #0 {
+  %result = alloca i1, align 1
+  %n = alloca i64, align 8
+  %d = alloca i64, align 8
+  store i64 %0, ptr %n, align 8
+  store i64 2, ptr %d, align 8
+  br label %for.head.L33
+
+for.head.L33:                                     ; preds = %for.tail.L33, %1
+  %2 = load i64, ptr %d, align 8
+  %3 = load i64, ptr %d, align 8
+  %4 = mul i64 %2, %3
+  %5 = load i64, ptr %n, align 8
+  %6 = icmp ule i64 %4, %5
+  br i1 %6, label %for.body.L33, label %for.exit.L33
+
+for.body.L33:                                     ; preds = %for.head.L33
+  %7 = load i64, ptr %n, align 8
+  %8 = load i64, ptr %d, align 8
+  %9 = urem i64 %7, %8
+  %10 = icmp eq i64 %9, 0
+  br i1 %10, label %if.then.L34, label %if.exit.L34
+
+if.then.L34:                                      ; preds = %for.body.L33
+  ret i1 false
+
+if.exit.L34:                                      ; preds = %for.body.L33
+  br label %for.tail.L33
+
+for.tail.L33:                                     ; preds = %if.exit.L34
+  %11 = load i64, ptr %d, align 8
+  %12 = add i64 %11, 1
+  store i64 %12, ptr %d, align 8
+  br label %for.head.L33
+
+for.exit.L33:                                     ; preds = %for.head.L33
+  ret i1 true
+}
+
+; Function Attrs: mustprogress noinline norecurse nounwind optnone uwtable
+define dso_local noundef i32 @main() #1 {
+  %result = alloca i32, align 4
+  %table = alloca [256 x i32], align 4
+  %n = alloca i32, align 4
+  store i32 0, ptr %result, align 4
+  %1 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 noundef 6765)
+  %2 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.1, i32 noundef 5)
+  store [256 x i32] [i32 0, i32 1996959894, i32 -301047508, i32 -1727442502, i32 124634137, i32 1886057615, i32 -379345611, i32 -1637575261, i32 249268274, i32 2044508324, i32 -522852066, i32 -1747789432, i32 162941995, i32 2125561021, i32 -407360249, i32 -1866523247, i32 498536548, i32 1789927666, i32 -205950648, i32 -2067906082, i32 450548861, i32 1843258603, i32 -187386543, i32 -2083289657, i32 325883990, i32 1684777152, i32 -43845254, i32 -1973040660, i32 335633487, i32 1661365465, i32 -99664541, i32 -1928851979, i32 997073096, i32 1281953886, i32 -715111964, i32 -1570279054, i32 1006888145, i32 1258607687, i32 -770865667, i32 -1526024853, i32 901097722, i32 1119000684, i32 -608450090, i32 -1396901568, i32 853044451, i32 1172266101, i32 -589951537, i32 -1412350631, i32 651767980, i32 1373503546, i32 -925412992, i32 -1076862698, i32 565507253, i32 1454621731, i32 -809855591, i32 -1195530993, i32 671266974, i32 1594198024, i32 -972236366, i32 -1324619484, i32 795835527, i32 1483230225, i32 -1050600021, i32 -1234817731, i32 1994146192, i32 31158534, i32 -1731059524, i32 -271249366, i32 1907459465, i32 112637215, i32 -1614814043, i32 -390540237, i32 2013776290, i32 251722036, i32 -1777751922, i32 -519137256, i32 2137656763, i32 141376813, i32 -1855689577, i32 -429695999, i32 1802195444, i32 476864866, i32 -2056965928, i32 -228458418, i32 1812370925, i32 453092731, i32 -2113342271, i32 -183516073, i32 1706088902, i32 314042704, i32 -1950435094, i32 -54949764, i32 1658658271, i32 366619977, i32 -1932296973, i32 -69972891, i32 1303535960, i32 984961486, i32 -1547960204, i32 -725929758, i32 1256170817, i32 1037604311, i32 -1529756563, i32 -740887301, i32 1131014506, i32 879679996, i32 -1385723834, i32 -631195440, i32 1141124467, i32 855842277, i32 -1442165665, i32 -586318647, i32 1342533948, i32 654459306, i32 -1106571248, i32 -921952122, i32 1466479909, i32 544179635, i32 -1184443383, i32 -832445281, i32 1591671054, i32 702138776, i32 -1328506846, i32 -942167884, i32 1504918807, i32 783551873, i32 -1212326853, i32 -1061524307, i32 -306674912, i32 -1698712650, i32 62317068, i32 1957810842, i32 -355121351, i32 -1647151185, i32 81470997, i32 1943803523, i32 -480048366, i32 -1805370492, i32 225274430, i32 2053790376, i32 -468791541, i32 -1828061283, i32 167816743, i32 2097651377, i32 -267414716, i32 -2029476910, i32 503444072, i32 1762050814, i32 -144550051, i32 -2140837941, i32 426522225, i32 1852507879, i32 -19653770, i32 -1982649376, i32 282753626, i32 1742555852, i32 -105259153, i32 -1900089351, i32 397917763, i32 1622183637, i32 -690576408, i32 -1580100738, i32 953729732, i32 1340076626, i32 -776247311, i32 -1497606297, i32 1068828381, i32 1219638859, i32 -670225446, i32 -1358292148, i32 906185462, i32 1090812512, i32 -547295293, i32 -1469587627, i32 829329135, i32 1181335161, i32 -882789492, i32 -1134132454, i32 628085408, i32 1382605366, i32 -871598187, i32 -1156888829, i32 570562233, i32 1426400815, i32 -977650754, i32 -1296233688, i32 733239954, i32 1555261956, i32 -1026031705, i32 -1244606671, i32 752459403, i32 1541320221, i32 -1687895376, i32 -328994266, i32 1969922972, i32 40735498, i32 -1677130071, i32 -351390145, i32 1913087877, i32 83908371, i32 -1782625662, i32 -491226604, i32 2075208622, i32 213261112, i32 -1831694693, i32 -438977011, i32 2094854071, i32 198958881, i32 -2032938284, i32 -237706686, i32 1759359992, i32 534414190, i32 -2118248755, i32 -155638181, i32 1873836001, i32 414664567, i32 -2012718362, i32 -15766928, i32 1711684554, i32 285281116, i32 -1889165569, i32 -127750551, i32 1634467795, i32 376229701, i32 -1609899400, i32 -686959890, i32 1308918612, i32 956543938, i32 -1486412191, i32 -799009033, i32 1231636301, i32 1047427035, i32 -1362007478, i32 -640263460, i32 1088359270, i32 936918000, i32 -1447252397, i32 -558129467, i32 1202900863, i32 817233897, i32 -1111625188, i32 -893730166, i32 1404277552, i32 615818150, i32 -1160759803, i32 -841546093, i32 1423857449, i32 601450431, i32 -1285129682, i32 -1000256840, i32 1567103746, i32 711928724, i32 -1274298825, i32 -1022587231, i32 1510334235, i32 755167117], ptr %table, align 4
+  %3 = getelementptr inbounds [256 x i32], ptr %table, i64 0, i32 1
+  %4 = load i32, ptr %3, align 4
+  %5 = getelementptr inbounds [256 x i32], ptr %table, i64 0, i32 255
+  %6 = load i32, ptr %5, align 4
+  %7 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.2, i32 noundef %4, i32 noundef %6)
+  %8 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.3, i64 noundef 385, i64 noundef 400)
+  %9 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.4, i32 noundef 1, i32 noundef 0)
+  store i32 10, ptr %n, align 4
+  %10 = load i32, ptr %n, align 4
+  %11 = load i32, ptr %n, align 4
+  %12 = call noundef i32 @_Z3fibi(i32 noundef %11)
+  %13 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.5, i32 noundef %10, i32 noundef %12)
+  %14 = load i32, ptr %result, align 4
+  ret i32 %14
+}
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr noundef readonly captures(none), ...) local_unnamed_addr #2
+
+attributes #0 = { noinline nounwind optnone uwtable }
+attributes #1 = { mustprogress noinline norecurse nounwind optnone uwtable }
+attributes #2 = { nofree nounwind }
+
+!llvm.module.flags = !{!0, !1, !2, !3}
+!llvm.ident = !{!4}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{!"spice version dev (https://github.com/spicelang/spice)"}
@@ -19,7 +19,7 @@ define private void @_ZN4Test4ctorEv(ptr noundef nonnull align 4 dereferenceable
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private void @_ZN4Test4ctorERK4Test(ptr noundef nonnull align 4 dereferenceable(4) %0, ptr noundef %1) #0 {
+define private void @_ZN4Test4ctorERKS_(ptr noundef nonnull align 4 dereferenceable(4) %0, ptr noundef %1) #0 {
   %this = alloca ptr, align 8
   %old = alloca ptr, align 8
   store ptr %0, ptr %this, align 8
@@ -57,7 +57,7 @@ define private noundef %struct.Test @_Z8testRVO2RK4Test(ptr noundef %0) #0 {
   %2 = alloca %struct.Test, align 8
   store ptr %0, ptr %old, align 8
   %3 = load ptr, ptr %old, align 8
-  call void @_ZN4Test4ctorERK4Test(ptr noundef nonnull align 4 dereferenceable(4) %2, ptr %3)
+  call void @_ZN4Test4ctorERKS_(ptr noundef nonnull align 4 dereferenceable(4) %2, ptr %3)
   %4 = load %struct.Test, ptr %2, align 4
   ret %struct.Test %4
 }
@@ -68,7 +68,7 @@ define private noundef %struct.Test @_Z8testRVO34Test(%struct.Test noundef %0) #
   %old = alloca %struct.Test, align 8
   %old1 = alloca %struct.Test, align 8
   store %struct.Test %0, ptr %old, align 4
-  call void @_ZN4Test4ctorERK4Test(ptr noundef nonnull align 4 dereferenceable(4) %old1, ptr %old)
+  call void @_ZN4Test4ctorERKS_(ptr noundef nonnull align 4 dereferenceable(4) %old1, ptr %old)
   %2 = load %struct.Test, ptr %old1, align 4
   ret %struct.Test %2
 }
@@ -83,7 +83,7 @@ define private noundef %struct.Test @_Z8testRVO4RK4Test(ptr noundef %0) #0 {
   %3 = load ptr, ptr %old, align 8
   store ptr %3, ptr %old1, align 8
   %4 = load ptr, ptr %old1, align 8
-  call void @_ZN4Test4ctorERK4Test(ptr noundef nonnull align 4 dereferenceable(4) %2, ptr %4)
+  call void @_ZN4Test4ctorERKS_(ptr noundef nonnull align 4 dereferenceable(4) %2, ptr %4)
   %5 = load %struct.Test, ptr %2, align 4
   ret %struct.Test %5
 }
@@ -100,7 +100,7 @@ define dso_local noundef i32 @main() #1 {
   %t4 = alloca %struct.Test, align 8
   store i32 0, ptr %result, align 4
   call void @_ZN4Test4ctorEv(ptr noundef nonnull align 4 dereferenceable(4) %t)
-  call void @_ZN4Test4ctorERK4Test(ptr noundef nonnull align 4 dereferenceable(4) %arg.copy, ptr %t)
+  call void @_ZN4Test4ctorERKS_(ptr noundef nonnull align 4 dereferenceable(4) %arg.copy, ptr %t)
   %1 = load %struct.Test, ptr %arg.copy, align 4
   %2 = call noundef %struct.Test @_Z8testRVO14Test(%struct.Test noundef %1)
   store %struct.Test %2, ptr %t1, align 4
@@ -128,7 +128,7 @@ assert.then.L38:                                  ; preds = %assert.exit.L35
   unreachable
 
 assert.exit.L38:                                  ; preds = %assert.exit.L35
-  call void @_ZN4Test4ctorERK4Test(ptr noundef nonnull align 4 dereferenceable(4) %arg.copy2, ptr %t)
+  call void @_ZN4Test4ctorERKS_(ptr noundef nonnull align 4 dereferenceable(4) %arg.copy2, ptr %t)
   %10 = load %struct.Test, ptr %arg.copy2, align 4
   %11 = call noundef %struct.Test @_Z8testRVO34Test(%struct.Test noundef %10)
   store %struct.Test %11, ptr %t3, align 4
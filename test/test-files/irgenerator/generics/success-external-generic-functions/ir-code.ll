@@ -17,11 +17,11 @@ define dso_local noundef i32 @main() #0 {
   call void @_Z11printFormatIdEvd(double noundef 1.123000e+00)
   call void @_Z11printFormatIiEvi(i32 noundef 543)
   call void @llvm.memcpy.p0.p0.i64(ptr %arg.decay, ptr @anon.array.0, i64 16, i1 false)
-  call void @_Z11printFormatIA2_PKcEvA2_PKc(ptr noundef %arg.decay)
+  call void @_Z11printFormatIA2_PKcEvS2_(ptr noundef %arg.decay)
   store i32 1234, ptr %test, align 4
-  call void @_Z11printFormatIPiEvPi(ptr noundef align 4 dereferenceable(4) %test)
+  call void @_Z11printFormatIPiEvS0_(ptr noundef align 4 dereferenceable(4) %test)
   store i32 12, ptr %i, align 4
-  %1 = call noundef ptr @_Z7getAIncIiEPiPi(ptr noundef align 4 dereferenceable(4) %i)
+  %1 = call noundef ptr @_Z7getAIncIiEPiS0_(ptr noundef align 4 dereferenceable(4) %i)
   store ptr %1, ptr %iPtr, align 8
   %2 = load ptr, ptr %iPtr, align 8
   %3 = load i32, ptr %2, align 4
@@ -45,11 +45,11 @@ declare void @_Z11printFormatIiEvi(i32)
 ; Function Attrs: nocallback nofree nosync nounwind willreturn memory(argmem: readwrite)
 declare void @llvm.memcpy.p0.p0.i64(ptr noalias writeonly captures(none), ptr noalias readonly captures(none), i64, i1 immarg) #1
 
-declare void @_Z11printFormatIA2_PKcEvA2_PKc(ptr)
+declare void @_Z11printFormatIA2_PKcEvS2_(ptr)
 
-declare void @_Z11printFormatIPiEvPi(ptr)
+declare void @_Z11printFormatIPiEvS0_(ptr)
 
-declare ptr @_Z7getAIncIiEPiPi(ptr)
+declare ptr @_Z7getAIncIiEPiS0_(ptr)
 
 ; Function Attrs: nofree nounwind
 declare noundef i32 @printf(ptr noundef readonly captures(none), ...) local_unnamed_addr #2
@@ -87,7 +87,7 @@ for.exit.L6:                                      ; preds = %for.head.L6
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private void @_Z9printDataIPiEvlPi(i64 noundef %0, ptr noundef %1) #0 {
+define private void @_Z9printDataIPiEvlS0_(i64 noundef %0, ptr noundef %1) #0 {
   %arrayLength = alloca i64, align 8
   %list = alloca ptr, align 8
   %i = alloca i64, align 8
@@ -150,7 +150,7 @@ define dso_local noundef i32 @main() #2 {
   %10 = load [2 x i32], ptr %1, align 4
   store [2 x i32] %10, ptr %resultList, align 4
   %11 = getelementptr inbounds [2 x i32], ptr %resultList, i64 0, i32 0
-  call void @_Z9printDataIPiEvlPi(i64 noundef 2, ptr noundef %11)
+  call void @_Z9printDataIPiEvlS0_(i64 noundef 2, ptr noundef %11)
   %12 = load i32, ptr %result1, align 4
   %13 = load i32, ptr %result2, align 4
   %14 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.1, i32 noundef %12, i32 noundef %13)
@@ -6,7 +6,7 @@ source_filename = "source.spice"
 @printf.str.0 = private unnamed_addr constant [24 x i8] c"All assertions passed!\0A\00", align 4
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private void @_Z3fooIRiEvRi(ptr noundef %0) #0 {
+define private void @_Z3fooIRiEvS0_(ptr noundef %0) #0 {
   %t = alloca ptr, align 8
   store ptr %0, ptr %t, align 8
   %2 = load ptr, ptr %t, align 8
@@ -33,7 +33,7 @@ define dso_local noundef i32 @main() #1 {
   %t = alloca i32, align 4
   store i32 0, ptr %result, align 4
   store i32 1, ptr %t, align 4
-  call void @_Z3fooIRiEvRi(ptr noundef %t)
+  call void @_Z3fooIRiEvS0_(ptr noundef %t)
   %1 = load i32, ptr %t, align 4
   %2 = icmp eq i32 %1, 3
   br i1 %2, label %assert.exit.L13, label %assert.then.L13, !prof !5
@@ -29,7 +29,7 @@ define private void @_ZN20ExampleContainedType4ctorEv(ptr noundef nonnull align
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private void @_ZN20ExampleContainedType4ctorERK20ExampleContainedType(ptr noundef nonnull align 4 dereferenceable(4) %0, ptr noundef %1) #0 {
+define private void @_ZN20ExampleContainedType4ctorERKS_(ptr noundef nonnull align 4 dereferenceable(4) %0, ptr noundef %1) #0 {
   %this = alloca ptr, align 8
   %other = alloca ptr, align 8
   store ptr %0, ptr %this, align 8
@@ -83,12 +83,12 @@ define private noundef %struct.Pair @_ZN19ExampleTypeIteratorI20ExampleContained
   store ptr %0, ptr %this, align 8
   %3 = load ptr, ptr %this, align 8
   %item.addr = getelementptr inbounds %struct.ExampleTypeIterator, ptr %3, i64 0, i32 1
-  call void @_ZN4PairImR20ExampleContainedTypeE4ctorEmR20ExampleContainedType(ptr noundef nonnull align 8 dereferenceable(16) %2, i64 noundef 0, ptr noundef %item.addr)
+  call void @_ZN4PairImR20ExampleContainedTypeE4ctorEmS1_(ptr noundef nonnull align 8 dereferenceable(16) %2, i64 noundef 0, ptr noundef %item.addr)
   %4 = load %struct.Pair, ptr %2, align 8
   ret %struct.Pair %4
 }
 
-declare void @_ZN4PairImR20ExampleContainedTypeE4ctorEmR20ExampleContainedType(ptr, i64, ptr)
+declare void @_ZN4PairImR20ExampleContainedTypeE4ctorEmS1_(ptr, i64, ptr)
 
 ; Function Attrs: noinline nounwind optnone uwtable
 define private noundef zeroext i1 @_ZN19ExampleTypeIteratorI20ExampleContainedTypeE7isValidEv(ptr noundef nonnull align 8 dereferenceable(16) %0) #0 {
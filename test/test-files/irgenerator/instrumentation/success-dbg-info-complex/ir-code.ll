@@ -515,13 +515,13 @@ attributes #2 = { cold noreturn nounwind }
 !25 = !DILocalVariable(name: "_argv", arg: 2, scope: !14, file: !5, line: 6, type: !18)
 !26 = !DILocation(line: 8, column: 22, scope: !14)
 !27 = !DILocalVariable(name: "vi", scope: !14, file: !5, line: 8, type: !28)
-!28 = !DICompositeType(tag: DW_TAG_structure_type, name: "Vector", scope: !5, file: !5, line: 26, size: 256, align: 8, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !29, identifier: "struct.Vector")
+!28 = !DICompositeType(tag: DW_TAG_structure_type, name: "Vector", scope: !5, file: !5, line: 41, size: 256, align: 8, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !29, identifier: "struct.Vector")
 !29 = !{!30, !32, !34}
-!30 = !DIDerivedType(tag: DW_TAG_member, name: "contents", scope: !28, file: !5, line: 27, baseType: !31, size: 64, offset: 64)
+!30 = !DIDerivedType(tag: DW_TAG_member, name: "contents", scope: !28, file: !5, line: 42, baseType: !31, size: 64, offset: 64)
 !31 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !17, size: 64)
-!32 = !DIDerivedType(tag: DW_TAG_member, name: "capacity", scope: !28, file: !5, line: 28, baseType: !33, size: 64, offset: 128)
+!32 = !DIDerivedType(tag: DW_TAG_member, name: "capacity", scope: !28, file: !5, line: 43, baseType: !33, size: 64, offset: 128)
 !33 = !DIBasicType(name: "unsigned long", size: 64, encoding: DW_ATE_unsigned)
-!34 = !DIDerivedType(tag: DW_TAG_member, name: "size", scope: !28, file: !5, line: 29, baseType: !33, size: 64, offset: 192)
+!34 = !DIDerivedType(tag: DW_TAG_member, name: "size", scope: !28, file: !5, line: 44, baseType: !33, size: 64, offset: 192)
 !35 = !DILocation(line: 9, column: 17, scope: !14)
 !36 = !DILocation(line: 10, column: 17, scope: !14)
 !37 = !DILocation(line: 11, column: 17, scope: !14)
@@ -530,11 +530,11 @@ attributes #2 = { cold noreturn nounwind }
 !40 = !{!"branch_weights", i32 1048575, i32 1}
 !41 = !DILocation(line: 15, column: 14, scope: !14)
 !42 = !DILocalVariable(name: "it", scope: !14, file: !5, line: 15, type: !43)
-!43 = !DICompositeType(tag: DW_TAG_structure_type, name: "VectorIterator", scope: !5, file: !5, line: 392, size: 192, align: 8, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !44, identifier: "struct.VectorIterator")
+!43 = !DICompositeType(tag: DW_TAG_structure_type, name: "VectorIterator", scope: !5, file: !5, line: 587, size: 192, align: 8, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !44, identifier: "struct.VectorIterator")
 !44 = !{!45, !47}
-!45 = !DIDerivedType(tag: DW_TAG_member, name: "vector", scope: !43, file: !5, line: 393, baseType: !46, size: 64, offset: 64)
+!45 = !DIDerivedType(tag: DW_TAG_member, name: "vector", scope: !43, file: !5, line: 588, baseType: !46, size: 64, offset: 64)
 !46 = !DIDerivedType(tag: DW_TAG_reference_type, baseType: !28, size: 64)
-!47 = !DIDerivedType(tag: DW_TAG_member, name: "cursor", scope: !43, file: !5, line: 394, baseType: !33, size: 64, offset: 128)
+!47 = !DIDerivedType(tag: DW_TAG_member, name: "cursor", scope: !43, file: !5, line: 589, baseType: !33, size: 64, offset: 128)
 !48 = !DILocation(line: 16, column: 12, scope: !14)
 !49 = !DILocation(line: 17, column: 12, scope: !14)
 !50 = !DILocation(line: 17, column: 24, scope: !14)
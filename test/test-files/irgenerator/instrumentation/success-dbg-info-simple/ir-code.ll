@@ -119,14 +119,14 @@ attributes #3 = { nofree nounwind }
 !29 = !DIDerivedType(tag: DW_TAG_member, name: "lng", scope: !27, file: !7, line: 4, baseType: !30, size: 64)
 !30 = !DIBasicType(name: "long", size: 64, encoding: DW_ATE_signed)
 !31 = !DIDerivedType(tag: DW_TAG_member, name: "str", scope: !27, file: !7, line: 5, baseType: !32, size: 192, align: 8, offset: 64)
-!32 = !DICompositeType(tag: DW_TAG_structure_type, name: "String", scope: !7, file: !7, line: 25, size: 192, align: 8, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !33, identifier: "struct.String")
+!32 = !DICompositeType(tag: DW_TAG_structure_type, name: "String", scope: !7, file: !7, line: 40, size: 192, align: 8, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !33, identifier: "struct.String")
 !33 = !{!34, !37, !39}
-!34 = !DIDerivedType(tag: DW_TAG_member, name: "contents", scope: !32, file: !7, line: 26, baseType: !35, size: 64)
+!34 = !DIDerivedType(tag: DW_TAG_member, name: "contents", scope: !32, file: !7, line: 41, baseType: !35, size: 64)
 !35 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !36, size: 64)
 !36 = !DIBasicType(name: "char", size: 8, encoding: DW_ATE_unsigned_char)
-!37 = !DIDerivedType(tag: DW_TAG_member, name: "capacity", scope: !32, file: !7, line: 27, baseType: !38, size: 64, offset: 64)
+!37 = !DIDerivedType(tag: DW_TAG_member, name: "capacity", scope: !32, file: !7, line: 42, baseType: !38, size: 64, offset: 64)
 !38 = !DIBasicType(name: "unsigned long", size: 64, encoding: DW_ATE_unsigned)
-!39 = !DIDerivedType(tag: DW_TAG_member, name: "length", scope: !32, file: !7, line: 28, baseType: !38, size: 64, offset: 128)
+!39 = !DIDerivedType(tag: DW_TAG_member, name: "length", scope: !32, file: !7, line: 43, baseType: !38, size: 64, offset: 128)
 !40 = !DIDerivedType(tag: DW_TAG_member, name: "i", scope: !27, file: !7, line: 6, baseType: !41, size: 32, offset: 256)
 !41 = !DIBasicType(name: "int", size: 32, encoding: DW_ATE_signed)
 !42 = !{}
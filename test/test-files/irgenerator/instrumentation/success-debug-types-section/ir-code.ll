@@ -0,0 +1,64 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+%struct.Point = type { i32, i32 }
+
+@printf.str.0 = private unnamed_addr constant [15 x i8] c"Point: %d, %d\0A\00", align 4, !dbg !0
+
+; Function Attrs: mustprogress noinline norecurse nounwind optnone uwtable
+define dso_local noundef i32 @main() #0 !dbg !14 {
+  %result = alloca i32, align 4
+  %p = alloca %struct.Point, align 4
+    #dbg_declare(ptr %result, !19, !DIExpression(), !20)
+  store i32 0, ptr %result, align 4, !dbg !20
+  store %struct.Point { i32 3, i32 4 }, ptr %p, align 4, !dbg !21
+    #dbg_declare(ptr %p, !22, !DIExpression(), !21)
+  %x.addr = getelementptr inbounds %struct.Point, ptr %p, i64 0, i32 0, !dbg !27
+  %1 = load i32, ptr %x.addr, align 4, !dbg !27
+  %y.addr = getelementptr inbounds %struct.Point, ptr %p, i64 0, i32 1, !dbg !28
+  %2 = load i32, ptr %y.addr, align 4, !dbg !28
+  %3 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 noundef %1, i32 noundef %2), !dbg !28
+  %4 = load i32, ptr %result, align 4, !dbg !29
+  ret i32 %4, !dbg !29
+}
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr noundef readonly captures(none), ...) local_unnamed_addr #1
+
+attributes #0 = { mustprogress noinline norecurse nounwind optnone uwtable }
+attributes #1 = { nofree nounwind }
+
+!llvm.module.flags = !{!7, !8, !9, !10, !11, !12}
+!llvm.ident = !{!13}
+!llvm.dbg.cu = !{!2}
+
+!0 = !DIGlobalVariableExpression(var: !1, expr: !DIExpression())
+!1 = distinct !DIGlobalVariable(name: "printf.str.0", linkageName: "printf.str.0", scope: !2, file: !5, line: 10, type: !6, isLocal: true, isDefinition: true)
+!2 = distinct !DICompileUnit(language: DW_LANG_C_plus_plus_14, file: !3, producer: "spice version dev (https://github.com/spicelang/spice)", isOptimized: false, runtimeVersion: 0, emissionKind: FullDebug, globals: !4, splitDebugInlining: false, nameTableKind: None)
+!3 = !DIFile(filename: "/home/marc/Documents/Dev/spice/cmake-build-debug/test/./test-files/irgenerator/instrumentation/success-debug-types-section/source.spice", directory: "./test-files/irgenerator/instrumentation/success-debug-types-section")
+!4 = !{!0}
+!5 = !DIFile(filename: "source.spice", directory: "./test-files/irgenerator/instrumentation/success-debug-types-section")
+!6 = !DIStringType(name: "printf.str.0", size: 120)
+!7 = !{i32 8, !"PIC Level", i32 2}
+!8 = !{i32 7, !"PIE Level", i32 2}
+!9 = !{i32 7, !"uwtable", i32 2}
+!10 = !{i32 7, !"frame-pointer", i32 2}
+!11 = !{i32 7, !"Dwarf Version", i32 5}
+!12 = !{i32 2, !"Debug Info Version", i32 3}
+!13 = !{!"spice version dev (https://github.com/spicelang/spice)"}
+!14 = distinct !DISubprogram(name: "main", linkageName: "_Z4mainv", scope: !5, file: !5, line: 8, type: !15, scopeLine: 8, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition, unit: !2, retainedNodes: !18)
+!15 = !DISubroutineType(types: !16)
+!16 = !{!17}
+!17 = !DIBasicType(name: "int", size: 32, encoding: DW_ATE_signed)
+!18 = !{}
+!19 = !DILocalVariable(name: "result", scope: !14, file: !5, line: 8, type: !17)
+!20 = !DILocation(line: 8, column: 1, scope: !14)
+!21 = !DILocation(line: 9, column: 25, scope: !14)
+!22 = !DILocalVariable(name: "p", scope: !14, file: !5, line: 9, type: !23)
+!23 = !DICompositeType(tag: DW_TAG_structure_type, name: "Point", scope: !5, file: !5, line: 3, size: 64, align: 4, flags: DIFlagTypePassByReference | DIFlagNonTrivial, elements: !24, identifier: "struct.Point")
+!24 = !{!25, !26}
+!25 = !DIDerivedType(tag: DW_TAG_member, name: "x", scope: !23, file: !5, line: 4, baseType: !17, size: 32)
+!26 = !DIDerivedType(tag: DW_TAG_member, name: "y", scope: !23, file: !5, line: 5, baseType: !17, size: 32, offset: 32)
+!27 = !DILocation(line: 10, column: 31, scope: !14)
+!28 = !DILocation(line: 10, column: 36, scope: !14)
+!29 = !DILocation(line: 11, column: 1, scope: !14)
@@ -0,0 +1,50 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+%struct.Point = type { i32, i32 }
+
+@printf.str.0 = private unnamed_addr constant [15 x i8] c"Point: %d, %d\0A\00", align 4
+
+; Function Attrs: mustprogress noinline norecurse nounwind optnone uwtable
+define dso_local noundef i32 @main() #0 !dbg !9 {
+  %result = alloca i32, align 4
+  %p = alloca %struct.Point, align 4
+  store i32 0, ptr %result, align 4, !dbg !13
+  store %struct.Point { i32 3, i32 4 }, ptr %p, align 4, !dbg !14
+  %x.addr = getelementptr inbounds %struct.Point, ptr %p, i64 0, i32 0, !dbg !15
+  %1 = load i32, ptr %x.addr, align 4, !dbg !15
+  %y.addr = getelementptr inbounds %struct.Point, ptr %p, i64 0, i32 1, !dbg !16
+  %2 = load i32, ptr %y.addr, align 4, !dbg !16
+  %3 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 noundef %1, i32 noundef %2), !dbg !16
+  %4 = load i32, ptr %result, align 4, !dbg !17
+  ret i32 %4, !dbg !17
+}
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr noundef readonly captures(none), ...) local_unnamed_addr #1
+
+attributes #0 = { mustprogress noinline norecurse nounwind optnone uwtable }
+attributes #1 = { nofree nounwind }
+
+!llvm.module.flags = !{!0, !1, !2, !3, !4, !5}
+!llvm.ident = !{!6}
+!llvm.dbg.cu = !{!7}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{i32 7, !"Dwarf Version", i32 5}
+!5 = !{i32 2, !"Debug Info Version", i32 3}
+!6 = !{!"spice version dev (https://github.com/spicelang/spice)"}
+!7 = distinct !DICompileUnit(language: DW_LANG_C_plus_plus_14, file: !8, producer: "spice version dev (https://github.com/spicelang/spice)", isOptimized: false, runtimeVersion: 0, emissionKind: LineTablesOnly, splitDebugInlining: false, nameTableKind: None)
+!8 = !DIFile(filename: "/home/marc/Documents/Dev/spice/cmake-build-debug/test/./test-files/irgenerator/instrumentation/success-line-tables-only/source.spice", directory: "./test-files/irgenerator/instrumentation/success-line-tables-only")
+!9 = distinct !DISubprogram(name: "main", linkageName: "_Z4mainv", scope: !10, file: !10, line: 8, type: !11, scopeLine: 8, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition, unit: !7, retainedNodes: !12)
+!10 = !DIFile(filename: "source.spice", directory: "./test-files/irgenerator/instrumentation/success-line-tables-only")
+!11 = !DISubroutineType(types: !12)
+!12 = !{}
+!13 = !DILocation(line: 8, column: 1, scope: !9)
+!14 = !DILocation(line: 9, column: 25, scope: !9)
+!15 = !DILocation(line: 10, column: 31, scope: !9)
+!16 = !DILocation(line: 10, column: 36, scope: !9)
+!17 = !DILocation(line: 11, column: 1, scope: !9)
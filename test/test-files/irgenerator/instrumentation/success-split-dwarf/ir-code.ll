@@ -0,0 +1,54 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+@printf.str.0 = private unnamed_addr constant [11 x i8] c"Value: %d\0A\00", align 4, !dbg !0
+
+; Function Attrs: mustprogress noinline norecurse nounwind optnone uwtable
+define dso_local noundef i32 @main() #0 !dbg !14 {
+  %result = alloca i32, align 4
+  %i = alloca i32, align 4
+    #dbg_declare(ptr %result, !19, !DIExpression(), !20)
+  store i32 0, ptr %result, align 4, !dbg !20
+    #dbg_declare(ptr %i, !21, !DIExpression(), !22)
+  store i32 123, ptr %i, align 4, !dbg !22
+  %1 = load i32, ptr %i, align 4, !dbg !23
+  %2 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 noundef %1), !dbg !23
+  %3 = load i32, ptr %result, align 4, !dbg !24
+  ret i32 %3, !dbg !24
+}
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr noundef readonly captures(none), ...) local_unnamed_addr #1
+
+attributes #0 = { mustprogress noinline norecurse nounwind optnone uwtable }
+attributes #1 = { nofree nounwind }
+
+!llvm.module.flags = !{!7, !8, !9, !10, !11, !12}
+!llvm.ident = !{!13}
+!llvm.dbg.cu = !{!2}
+
+!0 = !DIGlobalVariableExpression(var: !1, expr: !DIExpression())
+!1 = distinct !DIGlobalVariable(name: "printf.str.0", linkageName: "printf.str.0", scope: !2, file: !5, line: 5, type: !6, isLocal: true, isDefinition: true)
+!2 = distinct !DICompileUnit(language: DW_LANG_C_plus_plus_14, file: !3, producer: "spice version dev (https://github.com/spicelang/spice)", isOptimized: false, runtimeVersion: 0, splitDebugFilename: "./test-tmp/instrumentation_successSplitDwarf/source.dwo", emissionKind: FullDebug, globals: !4, splitDebugInlining: false, nameTableKind: None)
+!3 = !DIFile(filename: "/home/marc/Documents/Dev/spice/cmake-build-debug/test/./test-files/irgenerator/instrumentation/success-split-dwarf/source.spice", directory: "./test-files/irgenerator/instrumentation/success-split-dwarf")
+!4 = !{!0}
+!5 = !DIFile(filename: "source.spice", directory: "./test-files/irgenerator/instrumentation/success-split-dwarf")
+!6 = !DIStringType(name: "printf.str.0", size: 88)
+!7 = !{i32 8, !"PIC Level", i32 2}
+!8 = !{i32 7, !"PIE Level", i32 2}
+!9 = !{i32 7, !"uwtable", i32 2}
+!10 = !{i32 7, !"frame-pointer", i32 2}
+!11 = !{i32 7, !"Dwarf Version", i32 5}
+!12 = !{i32 2, !"Debug Info Version", i32 3}
+!13 = !{!"spice version dev (https://github.com/spicelang/spice)"}
+!14 = distinct !DISubprogram(name: "main", linkageName: "_Z4mainv", scope: !5, file: !5, line: 3, type: !15, scopeLine: 3, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition, unit: !2, retainedNodes: !18)
+!15 = !DISubroutineType(types: !16)
+!16 = !{!17}
+!17 = !DIBasicType(name: "int", size: 32, encoding: DW_ATE_signed)
+!18 = !{}
+!19 = !DILocalVariable(name: "result", scope: !14, file: !5, line: 3, type: !17)
+!20 = !DILocation(line: 3, column: 1, scope: !14)
+!21 = !DILocalVariable(name: "i", scope: !14, file: !5, line: 4, type: !17)
+!22 = !DILocation(line: 4, column: 13, scope: !14)
+!23 = !DILocation(line: 5, column: 27, scope: !14)
+!24 = !DILocation(line: 6, column: 1, scope: !14)
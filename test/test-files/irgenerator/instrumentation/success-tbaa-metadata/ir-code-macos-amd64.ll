@@ -44,4 +44,4 @@ attributes #1 = { nofree nounwind }
 !9 = !{!"omnipotent byte", !10, i64 0}
 !10 = !{!"Simple Spice TBAA"}
 !11 = !{!12, !12, i64 0}
-!12 = !{!"unsigned long", !9, i64 0}
+!12 = !{!"long", !9, i64 0}
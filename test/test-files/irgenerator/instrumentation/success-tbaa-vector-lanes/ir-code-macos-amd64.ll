@@ -0,0 +1,51 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+@printf.str.0 = private unnamed_addr constant [14 x i8] c"Lanes: %d, %d\00", align 4
+
+; Function Attrs: mustprogress noinline norecurse nounwind optnone uwtable
+define dso_local noundef i32 @main() #0 {
+  %result = alloca i32, align 4, !type !5
+  %i = alloca i32, align 4, !type !5
+  %v = alloca <4 x i32>, align 16, !type !6
+  store i32 0, ptr %result, align 4, !tbaa !7
+  store i32 7, ptr %i, align 4, !tbaa !7
+  %1 = load i32, ptr %i, align 4, !tbaa !7
+  %.splatinsert = insertelement <4 x i32> poison, i32 %1, i64 0
+  %.splat = shufflevector <4 x i32> %.splatinsert, <4 x i32> poison, <4 x i32> zeroinitializer
+  store <4 x i32> %.splat, ptr %v, align 16
+  %2 = load <4 x i32>, ptr %v, align 16
+  %3 = extractelement <4 x i32> %2, i32 2
+  %4 = getelementptr inbounds i32, ptr %v, i32 2
+  store i32 42, ptr %4, align 4
+  %5 = load <4 x i32>, ptr %v, align 16
+  %6 = extractelement <4 x i32> %5, i32 0
+  %7 = getelementptr inbounds i32, ptr %v, i32 0
+  %8 = load <4 x i32>, ptr %v, align 16
+  %9 = extractelement <4 x i32> %8, i32 2
+  %10 = getelementptr inbounds i32, ptr %v, i32 2
+  %11 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 noundef %6, i32 noundef %9)
+  %12 = load i32, ptr %result, align 4
+  ret i32 %12
+}
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr noundef readonly captures(none), ...) local_unnamed_addr #1
+
+attributes #0 = { mustprogress noinline norecurse nounwind optnone uwtable }
+attributes #1 = { nofree nounwind }
+
+!llvm.module.flags = !{!0, !1, !2, !3}
+!llvm.ident = !{!4}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{!"spice version dev (https://github.com/spicelang/spice)"}
+!5 = !{i64 5535379567501308475, !"int"}
+!6 = !{i64 7567880400053087983, !"int<4>"}
+!7 = !{!8, !8, i64 0}
+!8 = !{!"int", !9, i64 0}
+!9 = !{!"omnipotent byte", !10, i64 0}
+!10 = !{!"Simple Spice TBAA"}
@@ -2,7 +2,7 @@
 source_filename = "source.spice"
 
 %struct.Thread = type { %struct.Lambda, i64 }
-%struct.Lambda = type { { ptr, ptr, i64 }, ptr, i64 }
+%struct.Lambda = type { { ptr, ptr, i64 }, ptr, i64, [3 x i64] }
 
 @COUNTER = private global i32 0
 @llvm.used = appending global [1 x ptr] [ptr @tsan.module_ctor], section "llvm.metadata"
@@ -55,20 +55,20 @@ define dso_local noundef i32 @main() #1 {
   %3 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %fat.ptr, i32 0, i32 2
   store i64 0, ptr %3, align 8
   %4 = load { ptr, ptr, i64 }, ptr %fat.ptr, align 8
-  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(48) %thread1, { ptr, ptr, i64 } noundef %4)
+  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(72) %thread1, { ptr, ptr, i64 } noundef %4)
   store ptr @_Z6workerv.fatthunk, ptr %fat.ptr1, align 8
   %5 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %fat.ptr1, i32 0, i32 1
   store ptr null, ptr %5, align 8
   %6 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %fat.ptr1, i32 0, i32 2
   store i64 0, ptr %6, align 8
   %7 = load { ptr, ptr, i64 }, ptr %fat.ptr1, align 8
-  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(48) %thread2, { ptr, ptr, i64 } noundef %7)
-  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(48) %thread1)
-  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(48) %thread2)
-  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(48) %thread1)
-  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(48) %thread2)
-  call void @_ZN6Thread4dtorEv(ptr noundef nonnull align 8 dereferenceable(48) %thread2)
-  call void @_ZN6Thread4dtorEv(ptr noundef nonnull align 8 dereferenceable(48) %thread1)
+  call void @_ZN6Thread4ctorEPFvE(ptr noundef nonnull align 8 dereferenceable(72) %thread2, { ptr, ptr, i64 } noundef %7)
+  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(72) %thread1)
+  call void @_ZN6Thread3runEv(ptr noundef nonnull align 8 dereferenceable(72) %thread2)
+  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(72) %thread1)
+  call void @_ZN6Thread4joinEv(ptr noundef nonnull align 8 dereferenceable(72) %thread2)
+  call void @_ZN6Thread4dtorEv(ptr noundef nonnull align 8 dereferenceable(72) %thread2)
+  call void @_ZN6Thread4dtorEv(ptr noundef nonnull align 8 dereferenceable(72) %thread1)
   %8 = load i32, ptr %result, align 4
   call void @__tsan_func_exit()
   ret i32 %8
@@ -90,7 +90,7 @@ declare void @_ZN6Thread3runEv(ptr)
 
 declare void @_ZN6Thread4joinEv(ptr)
 
-declare void @_ZN6Thread4dtorEv(ptr noundef nonnull align 8 dereferenceable(48))
+declare void @_ZN6Thread4dtorEv(ptr noundef nonnull align 8 dereferenceable(72))
 
 declare void @__tsan_init()
 
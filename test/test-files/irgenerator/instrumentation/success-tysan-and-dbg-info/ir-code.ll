@@ -130,7 +130,7 @@ attributes #2 = { nounwind }
 !32 = !DIBasicType(name: "double", size: 64, encoding: DW_ATE_float)
 !33 = !DILocation(line: 6, column: 37, scope: !30)
 !34 = !{!35, !35, i64 0}
-!35 = !{!"double*", !22, i64 0}
+!35 = !{!"any pointer", !22, i64 0}
 !36 = !DILocation(line: 7, column: 9, scope: !30)
 !37 = !{!38, !38, i64 0}
 !38 = !{!"double", !22, i64 0}
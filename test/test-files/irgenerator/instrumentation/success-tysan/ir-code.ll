@@ -106,6 +106,6 @@ attributes #2 = { nounwind }
 !12 = !{!13, !13, i64 0}
 !13 = !{!"long", !10, i64 0}
 !14 = !{!15, !15, i64 0}
-!15 = !{!"double*", !10, i64 0}
+!15 = !{!"any pointer", !10, i64 0}
 !16 = !{!17, !17, i64 0}
 !17 = !{!"double", !10, i64 0}
@@ -0,0 +1,154 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+%struct.Square = type { %interface.Shape, i32 }
+%interface.Shape = type { ptr }
+%struct.Dog = type { %interface.Animal, i1 }
+%interface.Animal = type { ptr }
+%struct.Bird = type { %interface.Animal, i1 }
+
+@_ZTS5Shape = private constant [7 x i8] c"5Shape\00", align 4
+@_ZTV8TypeInfo = external global ptr
+@_ZTI5Shape = private constant { ptr, ptr } { ptr getelementptr inbounds (ptr, ptr @_ZTV8TypeInfo, i64 2), ptr @_ZTS5Shape }, align 8
+@_ZTV5Shape = private unnamed_addr constant { [3 x ptr] } { [3 x ptr] [ptr null, ptr @_ZTI5Shape, ptr null] }, align 8
+@_ZTS6Square = private constant [8 x i8] c"6Square\00", align 4
+@_ZTI6Square = private constant { ptr, ptr, ptr } { ptr getelementptr inbounds (ptr, ptr @_ZTV8TypeInfo, i64 2), ptr @_ZTS6Square, ptr @_ZTI5Shape }, align 8
+@_ZTV6Square = private unnamed_addr constant { [3 x ptr] } { [3 x ptr] [ptr null, ptr @_ZTI6Square, ptr @_ZN6Square7cornersEv] }, align 8
+@_ZTS6Animal = private constant [8 x i8] c"6Animal\00", align 4
+@_ZTI6Animal = private constant { ptr, ptr } { ptr getelementptr inbounds (ptr, ptr @_ZTV8TypeInfo, i64 2), ptr @_ZTS6Animal }, align 8
+@_ZTV6Animal = private unnamed_addr constant { [3 x ptr] } { [3 x ptr] [ptr null, ptr @_ZTI6Animal, ptr null] }, align 8
+@_ZTS3Dog = private constant [5 x i8] c"3Dog\00", align 4
+@_ZTI3Dog = private constant { ptr, ptr, ptr } { ptr getelementptr inbounds (ptr, ptr @_ZTV8TypeInfo, i64 2), ptr @_ZTS3Dog, ptr @_ZTI6Animal }, align 8
+@_ZTV3Dog = private unnamed_addr constant { [3 x ptr] } { [3 x ptr] [ptr null, ptr @_ZTI3Dog, ptr @_ZN3Dog4legsEv] }, align 8
+@_ZTS4Bird = private constant [6 x i8] c"4Bird\00", align 4
+@_ZTI4Bird = private constant { ptr, ptr, ptr } { ptr getelementptr inbounds (ptr, ptr @_ZTV8TypeInfo, i64 2), ptr @_ZTS4Bird, ptr @_ZTI6Animal }, align 8
+@_ZTV4Bird = private unnamed_addr constant { [3 x ptr] } { [3 x ptr] [ptr null, ptr @_ZTI4Bird, ptr @_ZN4Bird4legsEv] }, align 8
+@printf.str.0 = private unnamed_addr constant [13 x i8] c"Corners: %d\0A\00", align 4
+@printf.str.1 = private unnamed_addr constant [14 x i8] c"Legs: %d, %d\0A\00", align 4
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private void @_ZN6Square4ctorEi(ptr noundef nonnull align 8 dereferenceable(16) %0, i32 noundef %1) #0 {
+  %this = alloca ptr, align 8
+  %size = alloca i32, align 4
+  store ptr %0, ptr %this, align 8
+  store i32 %1, ptr %size, align 4
+  %3 = load ptr, ptr %this, align 8
+  store ptr getelementptr inbounds ({ [3 x ptr] }, ptr @_ZTV6Square, i64 0, i32 0, i32 2), ptr %3, align 8
+  %4 = getelementptr inbounds nuw %struct.Square, ptr %3, i32 0, i32 1
+  store i32 0, ptr %4, align 4
+  %5 = load ptr, ptr %this, align 8
+  %size.addr = getelementptr inbounds %struct.Square, ptr %5, i64 0, i32 1
+  %6 = load i32, ptr %size, align 4
+  store i32 %6, ptr %size.addr, align 4
+  ret void
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private noundef i32 @_ZN6Square7cornersEv(ptr noundef nonnull align 8 dereferenceable(16) %0) #0 {
+  %result = alloca i32, align 4
+  %this = alloca ptr, align 8
+  store ptr %0, ptr %this, align 8
+  ret i32 4
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private void @_ZN3Dog4ctorEv(ptr noundef nonnull align 8 dereferenceable(16) %0) #0 {
+  %this = alloca ptr, align 8
+  store ptr %0, ptr %this, align 8
+  %2 = load ptr, ptr %this, align 8
+  store ptr getelementptr inbounds ({ [3 x ptr] }, ptr @_ZTV3Dog, i64 0, i32 0, i32 2), ptr %2, align 8
+  %3 = getelementptr inbounds nuw %struct.Dog, ptr %2, i32 0, i32 1
+  store i1 false, ptr %3, align 1
+  %4 = load ptr, ptr %this, align 8
+  %good.addr = getelementptr inbounds %struct.Dog, ptr %4, i64 0, i32 1
+  store i1 true, ptr %good.addr, align 1
+  ret void
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private noundef i32 @_ZN3Dog4legsEv(ptr noundef nonnull align 8 dereferenceable(16) %0) #0 {
+  %result = alloca i32, align 4
+  %this = alloca ptr, align 8
+  store ptr %0, ptr %this, align 8
+  ret i32 4
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private void @_ZN4Bird4ctorEv(ptr noundef nonnull align 8 dereferenceable(16) %0) #0 {
+  %this = alloca ptr, align 8
+  store ptr %0, ptr %this, align 8
+  %2 = load ptr, ptr %this, align 8
+  store ptr getelementptr inbounds ({ [3 x ptr] }, ptr @_ZTV4Bird, i64 0, i32 0, i32 2), ptr %2, align 8
+  %3 = getelementptr inbounds nuw %struct.Bird, ptr %2, i32 0, i32 1
+  store i1 false, ptr %3, align 1
+  %4 = load ptr, ptr %this, align 8
+  %flying.addr = getelementptr inbounds %struct.Bird, ptr %4, i64 0, i32 1
+  store i1 true, ptr %flying.addr, align 1
+  ret void
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private noundef i32 @_ZN4Bird4legsEv(ptr noundef nonnull align 8 dereferenceable(16) %0) #0 {
+  %result = alloca i32, align 4
+  %this = alloca ptr, align 8
+  store ptr %0, ptr %this, align 8
+  ret i32 2
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private noundef i32 @_Z12countCornersP5Shape(ptr noundef nonnull align 8 dereferenceable(8) %0) #0 {
+  %result = alloca i32, align 4
+  %shape = alloca ptr, align 8
+  store ptr %0, ptr %shape, align 8
+  %2 = load ptr, ptr %shape, align 8
+  %3 = call noundef i32 @_ZN6Square7cornersEv(ptr noundef nonnull align 8 dereferenceable(8) %2)
+  ret i32 %3
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private noundef i32 @_Z9countLegsP6Animal(ptr noundef nonnull align 8 dereferenceable(8) %0) #0 {
+  %result = alloca i32, align 4
+  %animal = alloca ptr, align 8
+  store ptr %0, ptr %animal, align 8
+  %2 = load ptr, ptr %animal, align 8
+  %vtable.addr = load ptr, ptr %2, align 8
+  %vfct.addr = getelementptr inbounds ptr, ptr %vtable.addr, i64 0
+  %fct = load ptr, ptr %vfct.addr, align 8
+  %3 = call noundef i32 %fct(ptr noundef nonnull align 8 dereferenceable(8) %2)
+  ret i32 %3
+}
+
+; Function Attrs: mustprogress noinline norecurse nounwind optnone uwtable
+define dso_local noundef i32 @main() #1 {
+  %result = alloca i32, align 4
+  %square = alloca %struct.Square, align 8
+  %dog = alloca %struct.Dog, align 8
+  %bird = alloca %struct.Bird, align 8
+  store i32 0, ptr %result, align 4
+  call void @_ZN6Square4ctorEi(ptr noundef nonnull align 8 dereferenceable(16) %square, i32 noundef 3)
+  %1 = call noundef i32 @_Z12countCornersP5Shape(ptr noundef align 8 dereferenceable(8) %square)
+  %2 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 noundef %1)
+  call void @_ZN3Dog4ctorEv(ptr noundef nonnull align 8 dereferenceable(16) %dog)
+  call void @_ZN4Bird4ctorEv(ptr noundef nonnull align 8 dereferenceable(16) %bird)
+  %3 = call noundef i32 @_Z9countLegsP6Animal(ptr noundef align 8 dereferenceable(8) %dog)
+  %4 = call noundef i32 @_Z9countLegsP6Animal(ptr noundef align 8 dereferenceable(8) %bird)
+  %5 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.1, i32 noundef %3, i32 noundef %4)
+  %6 = load i32, ptr %result, align 4
+  ret i32 %6
+}
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr noundef readonly captures(none), ...) local_unnamed_addr #2
+
+attributes #0 = { noinline nounwind optnone uwtable }
+attributes #1 = { mustprogress noinline norecurse nounwind optnone uwtable }
+attributes #2 = { nofree nounwind }
+
+!llvm.module.flags = !{!0, !1, !2, !3}
+!llvm.ident = !{!4}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{!"spice version dev (https://github.com/spicelang/spice)"}
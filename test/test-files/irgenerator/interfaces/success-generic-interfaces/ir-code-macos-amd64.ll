@@ -10,7 +10,7 @@ source_filename = "source.spice"
 @_ZTV11CompareableIlE = private unnamed_addr constant { [3 x ptr] } { [3 x ptr] [ptr null, ptr @_ZTI11CompareableIlE, ptr null] }, align 8
 @_ZTS6Person = private constant [8 x i8] c"6Person\00", align 4
 @_ZTI6Person = private constant { ptr, ptr, ptr } { ptr getelementptr inbounds (ptr, ptr @_ZTV8TypeInfo, i64 2), ptr @_ZTS6Person, ptr @_ZTI11CompareableIlE }, align 8
-@_ZTV6Person = private unnamed_addr constant { [3 x ptr] } { [3 x ptr] [ptr null, ptr @_ZTI6Person, ptr @_ZN6Person7compareERKlRKl] }, align 8
+@_ZTV6Person = private unnamed_addr constant { [3 x ptr] } { [3 x ptr] [ptr null, ptr @_ZTI6Person, ptr @_ZN6Person7compareERKlS1_] }, align 8
 @0 = private unnamed_addr constant [1 x i8] zeroinitializer, align 4
 @1 = private unnamed_addr constant [1 x i8] zeroinitializer, align 4
 @anon.string.0 = private unnamed_addr constant [5 x i8] c"Mike\00", align 4
@@ -18,7 +18,7 @@ source_filename = "source.spice"
 @printf.str.0 = private unnamed_addr constant [3 x i8] c"%d\00", align 4
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private void @_ZN6Person4ctorEPKcPKcj(ptr noundef nonnull align 8 dereferenceable(32) %0, ptr noundef %1, ptr noundef %2, i32 noundef %3) #0 {
+define private void @_ZN6Person4ctorEPKcS1_j(ptr noundef nonnull align 8 dereferenceable(32) %0, ptr noundef %1, ptr noundef %2, i32 noundef %3) #0 {
   %this = alloca ptr, align 8
   %firstName = alloca ptr, align 8
   %lastName = alloca ptr, align 8
@@ -51,7 +51,7 @@ define private void @_ZN6Person4ctorEPKcPKcj(ptr noundef nonnull align 8 derefer
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private noundef i32 @_ZN6Person7compareERKlRKl(ptr noundef nonnull align 8 dereferenceable(32) %0, ptr noundef %1, ptr noundef %2) #0 {
+define private noundef i32 @_ZN6Person7compareERKlS1_(ptr noundef nonnull align 8 dereferenceable(32) %0, ptr noundef %1, ptr noundef %2) #0 {
   %result = alloca i32, align 4
   %this = alloca ptr, align 8
   %a = alloca ptr, align 8
@@ -92,10 +92,10 @@ define dso_local noundef i32 @main() #1 {
   %2 = alloca i64, align 8
   %isEqual = alloca i1, align 1
   store i32 0, ptr %result, align 4
-  call void @_ZN6Person4ctorEPKcPKcj(ptr noundef nonnull align 8 dereferenceable(32) %mike, ptr noundef @anon.string.0, ptr noundef @anon.string.1, i32 noundef 43)
+  call void @_ZN6Person4ctorEPKcS1_j(ptr noundef nonnull align 8 dereferenceable(32) %mike, ptr noundef @anon.string.0, ptr noundef @anon.string.1, i32 noundef 43)
   store i64 22, ptr %1, align 8
   store i64 22, ptr %2, align 8
-  %3 = call noundef i32 @_ZN6Person7compareERKlRKl(ptr noundef nonnull align 8 dereferenceable(32) %mike, ptr noundef %1, ptr noundef %2)
+  %3 = call noundef i32 @_ZN6Person7compareERKlS1_(ptr noundef nonnull align 8 dereferenceable(32) %mike, ptr noundef %1, ptr noundef %2)
   %4 = icmp eq i32 %3, 1
   store i1 %4, ptr %isEqual, align 1
   %5 = load i1, ptr %isEqual, align 1
@@ -23,7 +23,7 @@ define void @_ZN4Test4ctorEv(ptr noundef nonnull align 8 dereferenceable(8) %0)
 }
 
 ; Function Attrs: mustprogress noinline nounwind optnone uwtable
-define void @_ZN4Test4ctorERK4Test(ptr noundef nonnull align 8 dereferenceable(8) %0, ptr %1) #0 {
+define void @_ZN4Test4ctorERKS_(ptr noundef nonnull align 8 dereferenceable(8) %0, ptr %1) #0 {
   %this = alloca ptr, align 8
   store ptr %0, ptr %this, align 8
   %3 = load ptr, ptr %this, align 8
@@ -65,7 +65,7 @@ define dso_local noundef i32 @main() #4 {
   %tRef = alloca ptr, align 8
   store i32 0, ptr %result, align 4
   call void @_ZN4Test4ctorEv(ptr noundef nonnull align 8 dereferenceable(8) %t)
-  call void @_ZN4Test4ctorERK4Test(ptr noundef nonnull align 8 dereferenceable(8) %t1, ptr %t)
+  call void @_ZN4Test4ctorERKS_(ptr noundef nonnull align 8 dereferenceable(8) %t1, ptr %t)
   store ptr %t1, ptr %tRef, align 8
   %1 = load ptr, ptr %tRef, align 8
   call void @_Z3fooR5ITest(ptr noundef %1)
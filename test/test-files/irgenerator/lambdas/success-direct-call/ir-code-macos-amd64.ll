@@ -0,0 +1,122 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+@printf.str.0 = private unnamed_addr constant [16 x i8] c"%d, %d, %d, %d\0A\00", align 4
+
+; Function Attrs: mustprogress noinline norecurse nounwind optnone uwtable
+define dso_local noundef i32 @main() #0 {
+  %result = alloca i32, align 4
+  %z = alloca i32, align 4
+  %w = alloca i32, align 4
+  %captures = alloca { i32, i32 }, align 8
+  %fat.ptr = alloca { ptr, ptr, i64 }, align 8
+  %addBoth = alloca { ptr, ptr, i64 }, align 8
+  %fat.ptr1 = alloca { ptr, ptr, i64 }, align 8
+  %twice = alloca { ptr, ptr, i64 }, align 8
+  %fat.ptr2 = alloca { ptr, ptr, i64 }, align 8
+  %decrement = alloca { ptr, ptr, i64 }, align 8
+  %alias = alloca { ptr, ptr, i64 }, align 8
+  store i32 0, ptr %result, align 4
+  store i32 2, ptr %z, align 4
+  store i32 3, ptr %w, align 4
+  %1 = load i32, ptr %w, align 4
+  store i32 %1, ptr %captures, align 4
+  %2 = load i32, ptr %z, align 4
+  %3 = getelementptr inbounds nuw { i32, i32 }, ptr %captures, i32 0, i32 1
+  store i32 %2, ptr %3, align 4
+  store ptr @_Z14lambda.L6C27.0i, ptr %fat.ptr, align 8
+  %4 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %fat.ptr, i32 0, i32 1
+  store ptr %captures, ptr %4, align 8
+  %5 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %fat.ptr, i32 0, i32 2
+  store i64 8, ptr %5, align 8
+  %6 = load { ptr, ptr, i64 }, ptr %fat.ptr, align 8
+  store { ptr, ptr, i64 } %6, ptr %addBoth, align 8
+  store ptr @_Z14lambda.L9C25.0i, ptr %fat.ptr1, align 8
+  %7 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %fat.ptr1, i32 0, i32 1
+  store ptr null, ptr %7, align 8
+  %8 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %fat.ptr1, i32 0, i32 2
+  store i64 0, ptr %8, align 8
+  %9 = load { ptr, ptr, i64 }, ptr %fat.ptr1, align 8
+  store { ptr, ptr, i64 } %9, ptr %twice, align 8
+  store ptr @_Z15lambda.L12C29.0i, ptr %fat.ptr2, align 8
+  %10 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %fat.ptr2, i32 0, i32 1
+  store ptr null, ptr %10, align 8
+  %11 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %fat.ptr2, i32 0, i32 2
+  store i64 0, ptr %11, align 8
+  %12 = load { ptr, ptr, i64 }, ptr %fat.ptr2, align 8
+  store { ptr, ptr, i64 } %12, ptr %decrement, align 8
+  %13 = load { ptr, ptr, i64 }, ptr %decrement, align 8
+  store { ptr, ptr, i64 } %13, ptr %alias, align 8
+  %14 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %addBoth, i32 0, i32 1
+  %captures3 = load ptr, ptr %14, align 8
+  %15 = call i32 @_Z14lambda.L6C27.0i(ptr %captures3, i32 1)
+  %16 = call i32 @_Z14lambda.L9C25.0i(ptr poison, i32 2)
+  %17 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %decrement, i32 0, i32 1
+  %captures4 = load ptr, ptr %17, align 8
+  %fct = load ptr, ptr %decrement, align 8
+  %18 = call i32 %fct(ptr %captures4, i32 3)
+  %19 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %alias, i32 0, i32 1
+  %captures5 = load ptr, ptr %19, align 8
+  %fct6 = load ptr, ptr %alias, align 8
+  %20 = call i32 %fct6(ptr %captures5, i32 4)
+  %21 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 noundef %15, i32 noundef %16, i32 noundef %18, i32 noundef %20)
+  %22 = load i32, ptr %result, align 4
+  ret i32 %22
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private i32 @_Z14lambda.L6C27.0i(ptr noundef nonnull dereferenceable(8) %0, i32 %1) #1 {
+  %result = alloca i32, align 4
+  %captures = alloca ptr, align 8
+  %x = alloca i32, align 4
+  store ptr %0, ptr %captures, align 8
+  store i32 %1, ptr %x, align 4
+  %3 = load ptr, ptr %captures, align 8
+  %z = getelementptr inbounds nuw { i32, i32 }, ptr %3, i32 0, i32 1
+  %4 = load i32, ptr %x, align 4
+  %5 = load i32, ptr %z, align 4
+  %6 = add nsw i32 %4, %5
+  %7 = load i32, ptr %3, align 4
+  %8 = add nsw i32 %6, %7
+  ret i32 %8
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private i32 @_Z14lambda.L9C25.0i(ptr %0, i32 %1) #1 {
+  %result = alloca i32, align 4
+  %captures = alloca ptr, align 8
+  %x = alloca i32, align 4
+  store ptr %0, ptr %captures, align 8
+  store i32 %1, ptr %x, align 4
+  %3 = load i32, ptr %x, align 4
+  %4 = mul nsw i32 %3, 2
+  ret i32 %4
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private i32 @_Z15lambda.L12C29.0i(ptr %0, i32 %1) #1 {
+  %result = alloca i32, align 4
+  %captures = alloca ptr, align 8
+  %x = alloca i32, align 4
+  store ptr %0, ptr %captures, align 8
+  store i32 %1, ptr %x, align 4
+  %3 = load i32, ptr %x, align 4
+  %4 = sub nsw i32 %3, 1
+  ret i32 %4
+}
+
+; Function Attrs: nofree nounwind
+declare noundef i32 @printf(ptr noundef readonly captures(none), ...) local_unnamed_addr #2
+
+attributes #0 = { mustprogress noinline norecurse nounwind optnone uwtable }
+attributes #1 = { noinline nounwind optnone uwtable }
+attributes #2 = { nofree nounwind }
+
+!llvm.module.flags = !{!0, !1, !2, !3}
+!llvm.ident = !{!4}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{!"spice version dev (https://github.com/spicelang/spice)"}
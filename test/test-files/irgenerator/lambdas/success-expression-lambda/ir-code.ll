@@ -6,7 +6,7 @@ source_filename = "source.spice"
 @printf.str.1 = private unnamed_addr constant [2 x i8] c"\0A\00", align 4
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private void @_Z4swapRiRi(ptr noundef %0, ptr noundef %1) #0 {
+define private void @_Z4swapRiS_(ptr noundef %0, ptr noundef %1) #0 {
   %a = alloca ptr, align 8
   %b = alloca ptr, align 8
   %temp = alloca i32, align 4
@@ -80,7 +80,7 @@ if.then.L10:                                      ; preds = %for.body.L9
   %28 = add nsw i32 %27, 1
   %29 = load ptr, ptr %array, align 8
   %30 = getelementptr inbounds [10 x i32], ptr %29, i64 0, i32 %28
-  call void @_Z4swapRiRi(ptr noundef %26, ptr noundef %30)
+  call void @_Z4swapRiS_(ptr noundef %26, ptr noundef %30)
   br label %if.exit.L10
 
 if.exit.L10:                                      ; preds = %if.then.L10, %for.body.L9
@@ -7,7 +7,7 @@ source_filename = "source.spice"
 @printf.str.0 = private unnamed_addr constant [19 x i8] c"All tests passed!\0A\00", align 4
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private void @_Z4testPFCvRiEPFCbRiE({ ptr, ptr, i64 } noundef %0, { ptr, ptr, i64 } noundef %1) #0 {
+define private void @_Z4testPFCvRiEPFCbS_E({ ptr, ptr, i64 } noundef %0, { ptr, ptr, i64 } noundef %1) #0 {
   %l1 = alloca { ptr, ptr, i64 }, align 8
   %l2 = alloca { ptr, ptr, i64 }, align 8
   %x = alloca i32, align 4
@@ -99,7 +99,7 @@ define dso_local noundef i32 @main() #3 {
   store { ptr, ptr, i64 } %12, ptr %foo2, align 8
   %13 = load { ptr, ptr, i64 }, ptr %foo1, align 8
   %14 = load { ptr, ptr, i64 }, ptr %foo2, align 8
-  call void @_Z4testPFCvRiEPFCbRiE({ ptr, ptr, i64 } noundef %13, { ptr, ptr, i64 } noundef %14)
+  call void @_Z4testPFCvRiEPFCbS_E({ ptr, ptr, i64 } noundef %13, { ptr, ptr, i64 } noundef %14)
   %15 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.0)
   %16 = load i32, ptr %result, align 4
   ret i32 %16
@@ -62,7 +62,7 @@ define dso_local noundef i32 @main() #0 {
   %19 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %callbackWithArgs2, i32 0, i32 1
   %captures5 = load ptr, ptr %19, align 8
   call void @_ZN6String4ctorEPKc(ptr noundef nonnull align 8 dereferenceable(24) %2, ptr noundef @anon.string.3)
-  call void @_ZN6String4ctorERK6String(ptr noundef nonnull align 8 dereferenceable(24) %arg.copy, ptr %2)
+  call void @_ZN6String4ctorERKS_(ptr noundef nonnull align 8 dereferenceable(24) %arg.copy, ptr %2)
   %20 = load %struct.String, ptr %arg.copy, align 8
   %fct6 = load ptr, ptr %callbackWithArgs2, align 8
   %21 = call i16 %fct6(ptr %captures5, %struct.String %20, i16 321)
@@ -99,12 +99,12 @@ define private i1 @_Z14lambda.L7C50.0R6Stringd(ptr %0, ptr %1, double %2) #1 {
   store ptr %1, ptr %str, align 8
   store double %2, ptr %d, align 8
   %4 = load ptr, ptr %str, align 8
-  %5 = load ptr, ptr %4, align 8
+  %5 = call noundef ptr @_ZN6String6getRawEv(ptr noundef nonnull align 8 dereferenceable(24) %4)
   %6 = load double, ptr %d, align 8
   %7 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.1, ptr noundef %5, double noundef %6)
   %8 = load ptr, ptr %str, align 8
   %9 = call noundef ptr @_ZN6String6getRawEv(ptr noundef nonnull align 8 dereferenceable(24) %8)
-  %10 = call i1 @_Z10isRawEqualPKcPKc(ptr %9, ptr @anon.string.1)
+  %10 = call i1 @_Z10isRawEqualPKcS0_(ptr %9, ptr @anon.string.1)
   br i1 %10, label %land.1.L9C16, label %land.exit.L9C16
 
 land.1.L9C16:                                     ; preds = %3
@@ -119,7 +119,7 @@ land.exit.L9C16:                                  ; preds = %land.1.L9C16, %3
 
 declare ptr @_ZN6String6getRawEv(ptr)
 
-declare i1 @_Z10isRawEqualPKcPKc(ptr, ptr)
+declare i1 @_Z10isRawEqualPKcS0_(ptr, ptr)
 
 declare void @_ZN6String4ctorEPKc(ptr, ptr)
 
@@ -132,7 +132,7 @@ define private i16 @_Z15lambda.L13C49.06Strings(ptr %0, %struct.String %1, i16 %
   store ptr %0, ptr %captures, align 8
   store %struct.String %1, ptr %str, align 8
   store i16 %2, ptr %b, align 2
-  %4 = load ptr, ptr %str, align 8
+  %4 = call noundef ptr @_ZN6String6getRawEv(ptr noundef nonnull align 8 dereferenceable(24) %str)
   %5 = load i16, ptr %b, align 2
   %6 = sext i16 %5 to i32
   %7 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.3, ptr noundef %4, i32 noundef %6)
@@ -141,7 +141,7 @@ define private i16 @_Z15lambda.L13C49.06Strings(ptr %0, %struct.String %1, i16 %
   ret i16 %9
 }
 
-declare void @_ZN6String4ctorERK6String(ptr noundef nonnull align 8 dereferenceable(24), ptr)
+declare void @_ZN6String4ctorERKS_(ptr noundef nonnull align 8 dereferenceable(24), ptr)
 
 declare void @_ZN6String4dtorEv(ptr noundef nonnull align 8 dereferenceable(24))
 
@@ -55,7 +55,7 @@ define dso_local noundef i32 @main() #0 {
   %14 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %callbackWithArgs2, i32 0, i32 1
   %captures5 = load ptr, ptr %14, align 8
   call void @_ZN6String4ctorEPKc(ptr noundef nonnull align 8 dereferenceable(24) %2, ptr noundef @anon.string.1)
-  call void @_ZN6String4ctorERK6String(ptr noundef nonnull align 8 dereferenceable(24) %arg.copy, ptr %2)
+  call void @_ZN6String4ctorERKS_(ptr noundef nonnull align 8 dereferenceable(24) %arg.copy, ptr %2)
   %15 = load %struct.String, ptr %arg.copy, align 8
   %fct6 = load ptr, ptr %callbackWithArgs2, align 8
   call void %fct6(ptr %captures5, %struct.String %15, i1 false)
@@ -86,12 +86,14 @@ define private void @_Z14lambda.L7C44.0R6Stringd(ptr %0, ptr %1, double %2) #1 {
   store ptr %1, ptr %str, align 8
   store double %2, ptr %d, align 8
   %4 = load ptr, ptr %str, align 8
-  %5 = load ptr, ptr %4, align 8
+  %5 = call noundef ptr @_ZN6String6getRawEv(ptr noundef nonnull align 8 dereferenceable(24) %4)
   %6 = load double, ptr %d, align 8
   %7 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.1, ptr noundef %5, double noundef %6)
   ret void
 }
 
+declare ptr @_ZN6String6getRawEv(ptr)
+
 declare void @_ZN6String4ctorEPKc(ptr, ptr)
 
 ; Function Attrs: noinline nounwind optnone uwtable
@@ -102,14 +104,14 @@ define private void @_Z15lambda.L12C41.06Stringb(ptr %0, %struct.String %1, i1 %
   store ptr %0, ptr %captures, align 8
   store %struct.String %1, ptr %str, align 8
   store i1 %2, ptr %b, align 1
-  %4 = load ptr, ptr %str, align 8
+  %4 = call noundef ptr @_ZN6String6getRawEv(ptr noundef nonnull align 8 dereferenceable(24) %str)
   %5 = load i1, ptr %b, align 1
   %6 = zext i1 %5 to i32
   %7 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.2, ptr noundef %4, i32 noundef %6)
   ret void
 }
 
-declare void @_ZN6String4ctorERK6String(ptr noundef nonnull align 8 dereferenceable(24), ptr)
+declare void @_ZN6String4ctorERKS_(ptr noundef nonnull align 8 dereferenceable(24), ptr)
 
 declare void @_ZN6String4dtorEv(ptr noundef nonnull align 8 dereferenceable(24))
 
@@ -45,7 +45,7 @@ define private noundef i64 @_ZN7Counter8getValueEv(ptr noundef nonnull align 8 d
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private noundef %struct.Counter @_Z7op.plus7Counter7Counter(%struct.Counter noundef %0, %struct.Counter noundef %1) #0 {
+define private noundef %struct.Counter @_Z7op.plus7CounterS_(%struct.Counter noundef %0, %struct.Counter noundef %1) #0 {
   %result = alloca %struct.Counter, align 8
   %c1 = alloca %struct.Counter, align 8
   %c2 = alloca %struct.Counter, align 8
@@ -63,7 +63,7 @@ define private noundef %struct.Counter @_Z7op.plus7Counter7Counter(%struct.Count
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private noundef %struct.Counter @_Z8op.minus7Counter7Counter(%struct.Counter noundef %0, %struct.Counter noundef %1) #0 {
+define private noundef %struct.Counter @_Z8op.minus7CounterS_(%struct.Counter noundef %0, %struct.Counter noundef %1) #0 {
   %result = alloca %struct.Counter, align 8
   %c1 = alloca %struct.Counter, align 8
   %c2 = alloca %struct.Counter, align 8
@@ -81,7 +81,7 @@ define private noundef %struct.Counter @_Z8op.minus7Counter7Counter(%struct.Coun
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private noundef %struct.Counter @_Z6op.mul7Counter7Counter(%struct.Counter noundef %0, %struct.Counter noundef %1) #0 {
+define private noundef %struct.Counter @_Z6op.mul7CounterS_(%struct.Counter noundef %0, %struct.Counter noundef %1) #0 {
   %result = alloca %struct.Counter, align 8
   %c1 = alloca %struct.Counter, align 8
   %c2 = alloca %struct.Counter, align 8
@@ -99,7 +99,7 @@ define private noundef %struct.Counter @_Z6op.mul7Counter7Counter(%struct.Counte
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private noundef %struct.Counter @_Z6op.div7Counter7Counter(%struct.Counter noundef %0, %struct.Counter noundef %1) #0 {
+define private noundef %struct.Counter @_Z6op.div7CounterS_(%struct.Counter noundef %0, %struct.Counter noundef %1) #0 {
   %result = alloca %struct.Counter, align 8
   %c1 = alloca %struct.Counter, align 8
   %c2 = alloca %struct.Counter, align 8
@@ -117,7 +117,7 @@ define private noundef %struct.Counter @_Z6op.div7Counter7Counter(%struct.Counte
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private noundef %struct.Counter @_Z6op.shl7Counter7Counter(%struct.Counter noundef %0, %struct.Counter noundef %1) #0 {
+define private noundef %struct.Counter @_Z6op.shl7CounterS_(%struct.Counter noundef %0, %struct.Counter noundef %1) #0 {
   %result = alloca %struct.Counter, align 8
   %c1 = alloca %struct.Counter, align 8
   %c2 = alloca %struct.Counter, align 8
@@ -135,7 +135,7 @@ define private noundef %struct.Counter @_Z6op.shl7Counter7Counter(%struct.Counte
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private noundef %struct.Counter @_Z6op.shr7Counter7Counter(%struct.Counter noundef %0, %struct.Counter noundef %1) #0 {
+define private noundef %struct.Counter @_Z6op.shr7CounterS_(%struct.Counter noundef %0, %struct.Counter noundef %1) #0 {
   %result = alloca %struct.Counter, align 8
   %c1 = alloca %struct.Counter, align 8
   %c2 = alloca %struct.Counter, align 8
@@ -153,7 +153,7 @@ define private noundef %struct.Counter @_Z6op.shr7Counter7Counter(%struct.Counte
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private void @_Z12op.plusequalR7Counter7Counter(ptr noundef %0, %struct.Counter noundef %1) #0 {
+define private void @_Z12op.plusequalR7CounterS_(ptr noundef %0, %struct.Counter noundef %1) #0 {
   %c1 = alloca ptr, align 8
   %c2 = alloca %struct.Counter, align 8
   store ptr %0, ptr %c1, align 8
@@ -169,7 +169,7 @@ define private void @_Z12op.plusequalR7Counter7Counter(ptr noundef %0, %struct.C
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private void @_Z13op.minusequalR7Counter7Counter(ptr noundef %0, %struct.Counter noundef %1) #0 {
+define private void @_Z13op.minusequalR7CounterS_(ptr noundef %0, %struct.Counter noundef %1) #0 {
   %c1 = alloca ptr, align 8
   %c2 = alloca %struct.Counter, align 8
   store ptr %0, ptr %c1, align 8
@@ -185,7 +185,7 @@ define private void @_Z13op.minusequalR7Counter7Counter(ptr noundef %0, %struct.
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private void @_Z11op.mulequalR7Counter7Counter(ptr noundef %0, %struct.Counter noundef %1) #0 {
+define private void @_Z11op.mulequalR7CounterS_(ptr noundef %0, %struct.Counter noundef %1) #0 {
   %c1 = alloca ptr, align 8
   %c2 = alloca %struct.Counter, align 8
   store ptr %0, ptr %c1, align 8
@@ -201,7 +201,7 @@ define private void @_Z11op.mulequalR7Counter7Counter(ptr noundef %0, %struct.Co
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private void @_Z11op.divequalR7Counter7Counter(ptr noundef %0, %struct.Counter noundef %1) #0 {
+define private void @_Z11op.divequalR7CounterS_(ptr noundef %0, %struct.Counter noundef %1) #0 {
   %c1 = alloca ptr, align 8
   %c2 = alloca %struct.Counter, align 8
   store ptr %0, ptr %c1, align 8
@@ -256,54 +256,54 @@ define dso_local noundef i32 @main() #1 {
   %4 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.1, i64 noundef %3)
   %5 = load %struct.Counter, ptr %counter1, align 8
   %6 = load %struct.Counter, ptr %counter2, align 8
-  %7 = call %struct.Counter @_Z7op.plus7Counter7Counter(%struct.Counter %5, %struct.Counter %6)
+  %7 = call %struct.Counter @_Z7op.plus7CounterS_(%struct.Counter %5, %struct.Counter %6)
   store %struct.Counter %7, ptr %counter3, align 8
   %8 = call noundef i64 @_ZN7Counter8getValueEv(ptr noundef nonnull align 8 dereferenceable(8) %counter3)
   %9 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.2, i64 noundef %8)
   %10 = load %struct.Counter, ptr %counter3, align 8
   %11 = load %struct.Counter, ptr %counter2, align 8
-  %12 = call %struct.Counter @_Z8op.minus7Counter7Counter(%struct.Counter %10, %struct.Counter %11)
+  %12 = call %struct.Counter @_Z8op.minus7CounterS_(%struct.Counter %10, %struct.Counter %11)
   store %struct.Counter %12, ptr %counter4, align 8
   %13 = call noundef i64 @_ZN7Counter8getValueEv(ptr noundef nonnull align 8 dereferenceable(8) %counter4)
   %14 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.3, i64 noundef %13)
   %15 = load %struct.Counter, ptr %counter4, align 8
   %16 = load %struct.Counter, ptr %counter2, align 8
-  %17 = call %struct.Counter @_Z6op.mul7Counter7Counter(%struct.Counter %15, %struct.Counter %16)
+  %17 = call %struct.Counter @_Z6op.mul7CounterS_(%struct.Counter %15, %struct.Counter %16)
   store %struct.Counter %17, ptr %counter5, align 8
   %18 = call noundef i64 @_ZN7Counter8getValueEv(ptr noundef nonnull align 8 dereferenceable(8) %counter5)
   %19 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.4, i64 noundef %18)
   %20 = load %struct.Counter, ptr %counter5, align 8
   %21 = load %struct.Counter, ptr %counter2, align 8
-  %22 = call %struct.Counter @_Z6op.div7Counter7Counter(%struct.Counter %20, %struct.Counter %21)
+  %22 = call %struct.Counter @_Z6op.div7CounterS_(%struct.Counter %20, %struct.Counter %21)
   store %struct.Counter %22, ptr %counter6, align 8
   %23 = call noundef i64 @_ZN7Counter8getValueEv(ptr noundef nonnull align 8 dereferenceable(8) %counter6)
   %24 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.5, i64 noundef %23)
   %25 = load %struct.Counter, ptr %counter6, align 8
   %26 = load %struct.Counter, ptr %counter2, align 8
-  %27 = call %struct.Counter @_Z6op.shl7Counter7Counter(%struct.Counter %25, %struct.Counter %26)
+  %27 = call %struct.Counter @_Z6op.shl7CounterS_(%struct.Counter %25, %struct.Counter %26)
   store %struct.Counter %27, ptr %counter7, align 8
   %28 = call noundef i64 @_ZN7Counter8getValueEv(ptr noundef nonnull align 8 dereferenceable(8) %counter7)
   %29 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.6, i64 noundef %28)
   %30 = load %struct.Counter, ptr %counter7, align 8
   %31 = load %struct.Counter, ptr %counter2, align 8
-  %32 = call %struct.Counter @_Z6op.shr7Counter7Counter(%struct.Counter %30, %struct.Counter %31)
+  %32 = call %struct.Counter @_Z6op.shr7CounterS_(%struct.Counter %30, %struct.Counter %31)
   store %struct.Counter %32, ptr %counter8, align 8
   %33 = call noundef i64 @_ZN7Counter8getValueEv(ptr noundef nonnull align 8 dereferenceable(8) %counter8)
   %34 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.7, i64 noundef %33)
   %35 = load %struct.Counter, ptr %counter2, align 8
-  call void @_Z12op.plusequalR7Counter7Counter(ptr %counter8, %struct.Counter %35)
+  call void @_Z12op.plusequalR7CounterS_(ptr %counter8, %struct.Counter %35)
   %36 = call noundef i64 @_ZN7Counter8getValueEv(ptr noundef nonnull align 8 dereferenceable(8) %counter8)
   %37 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.8, i64 noundef %36)
   %38 = load %struct.Counter, ptr %counter2, align 8
-  call void @_Z13op.minusequalR7Counter7Counter(ptr %counter8, %struct.Counter %38)
+  call void @_Z13op.minusequalR7CounterS_(ptr %counter8, %struct.Counter %38)
   %39 = call noundef i64 @_ZN7Counter8getValueEv(ptr noundef nonnull align 8 dereferenceable(8) %counter8)
   %40 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.9, i64 noundef %39)
   %41 = load %struct.Counter, ptr %counter2, align 8
-  call void @_Z11op.mulequalR7Counter7Counter(ptr %counter8, %struct.Counter %41)
+  call void @_Z11op.mulequalR7CounterS_(ptr %counter8, %struct.Counter %41)
   %42 = call noundef i64 @_ZN7Counter8getValueEv(ptr noundef nonnull align 8 dereferenceable(8) %counter8)
   %43 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.10, i64 noundef %42)
   %44 = load %struct.Counter, ptr %counter2, align 8
-  call void @_Z11op.divequalR7Counter7Counter(ptr %counter8, %struct.Counter %44)
+  call void @_Z11op.divequalR7CounterS_(ptr %counter8, %struct.Counter %44)
   %45 = call noundef i64 @_ZN7Counter8getValueEv(ptr noundef nonnull align 8 dereferenceable(8) %counter8)
   %46 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.11, i64 noundef %45)
   %47 = call ptr @_Z12op.subscriptR7Counterj(ptr %counter8, i32 12)
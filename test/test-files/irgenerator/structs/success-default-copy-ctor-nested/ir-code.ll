@@ -18,7 +18,7 @@ define private void @_ZN5Inner4ctorEv(ptr noundef nonnull align 2 dereferenceabl
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private void @_ZN5Inner4ctorERK5Inner(ptr noundef nonnull align 2 dereferenceable(2) %0, ptr noundef %1) #0 {
+define private void @_ZN5Inner4ctorERKS_(ptr noundef nonnull align 2 dereferenceable(2) %0, ptr noundef %1) #0 {
   %this = alloca ptr, align 8
   %other = alloca ptr, align 8
   store ptr %0, ptr %this, align 8
@@ -45,11 +45,11 @@ define void @_ZN6Middle4ctorEv(ptr noundef nonnull align 2 dereferenceable(2) %0
 }
 
 ; Function Attrs: mustprogress noinline nounwind optnone uwtable
-define void @_ZN6Middle4ctorERK6Middle(ptr noundef nonnull align 2 dereferenceable(2) %0, ptr %1) #1 {
+define void @_ZN6Middle4ctorERKS_(ptr noundef nonnull align 2 dereferenceable(2) %0, ptr %1) #1 {
   %this = alloca ptr, align 8
   store ptr %0, ptr %this, align 8
   %3 = load ptr, ptr %this, align 8
-  call void @_ZN5Inner4ctorERK5Inner(ptr noundef nonnull align 2 dereferenceable(2) %3, ptr %1)
+  call void @_ZN5Inner4ctorERKS_(ptr noundef nonnull align 2 dereferenceable(2) %3, ptr %1)
   ret void
 }
 
@@ -63,11 +63,11 @@ define void @_ZN5Outer4ctorEv(ptr noundef nonnull align 2 dereferenceable(2) %0)
 }
 
 ; Function Attrs: mustprogress noinline nounwind optnone uwtable
-define void @_ZN5Outer4ctorERK5Outer(ptr noundef nonnull align 2 dereferenceable(2) %0, ptr %1) #1 {
+define void @_ZN5Outer4ctorERKS_(ptr noundef nonnull align 2 dereferenceable(2) %0, ptr %1) #1 {
   %this = alloca ptr, align 8
   store ptr %0, ptr %this, align 8
   %3 = load ptr, ptr %this, align 8
-  call void @_ZN6Middle4ctorERK6Middle(ptr noundef nonnull align 2 dereferenceable(2) %3, ptr %1)
+  call void @_ZN6Middle4ctorERKS_(ptr noundef nonnull align 2 dereferenceable(2) %3, ptr %1)
   ret void
 }
 
@@ -84,7 +84,7 @@ define dso_local noundef i32 @main() #2 {
   %1 = load i16, ptr %x.addr, align 2
   %2 = sext i16 %1 to i32
   %3 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.0, i32 noundef %2)
-  call void @_ZN5Outer4ctorERK5Outer(ptr noundef nonnull align 2 dereferenceable(2) %outer2, ptr %outer)
+  call void @_ZN5Outer4ctorERKS_(ptr noundef nonnull align 2 dereferenceable(2) %outer2, ptr %outer)
   %middle.addr1 = getelementptr inbounds %struct.Outer, ptr %outer2, i64 0, i32 0
   %inner.addr2 = getelementptr inbounds %struct.Middle, ptr %middle.addr1, i64 0, i32 0
   %x.addr3 = getelementptr inbounds %struct.Inner, ptr %inner.addr2, i64 0, i32 0
@@ -13,7 +13,7 @@ declare ptr @malloc(i64 noundef)
 declare void @free(ptr noundef)
 
 ; Function Attrs: mustprogress noinline nounwind optnone uwtable
-define void @_ZN5Inner4ctorERK5Inner(ptr noundef nonnull align 8 dereferenceable(16) %0, ptr %1) #0 {
+define void @_ZN5Inner4ctorERKS_(ptr noundef nonnull align 8 dereferenceable(16) %0, ptr %1) #0 {
   %this = alloca ptr, align 8
   store ptr %0, ptr %this, align 8
   %3 = load ptr, ptr %this, align 8
@@ -40,7 +40,7 @@ declare void @llvm.memcpy.p0.p0.i64(ptr noalias writeonly captures(none), ptr no
 declare ptr @_Z12sAllocUnsafem(i64)
 
 ; Function Attrs: mustprogress noinline nounwind optnone uwtable
-define void @_ZN5Inner4ctorER5Inner(ptr noundef nonnull align 8 dereferenceable(16) %0, ptr %1) #0 {
+define void @_ZN5Inner4ctorERS_(ptr noundef nonnull align 8 dereferenceable(16) %0, ptr %1) #0 {
   %this = alloca ptr, align 8
   store ptr %0, ptr %this, align 8
   %3 = load ptr, ptr %this, align 8
@@ -93,20 +93,20 @@ define void @_ZN6Middle4ctorEv(ptr noundef nonnull align 8 dereferenceable(16) %
 }
 
 ; Function Attrs: mustprogress noinline nounwind optnone uwtable
-define void @_ZN6Middle4ctorERK6Middle(ptr noundef nonnull align 8 dereferenceable(16) %0, ptr %1) #0 {
+define void @_ZN6Middle4ctorERKS_(ptr noundef nonnull align 8 dereferenceable(16) %0, ptr %1) #0 {
   %this = alloca ptr, align 8
   store ptr %0, ptr %this, align 8
   %3 = load ptr, ptr %this, align 8
-  call void @_ZN5Inner4ctorERK5Inner(ptr noundef nonnull align 8 dereferenceable(16) %3, ptr %1)
+  call void @_ZN5Inner4ctorERKS_(ptr noundef nonnull align 8 dereferenceable(16) %3, ptr %1)
   ret void
 }
 
 ; Function Attrs: mustprogress noinline nounwind optnone uwtable
-define void @_ZN6Middle4ctorER6Middle(ptr noundef nonnull align 8 dereferenceable(16) %0, ptr %1) #0 {
+define void @_ZN6Middle4ctorERS_(ptr noundef nonnull align 8 dereferenceable(16) %0, ptr %1) #0 {
   %this = alloca ptr, align 8
   store ptr %0, ptr %this, align 8
   %3 = load ptr, ptr %this, align 8
-  call void @_ZN5Inner4ctorER5Inner(ptr noundef nonnull align 8 dereferenceable(16) %3, ptr %1)
+  call void @_ZN5Inner4ctorERS_(ptr noundef nonnull align 8 dereferenceable(16) %3, ptr %1)
   ret void
 }
 
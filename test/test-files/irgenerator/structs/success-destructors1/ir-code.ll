@@ -32,7 +32,7 @@ assert.exit.L8:                                   ; preds = %1
   %8 = load ptr, ptr %this, align 8
   %field2.addr = getelementptr inbounds %struct.Vector, ptr %8, i64 0, i32 1
   %9 = load ptr, ptr %field2.addr, align 8
-  %10 = call i1 @_Z10isRawEqualPKcPKc(ptr %9, ptr @anon.string.1)
+  %10 = call i1 @_Z10isRawEqualPKcS0_(ptr %9, ptr @anon.string.1)
   br i1 %10, label %assert.exit.L9, label %assert.then.L9, !prof !5
 
 assert.then.L9:                                   ; preds = %assert.exit.L8
@@ -53,7 +53,7 @@ declare i32 @memcmp(ptr, ptr, i64) #2
 ; Function Attrs: cold noreturn nounwind
 declare void @exit(i32) #3
 
-declare i1 @_Z10isRawEqualPKcPKc(ptr, ptr)
+declare i1 @_Z10isRawEqualPKcS0_(ptr, ptr)
 
 ; Function Attrs: mustprogress noinline norecurse nounwind optnone uwtable
 define dso_local noundef i32 @main() #4 {
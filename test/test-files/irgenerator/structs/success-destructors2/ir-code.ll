@@ -52,7 +52,7 @@ assert.exit.L13:                                  ; preds = %1
   %8 = load ptr, ptr %this, align 8
   %field2.addr = getelementptr inbounds %struct.Vector, ptr %8, i64 0, i32 1
   %9 = load ptr, ptr %field2.addr, align 8
-  %10 = call i1 @_Z10isRawEqualPKcPKc(ptr %9, ptr @anon.string.2)
+  %10 = call i1 @_Z10isRawEqualPKcS0_(ptr %9, ptr @anon.string.2)
   br i1 %10, label %assert.exit.L14, label %assert.then.L14, !prof !5
 
 assert.then.L14:                                  ; preds = %assert.exit.L13
@@ -70,7 +70,7 @@ declare i32 @memcmp(ptr, ptr, i64) #3
 ; Function Attrs: cold noreturn nounwind
 declare void @exit(i32) #4
 
-declare i1 @_Z10isRawEqualPKcPKc(ptr, ptr)
+declare i1 @_Z10isRawEqualPKcS0_(ptr, ptr)
 
 attributes #0 = { mustprogress noinline norecurse nounwind optnone uwtable }
 attributes #1 = { nofree nounwind }
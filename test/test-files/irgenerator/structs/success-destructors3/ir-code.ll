@@ -15,7 +15,7 @@ define private void @_Z4testv() #0 {
   call void @_ZN6String4ctorEPKc(ptr noundef nonnull align 8 dereferenceable(24) %1, ptr noundef @anon.string.0)
   store ptr %1, ptr %t, align 8
   %2 = load ptr, ptr %t, align 8
-  %3 = load ptr, ptr %2, align 8
+  %3 = call noundef ptr @_ZN6String6getRawEv(ptr noundef nonnull align 8 dereferenceable(24) %2)
   %4 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.0, ptr noundef %3)
   call void @_ZN6String4dtorEv(ptr noundef nonnull align 8 dereferenceable(24) %1)
   ret void
@@ -23,6 +23,8 @@ define private void @_Z4testv() #0 {
 
 declare void @_ZN6String4ctorEPKc(ptr, ptr)
 
+declare ptr @_ZN6String6getRawEv(ptr)
+
 ; Function Attrs: nofree nounwind
 declare noundef i32 @printf(ptr noundef readonly captures(none), ...) local_unnamed_addr #1
 
@@ -33,7 +35,7 @@ define private void @_Z4testRK6String(ptr noundef %0) #0 {
   %t = alloca ptr, align 8
   store ptr %0, ptr %t, align 8
   %2 = load ptr, ptr %t, align 8
-  %3 = load ptr, ptr %2, align 8
+  %3 = call noundef ptr @_ZN6String6getRawEv(ptr noundef nonnull align 8 dereferenceable(24) %2)
   %4 = call noundef i32 (ptr, ...) @printf(ptr noundef @printf.str.1, ptr noundef %3)
   ret void
 }
@@ -56,7 +56,7 @@ define void @_ZN7Derived4ctorEv(ptr noundef nonnull align 8 dereferenceable(16)
 }
 
 ; Function Attrs: mustprogress noinline nounwind optnone uwtable
-define void @_ZN7Derived4ctorERK7Derived(ptr noundef nonnull align 8 dereferenceable(16) %0, ptr %1) #1 {
+define void @_ZN7Derived4ctorERKS_(ptr noundef nonnull align 8 dereferenceable(16) %0, ptr %1) #1 {
   %this = alloca ptr, align 8
   store ptr %0, ptr %this, align 8
   %3 = load ptr, ptr %this, align 8
@@ -19,7 +19,7 @@ define private void @_ZN4Test4ctorEv(ptr noundef nonnull align 1 %0) #0 {
 declare noundef i32 @printf(ptr noundef readonly captures(none), ...) local_unnamed_addr #1
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private void @_ZN4Test4ctorERK4Test(ptr noundef nonnull align 1 %0, ptr noundef %1) #0 {
+define private void @_ZN4Test4ctorERKS_(ptr noundef nonnull align 1 %0, ptr noundef %1) #0 {
   %this = alloca ptr, align 8
   %_ = alloca ptr, align 8
   store ptr %0, ptr %this, align 8
@@ -44,7 +44,7 @@ define private noundef %struct.Test @_Z3fooRK4Test(ptr noundef %0) #0 {
   %2 = alloca %struct.Test, align 8
   store ptr %0, ptr %t, align 8
   %3 = load ptr, ptr %t, align 8
-  call void @_ZN4Test4ctorERK4Test(ptr noundef nonnull align 1 %copy, ptr %3)
+  call void @_ZN4Test4ctorERKS_(ptr noundef nonnull align 1 %copy, ptr %3)
   br i1 false, label %cond.true.L12C12, label %cond.false.L12C12
 
 cond.true.L12C12:                                 ; preds = %1
@@ -56,7 +56,7 @@ cond.false.L12C12:                                ; preds = %1
 
 cond.exit.L12C12:                                 ; preds = %cond.false.L12C12, %cond.true.L12C12
   %cond.result = phi ptr [ %copy, %cond.true.L12C12 ], [ %4, %cond.false.L12C12 ]
-  call void @_ZN4Test4ctorERK4Test(ptr noundef nonnull align 1 %2, ptr %cond.result)
+  call void @_ZN4Test4ctorERKS_(ptr noundef nonnull align 1 %2, ptr %cond.result)
   %5 = load %struct.Test, ptr %2, align 1
   call void @_ZN4Test4dtorEv(ptr noundef nonnull align 1 %copy)
   ret %struct.Test %5
@@ -0,0 +1,96 @@
+; ModuleID = 'source.spice'
+source_filename = "source.spice"
+
+@benchName0 = private unnamed_addr constant [15 x i8] c"benchIncrement\00", align 4
+@fileName0 = private unnamed_addr constant [13 x i8] c"source.spice\00", align 4
+@benchName1 = private unnamed_addr constant [38 x i8] c"benchIncrementTwice (Increment twice)\00", align 4
+@fileName1 = private unnamed_addr constant [13 x i8] c"source.spice\00", align 4
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private noundef i32 @_Z9incrementi(i32 noundef %0) #0 {
+  %result = alloca i32, align 4
+  %value = alloca i32, align 4
+  store i32 %0, ptr %value, align 4
+  %2 = load i32, ptr %value, align 4
+  %3 = add nsw i32 %2, 1
+  ret i32 %3
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private void @_Z14benchIncrementv() #0 {
+  %1 = call noundef i32 @_Z9incrementi(i32 noundef 1)
+  ret void
+}
+
+; Function Attrs: noinline nounwind optnone uwtable
+define private void @_Z19benchIncrementTwicev() #0 {
+  %1 = call noundef i32 @_Z9incrementi(i32 noundef 1)
+  %2 = call noundef i32 @_Z9incrementi(i32 noundef 2)
+  ret void
+}
+
+; Function Attrs: mustprogress noinline nounwind optnone uwtable
+define i32 @main() #1 {
+  %1 = call ptr @__spice_bench_begin(i32 2)
+  call void @__spice_bench_start(ptr %1, ptr @benchName0, ptr @fileName0)
+  br label %bench.batch.head
+
+bench.batch.head:                                 ; preds = %bench.iter.head, %0
+  %2 = call i64 @__spice_bench_next_batch(ptr %1)
+  %3 = icmp eq i64 %2, 0
+  br i1 %3, label %bench.exit, label %bench.iter.head, !prof !5
+
+bench.iter.head:                                  ; preds = %bench.iter.body, %bench.batch.head
+  %bench.iteration = phi i64 [ 0, %bench.batch.head ], [ %5, %bench.iter.body ]
+  %4 = icmp uge i64 %bench.iteration, %2
+  br i1 %4, label %bench.batch.head, label %bench.iter.body, !prof !5
+
+bench.iter.body:                                  ; preds = %bench.iter.head
+  call void @_Z14benchIncrementv()
+  %5 = add i64 %bench.iteration, 1
+  br label %bench.iter.head
+
+bench.exit:                                       ; preds = %bench.batch.head
+  call void @__spice_bench_start(ptr %1, ptr @benchName1, ptr @fileName1)
+  br label %bench.batch.head1
+
+bench.batch.head1:                                ; preds = %bench.iter.head2, %bench.exit
+  %6 = call i64 @__spice_bench_next_batch(ptr %1)
+  %7 = icmp eq i64 %6, 0
+  br i1 %7, label %bench.exit5, label %bench.iter.head2, !prof !5
+
+bench.iter.head2:                                 ; preds = %bench.iter.body4, %bench.batch.head1
+  %bench.iteration3 = phi i64 [ 0, %bench.batch.head1 ], [ %9, %bench.iter.body4 ]
+  %8 = icmp uge i64 %bench.iteration3, %6
+  br i1 %8, label %bench.batch.head1, label %bench.iter.body4, !prof !5
+
+bench.iter.body4:                                 ; preds = %bench.iter.head2
+  call void @_Z19benchIncrementTwicev()
+  %9 = add i64 %bench.iteration3, 1
+  br label %bench.iter.head2
+
+bench.exit5:                                      ; preds = %bench.batch.head1
+  %10 = call i32 @__spice_bench_end(ptr %1)
+  ret i32 %10
+}
+
+declare ptr @__spice_bench_begin(i32)
+
+declare void @__spice_bench_start(ptr, ptr, ptr)
+
+declare i64 @__spice_bench_next_batch(ptr)
+
+declare i32 @__spice_bench_end(ptr)
+
+attributes #0 = { noinline nounwind optnone uwtable }
+attributes #1 = { mustprogress noinline nounwind optnone uwtable }
+
+!llvm.module.flags = !{!0, !1, !2, !3}
+!llvm.ident = !{!4}
+
+!0 = !{i32 8, !"PIC Level", i32 2}
+!1 = !{i32 7, !"PIE Level", i32 2}
+!2 = !{i32 7, !"uwtable", i32 2}
+!3 = !{i32 7, !"frame-pointer", i32 2}
+!4 = !{!"spice version dev (https://github.com/spicelang/spice)"}
+!5 = !{!"branch_weights", i32 1, i32 1048575}
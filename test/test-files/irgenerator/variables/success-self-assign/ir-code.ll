@@ -16,7 +16,7 @@ define private void @_ZN4Test4ctorEv(ptr noundef nonnull align 4 dereferenceable
 }
 
 ; Function Attrs: noinline nounwind optnone uwtable
-define private void @_ZN4Test4ctorERK4Test(ptr noundef nonnull align 4 dereferenceable(4) %0, ptr noundef %1) #0 {
+define private void @_ZN4Test4ctorERKS_(ptr noundef nonnull align 4 dereferenceable(4) %0, ptr noundef %1) #0 {
   %this = alloca ptr, align 8
   %other = alloca ptr, align 8
   store ptr %0, ptr %this, align 8
@@ -57,7 +57,7 @@ define dso_local noundef i32 @main() #1 {
 
 assign.copy:                                      ; preds = %0
   call void @_ZN4Test4dtorEv(ptr noundef nonnull align 4 dereferenceable(4) %t)
-  call void @_ZN4Test4ctorERK4Test(ptr noundef nonnull align 4 dereferenceable(4) %t, ptr %t)
+  call void @_ZN4Test4ctorERKS_(ptr noundef nonnull align 4 dereferenceable(4) %t, ptr %t)
   br label %assign.copy.end
 
 assign.copy.end:                                  ; preds = %assign.copy, %0
@@ -66,17 +66,17 @@ define private void @_Z8activate14GtkApplicationPh(%struct.GtkApplication nounde
   %6 = load ptr, ptr %5, align 8
   call void @_ZN6String4ctorEPKc(ptr noundef nonnull align 8 dereferenceable(24) %filePathString, ptr noundef %6)
   store ptr @anon.string.2, ptr %3, align 8
-  call void @_Z12op.plusequalIPKcEvR6StringRKPKc(ptr %filePathString, ptr %3)
+  call void @_Z12op.plusequalIPKcEvR6StringRKS1_(ptr %filePathString, ptr %3)
   call void @_ZN10GtkBuilder4ctorEv(ptr noundef nonnull align 8 dereferenceable(8) %builder)
   %7 = call noundef ptr @_ZN6String6getRawEv(ptr noundef nonnull align 8 dereferenceable(24) %filePathString)
   %8 = call noundef %struct.Result.0 @_ZN10GtkBuilder11addFromFileEPKc(ptr noundef nonnull align 8 dereferenceable(8) %builder, ptr noundef %7)
   store %struct.Result.0 %8, ptr %result, align 8
   %9 = call noundef ptr @_ZN6ResultIbE6unwrapEv(ptr noundef nonnull align 8 dereferenceable(24) %result)
-  %10 = call noundef %struct.GtkWindow @_ZN10GtkBuilder9getObjectI9GtkWindowEE9GtkWindowPKc(ptr noundef nonnull align 8 dereferenceable(8) %builder, ptr noundef @anon.string.3)
+  %10 = call noundef %struct.GtkWindow @_ZN10GtkBuilder9getObjectI9GtkWindowEES1_PKc(ptr noundef nonnull align 8 dereferenceable(8) %builder, ptr noundef @anon.string.3)
   store %struct.GtkWindow %10, ptr %window, align 8
   %11 = load %struct.GtkApplication, ptr %app, align 8
   call void @_ZN9GtkWindow14setApplicationE14GtkApplication(ptr noundef nonnull align 8 dereferenceable(8) %window, %struct.GtkApplication noundef %11)
-  %12 = call noundef %struct.GtkButton @_ZN10GtkBuilder9getObjectI9GtkButtonEE9GtkButtonPKc(ptr noundef nonnull align 8 dereferenceable(8) %builder, ptr noundef @anon.string.4)
+  %12 = call noundef %struct.GtkButton @_ZN10GtkBuilder9getObjectI9GtkButtonEES1_PKc(ptr noundef nonnull align 8 dereferenceable(8) %builder, ptr noundef @anon.string.4)
   store %struct.GtkButton %12, ptr %button1, align 8
   store ptr @_Z8btnClick9GtkWidget.fatthunk, ptr %fat.ptr, align 8
   %13 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %fat.ptr, i32 0, i32 1
@@ -85,7 +85,7 @@ define private void @_Z8activate14GtkApplicationPh(%struct.GtkApplication nounde
   store i64 0, ptr %14, align 8
   %15 = load { ptr, ptr, i64 }, ptr %fat.ptr, align 8
   call void @_ZN9GtkButton18setOnClickCallbackEPFv9GtkWidgetE(ptr noundef nonnull align 8 dereferenceable(8) %button1, { ptr, ptr, i64 } noundef %15)
-  %16 = call noundef %struct.GtkButton @_ZN10GtkBuilder9getObjectI9GtkButtonEE9GtkButtonPKc(ptr noundef nonnull align 8 dereferenceable(8) %builder, ptr noundef @anon.string.5)
+  %16 = call noundef %struct.GtkButton @_ZN10GtkBuilder9getObjectI9GtkButtonEES1_PKc(ptr noundef nonnull align 8 dereferenceable(8) %builder, ptr noundef @anon.string.5)
   store %struct.GtkButton %16, ptr %button2, align 8
   store ptr @_Z8btnClick9GtkWidget.fatthunk, ptr %fat.ptr1, align 8
   %17 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %fat.ptr1, i32 0, i32 1
@@ -94,7 +94,7 @@ define private void @_Z8activate14GtkApplicationPh(%struct.GtkApplication nounde
   store i64 0, ptr %18, align 8
   %19 = load { ptr, ptr, i64 }, ptr %fat.ptr1, align 8
   call void @_ZN9GtkButton18setOnClickCallbackEPFv9GtkWidgetE(ptr noundef nonnull align 8 dereferenceable(8) %button2, { ptr, ptr, i64 } noundef %19)
-  %20 = call noundef %struct.GtkButton @_ZN10GtkBuilder9getObjectI9GtkButtonEE9GtkButtonPKc(ptr noundef nonnull align 8 dereferenceable(8) %builder, ptr noundef @anon.string.6)
+  %20 = call noundef %struct.GtkButton @_ZN10GtkBuilder9getObjectI9GtkButtonEES1_PKc(ptr noundef nonnull align 8 dereferenceable(8) %builder, ptr noundef @anon.string.6)
   store %struct.GtkButton %20, ptr %quitButton, align 8
   store ptr @_Z4quit9GtkWidget9GtkWindow.fatthunk, ptr %fat.ptr2, align 8
   %21 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %fat.ptr2, i32 0, i32 1
@@ -103,7 +103,7 @@ define private void @_Z8activate14GtkApplicationPh(%struct.GtkApplication nounde
   store i64 0, ptr %22, align 8
   %23 = load { ptr, ptr, i64 }, ptr %fat.ptr2, align 8
   %24 = load %struct.GtkWindow, ptr %window, align 8
-  call void @_ZN9GtkButton18setOnClickCallbackI9GtkWindowEEvPFv9GtkWidget9GtkWindowE9GtkWindow(ptr noundef nonnull align 8 dereferenceable(8) %quitButton, { ptr, ptr, i64 } noundef %23, %struct.GtkWindow noundef %24)
+  call void @_ZN9GtkButton18setOnClickCallbackI9GtkWindowEEvPFv9GtkWidgetS1_ES1_(ptr noundef nonnull align 8 dereferenceable(8) %quitButton, { ptr, ptr, i64 } noundef %23, %struct.GtkWindow noundef %24)
   call void @_ZN9GtkWindow10setVisibleEv(ptr noundef nonnull align 8 dereferenceable(8) %window)
   call void @_ZN10GtkBuilder4dtorEv(ptr noundef nonnull align 8 dereferenceable(8) %builder)
   call void @_ZN6String4dtorEv(ptr noundef nonnull align 8 dereferenceable(24) %filePathString)
@@ -116,7 +116,7 @@ declare ptr @_ZN6ResultIPKcE6unwrapEv(ptr)
 
 declare void @_ZN6String4ctorEPKc(ptr, ptr)
 
-declare void @_Z12op.plusequalIPKcEvR6StringRKPKc(ptr, ptr)
+declare void @_Z12op.plusequalIPKcEvR6StringRKS1_(ptr, ptr)
 
 declare void @_ZN10GtkBuilder4ctorEv(ptr noundef nonnull align 8 dereferenceable(8))
 
@@ -126,11 +126,11 @@ declare %struct.Result.0 @_ZN10GtkBuilder11addFromFileEPKc(ptr, ptr)
 
 declare ptr @_ZN6ResultIbE6unwrapEv(ptr)
 
-declare %struct.GtkWindow @_ZN10GtkBuilder9getObjectI9GtkWindowEE9GtkWindowPKc(ptr, ptr)
+declare %struct.GtkWindow @_ZN10GtkBuilder9getObjectI9GtkWindowEES1_PKc(ptr, ptr)
 
 declare void @_ZN9GtkWindow14setApplicationE14GtkApplication(ptr, %struct.GtkApplication)
 
-declare %struct.GtkButton @_ZN10GtkBuilder9getObjectI9GtkButtonEE9GtkButtonPKc(ptr, ptr)
+declare %struct.GtkButton @_ZN10GtkBuilder9getObjectI9GtkButtonEES1_PKc(ptr, ptr)
 
 ; Function Attrs: noinline nounwind optnone uwtable
 define private void @_Z8btnClick9GtkWidget.fatthunk(ptr %0, %struct.GtkWidget %1) #0 {
@@ -148,7 +148,7 @@ entry:
   ret void
 }
 
-declare void @_ZN9GtkButton18setOnClickCallbackI9GtkWindowEEvPFv9GtkWidget9GtkWindowE9GtkWindow(ptr, { ptr, ptr, i64 }, %struct.GtkWindow)
+declare void @_ZN9GtkButton18setOnClickCallbackI9GtkWindowEEvPFv9GtkWidgetS1_ES1_(ptr, { ptr, ptr, i64 }, %struct.GtkWindow)
 
 declare void @_ZN9GtkWindow10setVisibleEv(ptr)
 
@@ -173,7 +173,7 @@ define dso_local noundef i32 @main(i32 %0, ptr %1) #1 {
   %4 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %fat.ptr, i32 0, i32 2
   store i64 0, ptr %4, align 8
   %5 = load { ptr, ptr, i64 }, ptr %fat.ptr, align 8
-  call void @_ZN14GtkApplication19setActivateCallbackEPFv14GtkApplicationPhE(ptr noundef nonnull align 8 dereferenceable(8) %app, { ptr, ptr, i64 } noundef %5)
+  call void @_ZN14GtkApplication19setActivateCallbackEPFvS_PhE(ptr noundef nonnull align 8 dereferenceable(8) %app, { ptr, ptr, i64 } noundef %5)
   %6 = load i32, ptr %argc, align 4
   %7 = load ptr, ptr %argv, align 8
   %8 = call noundef i32 @_ZN14GtkApplication3runEiPPKc(ptr noundef nonnull align 8 dereferenceable(8) %app, i32 noundef %6, ptr noundef %7)
@@ -190,7 +190,7 @@ entry:
   ret void
 }
 
-declare void @_ZN14GtkApplication19setActivateCallbackEPFv14GtkApplicationPhE(ptr, { ptr, ptr, i64 })
+declare void @_ZN14GtkApplication19setActivateCallbackEPFvS_PhE(ptr, { ptr, ptr, i64 })
 
 declare i32 @_ZN14GtkApplication3runEiPPKc(ptr, i32, ptr)
 
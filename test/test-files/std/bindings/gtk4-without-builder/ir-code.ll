@@ -64,7 +64,7 @@ define private void @_Z8activate14GtkApplicationPh(%struct.GtkApplication nounde
   store i64 0, ptr %6, align 8
   %7 = load { ptr, ptr, i64 }, ptr %fat.ptr, align 8
   %8 = load %struct.GtkWindow, ptr %window, align 8
-  call void @_ZN9GtkButton18setOnClickCallbackI9GtkWindowEEvPFv9GtkWidget9GtkWindowE9GtkWindow(ptr noundef nonnull align 8 dereferenceable(8) %btnCancel, { ptr, ptr, i64 } noundef %7, %struct.GtkWindow noundef %8)
+  call void @_ZN9GtkButton18setOnClickCallbackI9GtkWindowEEvPFv9GtkWidgetS1_ES1_(ptr noundef nonnull align 8 dereferenceable(8) %btnCancel, { ptr, ptr, i64 } noundef %7, %struct.GtkWindow noundef %8)
   %9 = load %struct.GtkButton, ptr %btnCancel, align 8
   call void @_ZN6GtkBox6appendE9GtkButton(ptr noundef nonnull align 8 dereferenceable(8) %box, %struct.GtkButton noundef %9)
   call void @_ZN9GtkButton4ctorEPKc(ptr noundef nonnull align 8 dereferenceable(8) %btnYes, ptr noundef @anon.string.3)
@@ -104,7 +104,7 @@ entry:
   ret void
 }
 
-declare void @_ZN9GtkButton18setOnClickCallbackI9GtkWindowEEvPFv9GtkWidget9GtkWindowE9GtkWindow(ptr, { ptr, ptr, i64 }, %struct.GtkWindow)
+declare void @_ZN9GtkButton18setOnClickCallbackI9GtkWindowEEvPFv9GtkWidgetS1_ES1_(ptr, { ptr, ptr, i64 }, %struct.GtkWindow)
 
 declare void @_ZN6GtkBox6appendE9GtkButton(ptr, %struct.GtkButton)
 
@@ -136,7 +136,7 @@ define dso_local noundef i32 @main(i32 %0, ptr %1) #1 {
   %4 = getelementptr inbounds nuw { ptr, ptr, i64 }, ptr %fat.ptr, i32 0, i32 2
   store i64 0, ptr %4, align 8
   %5 = load { ptr, ptr, i64 }, ptr %fat.ptr, align 8
-  call void @_ZN14GtkApplication19setActivateCallbackEPFv14GtkApplicationPhE(ptr noundef nonnull align 8 dereferenceable(8) %app, { ptr, ptr, i64 } noundef %5)
+  call void @_ZN14GtkApplication19setActivateCallbackEPFvS_PhE(ptr noundef nonnull align 8 dereferenceable(8) %app, { ptr, ptr, i64 } noundef %5)
   %6 = load i32, ptr %argc, align 4
   %7 = load ptr, ptr %argv, align 8
   %8 = call noundef i32 @_ZN14GtkApplication3runEiPPKc(ptr noundef nonnull align 8 dereferenceable(8) %app, i32 noundef %6, ptr noundef %7)
@@ -153,7 +153,7 @@ entry:
   ret void
 }
 
-declare void @_ZN14GtkApplication19setActivateCallbackEPFv14GtkApplicationPhE(ptr, { ptr, ptr, i64 })
+declare void @_ZN14GtkApplication19setActivateCallbackEPFvS_PhE(ptr, { ptr, ptr, i64 })
 
 declare i32 @_ZN14GtkApplication3runEiPPKc(ptr, i32, ptr)
 
@@ -59,6 +59,8 @@ TEST(BlockAllocatorTest, BlockAllocatorLarge) {
     // Check if stats are correct
     ASSERT_EQ(NODE_COUNT, alloc.getAllocationCount());
     ASSERT_EQ(6'000'000, alloc.getTotalAllocatedSize());
+    ASSERT_EQ(NODE_COUNT * DUMMY_NODE_SIZE, alloc.getUsedSize());
+    ASSERT_EQ(25'000, alloc.getBlockCount());
 
     // Block Allocator gets destructed here and with that, all allocated nodes should be destructed
   }
@@ -78,6 +78,14 @@ TEST(CommonUtilTest, FormatBytes) {
   ASSERT_EQ("1.00 TB", CommonUtil::formatBytes(1024ull * 1024ull * 1024ull * 1024ull));
 }
 
+TEST(CommonUtilTest, FormatDuration) {
+  ASSERT_EQ("0.000 ms", CommonUtil::formatDuration(0ull));
+  ASSERT_EQ("0.001 ms", CommonUtil::formatDuration(1'000ull));
+  ASSERT_EQ("0.250 ms", CommonUtil::formatDuration(250'000ull));
+  ASSERT_EQ("12.346 ms", CommonUtil::formatDuration(12'345'678ull));
+  ASSERT_EQ("90000.000 ms", CommonUtil::formatDuration(90'000'000'000ull));
+}
+
 TEST(CommonUtilTest, DemangleTypeName) {
   // Successful cases
   ASSERT_EQ("int", CommonUtil::demangleTypeName(typeid(int).name()));
@@ -377,6 +377,68 @@ TEST_F(CompileCacheTest, MultiFileDependencyChangeForcesRecompilation) {
   ASSERT_FALSE(lookup(main));
 }
 
+// With split DWARF, the object file only holds skeleton compile units, that point to the .dwo file by its output path. A cache
+// hit has to put the .dwo file back there, otherwise debuggers would not find the debug info of the restored object file.
+TEST_F(CompileCacheTest, SplitDwarfFileIsRestoredOnCacheHit) {
+  cliOptions.targetTriple = llvm::Triple(llvm::Triple::normalize(llvm::sys::getProcessTriple()));
+  cliOptions.isNativeTarget = true;
+  cliOptions.instrumentation.generateDebugInfo = true;
+  cliOptions.instrumentation.splitDwarf = true;
+
+  const std::filesystem::path mainPath = outputDir / "main.spice";
+  writeDummyFile(mainPath, "");
+
+  GlobalResourceManager resourceManager(cliOptions);
+  CacheManager &manager = resourceManager.cacheManager;
+  SourceFile *main = resourceManager.createSourceFile(nullptr, "main", mainPath, false);
+  main->cacheKey = manager.computeCacheKey("f<int> main() { return 0; }");
+
+  const std::filesystem::path dwoPath = main->getSplitDwarfFilePath();
+  ASSERT_EQ(outputDir / "main.dwo", dwoPath);
+  writeDummyFile(outputDir / "main.o", "main-obj");
+  writeDummyFile(dwoPath, "main-dwo");
+  manager.cacheSourceFile(main);
+
+  // The .dwo file gets restored from the cache
+  std::filesystem::remove(dwoPath);
+  ASSERT_TRUE(manager.lookupSourceFile(main));
+  ASSERT_TRUE(std::filesystem::exists(dwoPath));
+  std::ifstream dwoFile(dwoPath);
+  std::string dwoContent;
+  std::getline(dwoFile, dwoContent);
+  ASSERT_EQ("main-dwo", dwoContent);
+
+  // Without the cached .dwo file, the entry is incomplete and must miss
+  std::filesystem::remove(cacheDir / (main->cacheKey + ".dwo"));
+  main->cachedObjectFilePaths.clear();
+  ASSERT_FALSE(manager.lookupSourceFile(main));
+}
+
+// With LTO, only the main source file emits an object file, so the compile units of all source files have to reference
+// the .dwo file, that is written next to it.
+TEST_F(CompileCacheTest, SplitDwarfFileOfMainFileIsUsedWithLTO) {
+  cliOptions.targetTriple = llvm::Triple(llvm::Triple::normalize(llvm::sys::getProcessTriple()));
+  cliOptions.isNativeTarget = true;
+  cliOptions.instrumentation.generateDebugInfo = true;
+  cliOptions.instrumentation.splitDwarf = true;
+
+  const std::filesystem::path mainPath = outputDir / "main.spice";
+  const std::filesystem::path utilsPath = outputDir / "utils.spice";
+  writeDummyFile(mainPath, "");
+  writeDummyFile(utilsPath, "");
+
+  GlobalResourceManager resourceManager(cliOptions);
+  SourceFile *main = resourceManager.createSourceFile(nullptr, "main", mainPath, false);
+  SourceFile *utils = resourceManager.createSourceFile(main, "utils", utilsPath, false);
+  utils->isMainFile = false;
+
+  cliOptions.useLTO = false;
+  ASSERT_EQ(outputDir / "utils.dwo", utils->getSplitDwarfFilePath());
+  cliOptions.useLTO = true;
+  ASSERT_EQ(outputDir / "main.dwo", utils->getSplitDwarfFilePath());
+  ASSERT_EQ(outputDir / "main.dwo", main->getSplitDwarfFilePath());
+}
+
 // Provokes the bug that was fixed: before transitive dep cache keys were folded into a
 // file's own cache key, a dependent whose source text was unchanged would keep cache-hitting
 // against a stale object file even when one of its dependencies had been edited - causing
@@ -5,6 +5,8 @@
 #include <driver/Driver.h>
 #include <exception/CliError.h>
 
+#include <llvm/Support/CommandLine.h>
+
 // LCOV_EXCL_START
 
 namespace spice::testing {
@@ -30,6 +32,13 @@ TEST(DriverTest, BuildSubcommandMinimal) {
   ASSERT_FALSE(cliOptions.generateTestMain);
   ASSERT_FALSE(cliOptions.testMode);
   ASSERT_FALSE(cliOptions.noEntryFct);
+  ASSERT_FALSE(cliOptions.useTBAAMetadata);
+  ASSERT_FALSE(cliOptions.useRefParamAttrs);
+  ASSERT_FALSE(cliOptions.devirtualize);
+  ASSERT_FALSE(cliOptions.directLambdaCalls);
+  ASSERT_FALSE(cliOptions.timeTrace);
+  ASSERT_EQ(50, cliOptions.timeTraceGranularity);
+  ASSERT_FALSE(cliOptions.dump.dumpMemoryStats);
 }
 
 TEST(DriverTest, BuildSubcommandComplex) {
@@ -38,6 +47,7 @@ TEST(DriverTest, BuildSubcommandComplex) {
       "b",
       "-d",
       "-ir",
+      "--dump-memory-stats",
       "-g",
       "-Os",
       "-m",
@@ -70,7 +80,12 @@ TEST(DriverTest, BuildSubcommandComplex) {
   ASSERT_TRUE(cliOptions.useLTO);                                      // -lto
   ASSERT_TRUE(cliOptions.printDebugOutput);                            // -d
   ASSERT_TRUE(cliOptions.dump.dumpIR);                                 // -ir
+  ASSERT_TRUE(cliOptions.dump.dumpMemoryStats);                        // --dump-memory-stats
   ASSERT_TRUE(cliOptions.useLifetimeMarkers);                          // implicitly due to enabled address sanitizer
+  ASSERT_TRUE(cliOptions.useTBAAMetadata);                             // implicitly due to -Os
+  ASSERT_TRUE(cliOptions.useRefParamAttrs);                            // implicitly due to -Os
+  ASSERT_TRUE(cliOptions.devirtualize);                                // implicitly due to -Os
+  ASSERT_TRUE(cliOptions.directLambdaCalls);                           // implicitly due to -Os
 }
 
 TEST(DriverTest, RunSubcommandMinimal) {
@@ -94,7 +109,7 @@ TEST(DriverTest, RunSubcommandMinimal) {
 }
 
 TEST(DriverTest, RunSubcommandComplex) {
-  const char *argv[] = {"spice", "r", "-O2", "-j", "8", "-ast", "../../media/test-project/test.spice"};
+  const char *argv[] = {"spice", "r", "-O2", "-j", "8", "-ast", "--time-trace", "--time-trace-granularity", "200", "../../media/test-project/test.spice"};
   static constexpr int argc = std::size(argv);
   CliOptions cliOptions;
   Driver driver(cliOptions, true);
@@ -111,8 +126,10 @@ TEST(DriverTest, RunSubcommandComplex) {
   ASSERT_FALSE(cliOptions.generateTestMain);
   ASSERT_FALSE(cliOptions.testMode);
   ASSERT_FALSE(cliOptions.noEntryFct);
-  ASSERT_EQ(8, cliOptions.compileJobCount); // -j 8
-  ASSERT_TRUE(cliOptions.dump.dumpAST);     // -ast
+  ASSERT_EQ(8, cliOptions.compileJobCount);        // -j 8
+  ASSERT_TRUE(cliOptions.dump.dumpAST);            // -ast
+  ASSERT_TRUE(cliOptions.timeTrace);               // --time-trace
+  ASSERT_EQ(200, cliOptions.timeTraceGranularity); // --time-trace-granularity 200
 }
 
 TEST(DriverTest, TestSubcommandMinimal) {
@@ -158,6 +175,26 @@ TEST(DriverTest, TestSubcommandComplex) {
   ASSERT_EQ(Sanitizer::THREAD, cliOptions.instrumentation.sanitizer); // --sanitizer=thread
 }
 
+TEST(DriverTest, BenchSubcommandMinimal) {
+  const char *argv[] = {"spice", "bench", "../../media/test-project/test.spice"};
+  static constexpr int argc = std::size(argv);
+  CliOptions cliOptions;
+  Driver driver(cliOptions, true);
+  ASSERT_EQ(EXIT_SUCCESS, driver.parse(argc, argv));
+  driver.enrich();
+
+  ASSERT_TRUE(driver.shouldCompile);
+  ASSERT_FALSE(driver.shouldInstall);
+  ASSERT_FALSE(driver.shouldUninstall);
+  ASSERT_TRUE(driver.shouldExecute);
+  ASSERT_TRUE(cliOptions.execute);
+  ASSERT_EQ(OptLevel::O2, cliOptions.optLevel);
+  ASSERT_EQ(BuildMode::RELEASE, cliOptions.buildMode);
+  ASSERT_TRUE(cliOptions.generateBenchMain);
+  ASSERT_FALSE(cliOptions.generateTestMain);
+  ASSERT_TRUE(cliOptions.noEntryFct);
+}
+
 TEST(DriverTest, InstallSubcommandMinimal) {
   const char *argv[] = {"spice", "install", "../../media/test-project/test.spice"};
   static constexpr int argc = std::size(argv);
@@ -220,6 +257,62 @@ TEST(DriverTest, MemorySanitizerOnlyLinux) {
 #endif
 }
 
+TEST(DriverTest, ReducedDebugInfoModes) {
+  const char *argv[] = {"spice", "build", "-gline-tables-only", "-gsplit-dwarf", "--target=x86_64-pc-linux-gnu",
+                        "../../media/test-project/test.spice"};
+  static constexpr int argc = std::size(argv);
+  CliOptions cliOptions;
+  Driver driver(cliOptions, true);
+  ASSERT_EQ(EXIT_SUCCESS, driver.parse(argc, argv));
+  driver.enrich();
+
+  ASSERT_TRUE(cliOptions.instrumentation.debugInfoLineTablesOnly); // -gline-tables-only
+  ASSERT_TRUE(cliOptions.instrumentation.splitDwarf);              // -gsplit-dwarf
+  ASSERT_FALSE(cliOptions.instrumentation.debugTypeUnits);
+  ASSERT_TRUE(cliOptions.instrumentation.generateDebugInfo); // implicitly due to reduced debug info modes
+}
+
+TEST(DriverTest, SplitDwarfOnlyElf) {
+  const char *argv[] = {"spice", "build", "-gsplit-dwarf", "--target=x86_64-pc-windows-msvc",
+                        "../../media/test-project/test.spice"};
+  static constexpr int argc = std::size(argv);
+  CliOptions cliOptions;
+  Driver driver(cliOptions, true);
+  ASSERT_EQ(EXIT_SUCCESS, driver.parse(argc, argv));
+
+  try {
+    driver.enrich();
+    FAIL();
+  } catch (CliError &error) {
+    const auto errorMsg = "[Error|CLI] Feature is not supported for this target: Split DWARF is only supported for ELF targets";
+    ASSERT_STREQ(errorMsg, error.what());
+  }
+}
+
+TEST(DriverTest, TypeUnitsTurnedOffAgain) {
+  // LLVM cl options are process-global, so a compilation with type units must not leak them into the next one
+  const auto enrich = [](const char *debugInfoFlag) {
+    const char *argv[] = {"spice", "build", debugInfoFlag, "--target=x86_64-pc-linux-gnu", "../../media/test-project/test.spice"};
+    static constexpr int argc = std::size(argv);
+    CliOptions cliOptions;
+    Driver driver(cliOptions, true);
+    ASSERT_EQ(EXIT_SUCCESS, driver.parse(argc, argv));
+    driver.enrich();
+  };
+  llvm::cl::Option *option = llvm::cl::getRegisteredOptions().lookup("generate-type-units");
+  ASSERT_NE(nullptr, option);
+  const auto generateTypeUnits = [&] { return static_cast<llvm::cl::opt<bool> *>(option)->getValue(); };
+
+  enrich("-fdebug-types-section");
+  ASSERT_TRUE(generateTypeUnits());
+  enrich("-g");
+  ASSERT_FALSE(generateTypeUnits());
+  enrich("-fdebug-types-section"); // Parsing the option a second time must not fail
+  ASSERT_TRUE(generateTypeUnits());
+  enrich("-gline-tables-only");
+  ASSERT_FALSE(generateTypeUnits());
+}
+
 TEST(DriverTest, IncompatibleOptions) {
   // --static in combination with --output-container=dylib is not allowed
   const char *argv[] = {"spice", "build", "--static", "--output-container=dylib", "../../media/test-project/test.spice"};
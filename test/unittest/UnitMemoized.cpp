@@ -0,0 +1,60 @@
+// Copyright (c) 2021-2026 ChilliBits. All rights reserved.
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <util/Memoized.h>
+
+// LCOV_EXCL_START
+
+namespace spice::testing {
+
+using namespace spice::compiler;
+
+struct MemoOwner {
+  std::string suffix;
+  Memoized<std::string> name;
+
+  const std::string &getName(unsigned int &computations) const {
+    return name.get([&] {
+      computations++;
+      return "name" + suffix;
+    });
+  }
+};
+
+TEST(MemoizedTest, ComputeOnce) {
+  unsigned int computations = 0;
+  const MemoOwner owner{".0"};
+  ASSERT_EQ("name.0", owner.getName(computations));
+  ASSERT_EQ("name.0", owner.getName(computations));
+  ASSERT_EQ(1, computations);
+
+  owner.name.reset();
+  ASSERT_EQ("name.0", owner.getName(computations));
+  ASSERT_EQ(2, computations);
+}
+
+TEST(MemoizedTest, CopyStartsEmpty) {
+  unsigned int computations = 0;
+  const MemoOwner original{".0"};
+  ASSERT_EQ("name.0", original.getName(computations));
+
+  // Changing the input on the copy must not return the memoized value of the original
+  MemoOwner copy = original;
+  copy.suffix = ".1";
+  ASSERT_EQ("name.1", copy.getName(computations));
+  ASSERT_EQ("name.0", original.getName(computations));
+  ASSERT_EQ(2, computations);
+
+  // Copy assignment drops the memo as well
+  copy = original;
+  copy.suffix = ".2";
+  ASSERT_EQ("name.2", copy.getName(computations));
+  ASSERT_EQ(3, computations);
+}
+
+} // namespace spice::testing
+
+// LCOV_EXCL_STOP
\ No newline at end of file
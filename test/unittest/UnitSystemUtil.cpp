@@ -1,5 +1,7 @@
 // Copyright (c) 2021-2026 ChilliBits. All rights reserved.
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include <util/SystemUtil.h>
@@ -19,6 +21,29 @@ TEST(SystemUtilTest, IsGraphvizInstalled) {
   ASSERT_TRUE(SystemUtil::isGraphvizInstalled());
 }
 
+TEST(SystemUtilTest, PeakResidentSetSize) {
+  const size_t peakBefore = SystemUtil::getPeakResidentSetSize();
+  ASSERT_GT(peakBefore, 0);
+
+  // Touch 64 MB, which must show up in the peak
+  constexpr size_t ALLOC_SIZE = 64 * 1024 * 1024;
+  std::vector<char> buffer(ALLOC_SIZE, 1);
+  ASSERT_GE(SystemUtil::getPeakResidentSetSize(), ALLOC_SIZE);
+  ASSERT_EQ(1, buffer.back());
+}
+
+TEST(SystemUtilTest, ResidentSetSize) {
+  const size_t rssBefore = SystemUtil::getResidentSetSize();
+  ASSERT_GT(rssBefore, 0);
+
+  // Touch 64 MB, which must show up in the current resident set size
+  constexpr size_t ALLOC_SIZE = 64 * 1024 * 1024;
+  std::vector<char> buffer(ALLOC_SIZE, 1);
+  ASSERT_GE(SystemUtil::getResidentSetSize(), rssBefore + ALLOC_SIZE / 2);
+  ASSERT_LE(SystemUtil::getResidentSetSize(), SystemUtil::getPeakResidentSetSize());
+  ASSERT_EQ(1, buffer.back());
+}
+
 } // namespace spice::testing
 
 // LCOV_EXCL_STOP
\ No newline at end of file